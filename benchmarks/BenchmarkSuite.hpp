@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARK_SUITE_HPP
+#define EL_BENCHMARK_SUITE_HPP
+
+#include <El.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+
+namespace El {
+namespace bench {
+
+// Parameter sweeps are given on the command line as comma-separated lists,
+// e.g., --sizes=500,1000,2000
+inline vector<string> SplitList( const string& list )
+{
+    vector<string> items;
+    std::istringstream stream( list );
+    string item;
+    while( std::getline( stream, item, ',' ) )
+        if( !item.empty() )
+            items.push_back( item );
+    return items;
+}
+
+inline vector<Int> IntList( const string& list )
+{
+    vector<Int> values;
+    for( const auto& item : SplitList(list) )
+        values.push_back( std::stoll(item) );
+    return values;
+}
+
+// A grid height of zero selects the default, nearly square, grid
+inline Int GridHeight( Int height, mpi::Comm comm )
+{ return height == 0 ? Grid::DefaultHeight(mpi::Size(comm)) : height; }
+
+inline string GemmAlgorithmName( GemmAlgorithm alg )
+{
+    switch( alg )
+    {
+    case GEMM_DEFAULT:           return "DEFAULT";
+    case GEMM_SUMMA_A:           return "SUMMA_A";
+    case GEMM_SUMMA_B:           return "SUMMA_B";
+    case GEMM_SUMMA_C:           return "SUMMA_C";
+    case GEMM_SUMMA_DOT:         return "SUMMA_DOT";
+    case GEMM_CANNON:            return "CANNON";
+    case GEMM_SUMMA_C_PIPELINED: return "SUMMA_C_PIPELINED";
+    case GEMM_SUMMA_25D:         return "SUMMA_25D";
+    default:                     return "UNKNOWN";
+    }
+}
+
+inline GemmAlgorithm StringToGemmAlgorithm( const string& name )
+{
+    for( int alg=GEMM_DEFAULT; alg<=GEMM_SUMMA_25D; ++alg )
+        if( GemmAlgorithmName(GemmAlgorithm(alg)) == name )
+            return GemmAlgorithm(alg);
+    LogicError("Unknown Gemm algorithm: ",name);
+    return GEMM_DEFAULT;
+}
+
+inline string DistPairName( Dist U, Dist V )
+{ return BuildString("[",DistToString(U),",",DistToString(V),"]"); }
+
+// A named parameter of a benchmark run, which is written as a JSON number
+// when it is numeric
+struct Param
+{
+    string key, value;
+    bool numeric;
+
+    Param( const string& k, Int v )
+    : key(k), value(std::to_string(v)), numeric(true) { }
+    Param( const string& k, const string& v )
+    : key(k), value(v), numeric(false) { }
+    Param( const string& k, const char* v )
+    : key(k), value(v), numeric(false) { }
+};
+
+struct Run
+{
+    string name, kernel;
+    vector<Param> params;
+    Int iterations;
+    // Each repetition takes the time of the slowest process
+    double medianTime, minTime, maxTime;
+    // The model of the work of one repetition, summed over all processes
+    double flops, bytes;
+    // The bytes which the mpi:: wrappers moved during one repetition,
+    // summed over all processes and over sending and receiving
+    double commBytes;
+};
+
+inline string EscapeJSON( const string& str )
+{
+    string escaped;
+    for( char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Collects timed runs of the kernels of one benchmark driver and writes
+// them as a JSON report in the layout of Google Benchmark, so that the
+// runs of different builds may be compared by name.
+//
+// Every run is collective over the communicator of the suite. Each
+// repetition begins with a barrier, and the time of a repetition is the
+// maximum over the processes. The median repetition is reported as the
+// time of the run.
+class Suite
+{
+public:
+    Suite( const string& name, mpi::Comm comm, Int numReps, Int numWarmups )
+    : name_(name), comm_(comm), numReps_(numReps), numWarmups_(numWarmups)
+    {
+        if( numReps < 1 )
+            LogicError("At least one repetition is required");
+    }
+
+    // Times the kernel, whose work is modeled by the given numbers of
+    // floating-point operations and bytes of memory or network traffic
+    template<typename Kernel>
+    void Time
+    ( const string& kernel, const vector<Param>& params,
+      double flops, double bytes, Kernel&& run )
+    {
+        for( Int rep=0; rep<numWarmups_; ++rep )
+            run();
+
+        Timer timer;
+        vector<double> times( numReps_ );
+        for( Int rep=0; rep<numReps_; ++rep )
+        {
+            mpi::Barrier( comm_ );
+            timer.Start();
+            run();
+            times[rep] = timer.Stop();
+        }
+        mpi::AllReduce( times.data(), numReps_, mpi::MAX, comm_ );
+        std::sort( times.begin(), times.end() );
+
+        Run result;
+        result.kernel = kernel;
+        result.params = params;
+        result.name = kernel;
+        for( const auto& param : params )
+            result.name += "/" + param.key + ":" + param.value;
+        result.iterations = numReps_;
+        result.medianTime = times[numReps_/2];
+        result.minTime = times.front();
+        result.maxTime = times.back();
+        result.flops = flops;
+        result.bytes = bytes;
+        result.commBytes = CommunicatedBytes( run );
+        runs_.push_back( result );
+
+        OutputFromRoot
+        (comm_,result.name,": ",result.medianTime," s",
+         (flops > 0 ?
+          BuildString(", ",Rate(flops,result.medianTime)," GFLOP/s") :
+          string()),
+         (bytes > 0 ?
+          BuildString(", ",Rate(bytes,result.medianTime)," GB/s") :
+          string()));
+    }
+
+    // Writes the report from the root of the communicator. An empty
+    // filename writes to standard output.
+    void Write( const string& filename ) const
+    {
+        if( mpi::Rank(comm_) != 0 )
+            return;
+        ostringstream json;
+        json << std::setprecision(10);
+        json << "{\n  \"context\": {\n"
+             << "    \"suite\": \"" << EscapeJSON(name_) << "\",\n"
+             << "    \"date\": \"" << Date() << "\",\n"
+             << "    \"git_sha1\": \"" << EL_GIT_SHA1 << "\",\n"
+#ifdef EL_RELEASE
+             << "    \"library_build_type\": \"release\",\n"
+#else
+             << "    \"library_build_type\": \"debug\",\n"
+#endif
+             << "    \"num_processes\": " << mpi::Size(comm_) << ",\n"
+             << "    \"num_threads\": " << NumThreads() << ",\n"
+             << "    \"counter_seed\": " << CounterSeed() << ",\n"
+             << "    \"repetitions\": " << numReps_ << ",\n"
+             << "    \"warmups\": " << numWarmups_ << "\n"
+             << "  },\n  \"benchmarks\": [";
+        for( std::size_t k=0; k<runs_.size(); ++k )
+        {
+            const Run& run = runs_[k];
+            json << (k == 0 ? "\n" : ",\n")
+                 << "    {\n"
+                 << "      \"name\": \"" << EscapeJSON(run.name) << "\",\n"
+                 << "      \"kernel\": \"" << EscapeJSON(run.kernel) << "\",\n"
+                 << "      \"params\": {";
+            for( std::size_t p=0; p<run.params.size(); ++p )
+            {
+                const Param& param = run.params[p];
+                json << (p == 0 ? "" : ", ")
+                     << "\"" << EscapeJSON(param.key) << "\": ";
+                if( param.numeric )
+                    json << param.value;
+                else
+                    json << "\"" << EscapeJSON(param.value) << "\"";
+            }
+            json << "},\n"
+                 << "      \"iterations\": " << run.iterations << ",\n"
+                 << "      \"real_time\": " << run.medianTime << ",\n"
+                 << "      \"min_time\": " << run.minTime << ",\n"
+                 << "      \"max_time\": " << run.maxTime << ",\n"
+                 << "      \"time_unit\": \"s\",\n"
+                 << "      \"flops\": " << run.flops << ",\n"
+                 << "      \"bytes\": " << run.bytes << ",\n"
+                 << "      \"comm_bytes\": " << run.commBytes << ",\n"
+                 << "      \"GFLOPS\": " << Rate(run.flops,run.medianTime)
+                 << ",\n"
+                 << "      \"GBps\": " << Rate(run.bytes,run.medianTime)
+                 << "\n    }";
+        }
+        json << "\n  ]\n}\n";
+
+        if( filename.empty() )
+        {
+            cout << json.str();
+            return;
+        }
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file << json.str();
+    }
+
+private:
+    string name_;
+    mpi::Comm comm_;
+    Int numReps_, numWarmups_;
+    vector<Run> runs_;
+
+    // Billions of units of work per second, where a run too fast for the
+    // timer has no (finite) rate
+    static double Rate( double work, double time )
+    { return time > 0 ? work/time/1.e9 : 0; }
+
+    static int NumThreads()
+    {
+#ifdef EL_HYBRID
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    static string Date()
+    {
+        const std::time_t now = std::time( nullptr );
+        char buffer[32];
+        std::strftime
+        ( buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&now) );
+        return buffer;
+    }
+
+    // Runs the kernel once more with the communication counters enabled,
+    // unless the caller is already counting
+    template<typename Kernel>
+    double CommunicatedBytes( Kernel& run ) const
+    {
+        if( CommCountersEnabled() )
+            return 0;
+        ResetCommCounters();
+        EnableCommCounters( false );
+        run();
+        DisableCommCounters();
+        double bytes = 0;
+        for( const auto& entry : CommCountsByComm() )
+            bytes += entry.second.bytesSent + entry.second.bytesReceived;
+        ResetCommCounters();
+        return mpi::AllReduce( bytes, mpi::SUM, comm_ );
+    }
+};
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARK_SUITE_HPP
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Measures the cost of the overflow-safe column and row norms relative to a
+// naive (unsafe) sum of squares and to the incremental UpdateScaledSquare
+// recurrence.
+
+template<typename F>
+double TimeKernel( F kernel, Int numReps )
+{
+    // Warm up the caches and page in the buffers
+    kernel();
+
+    Timer timer;
+    timer.Start();
+    for( Int rep=0; rep<numReps; ++rep )
+        kernel();
+    return timer.Stop() / numReps;
+}
+
+template<typename Field>
+void NaiveColumnTwoNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
+{
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    norms.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Field* ACol = A.LockedBuffer(0,j);
+        Real sum = 0;
+        for( Int i=0; i<m; ++i )
+            sum += RealPart(Conj(ACol[i])*ACol[i]);
+        norms(j) = Sqrt(sum);
+    }
+}
+
+template<typename Field>
+void NaiveRowTwoNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
+{
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    norms.Resize( m, 1 );
+    Zero( norms );
+    Real* normsBuf = norms.Buffer();
+    for( Int j=0; j<n; ++j )
+    {
+        const Field* ACol = A.LockedBuffer(0,j);
+        for( Int i=0; i<m; ++i )
+            normsBuf[i] += RealPart(Conj(ACol[i])*ACol[i]);
+    }
+    for( Int i=0; i<m; ++i )
+        normsBuf[i] = Sqrt(normsBuf[i]);
+}
+
+template<typename Field>
+void IncrementalColumnTwoNorms
+( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
+{
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    norms.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        for( Int i=0; i<m; ++i )
+            UpdateScaledSquare( A(i,j), scale, scaledSquare );
+        norms(j) = scale*Sqrt(scaledSquare);
+    }
+}
+
+template<typename Real>
+void CheckNorms
+( const string& name, const Matrix<Real>& norms, const Matrix<Real>& ref )
+{
+    Matrix<Real> E( norms );
+    E -= ref;
+    const Real tol = 100*limits::Epsilon<Real>()*(MaxNorm(ref)+1);
+    if( MaxNorm(E) > tol )
+        LogicError(name," did not match the naive norms");
+}
+
+void Report
+( const string& name, double numBytes,
+  double naiveTime, double incrementalTime, double safeTime )
+{
+    Output
+    (name,": naive ",numBytes/naiveTime/1.e9," GB/s, incremental ",
+     numBytes/incrementalTime/1.e9," GB/s, safe ",
+     numBytes/safeTime/1.e9," GB/s (",safeTime/naiveTime,
+     "x the naive time)");
+}
+
+template<typename Field>
+void BenchmarkNorms( Int m, Int n, Int numReps )
+{
+    typedef Base<Field> Real;
+    Output("Benchmarking with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A;
+    Uniform( A, m, n );
+    Matrix<Real> naiveNorms, incrementalNorms, safeNorms;
+    const double numBytes = double(m)*n*sizeof(Field);
+
+    const double naiveColTime = TimeKernel
+    ( [&]() { NaiveColumnTwoNorms( A, naiveNorms ); }, numReps );
+    const double incrementalColTime = TimeKernel
+    ( [&]() { IncrementalColumnTwoNorms( A, incrementalNorms ); }, numReps );
+    const double safeColTime = TimeKernel
+    ( [&]() { ColumnTwoNorms( A, safeNorms ); }, numReps );
+    CheckNorms( "incremental column norms", incrementalNorms, naiveNorms );
+    CheckNorms( "column norms", safeNorms, naiveNorms );
+    Report
+    ( "column two-norms", numBytes,
+      naiveColTime, incrementalColTime, safeColTime );
+
+    const double naiveRowTime = TimeKernel
+    ( [&]() { NaiveRowTwoNorms( A, naiveNorms ); }, numReps );
+    const double safeRowTime = TimeKernel
+    ( [&]() { RowTwoNorms( A, safeNorms ); }, numReps );
+    CheckNorms( "row norms", safeNorms, naiveNorms );
+    Output
+    ("row two-norms: naive ",numBytes/naiveRowTime/1.e9," GB/s, safe ",
+     numBytes/safeRowTime/1.e9," GB/s (",safeRowTime/naiveRowTime,
+     "x the naive time)");
+
+    const double colMaxTime = TimeKernel
+    ( [&]() { ColumnMaxNorms( A, safeNorms ); }, numReps );
+    const double rowMaxTime = TimeKernel
+    ( [&]() { RowMaxNorms( A, safeNorms ); }, numReps );
+    Output
+    ("max norms: columns ",numBytes/colMaxTime/1.e9," GB/s, rows ",
+     numBytes/rowMaxTime/1.e9," GB/s");
+
+    // The safe norms of entries whose squares overflow
+    const Real huge = Sqrt(limits::Max<Real>());
+    A *= Field(huge);
+    ColumnTwoNorms( A, safeNorms );
+    NaiveColumnTwoNorms( A, naiveNorms );
+    Output
+    ("with entries scaled by ",huge,": safe norm ",safeNorms(0),
+     ", naive norm ",naiveNorms(0));
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",65536);
+        const Int n = Input("--n","width of matrix",256);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        // The kernels are purely local, so only the root process runs them
+        if( mpi::Rank(comm) == 0 )
+        {
+            BenchmarkNorms<float>( m, n, numReps );
+            BenchmarkNorms<double>( m, n, numReps );
+            BenchmarkNorms<Complex<double>>( m, n, numReps );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
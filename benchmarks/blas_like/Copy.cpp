@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "BenchmarkSuite.hpp"
+using namespace El;
+
+// Times the redistribution between every pair of elemental distributions.
+// The rate is reported relative to the size of the matrix, while the
+// measured communication volume of each pair is recorded separately.
+
+template<typename T,Dist U,Dist V,Dist S,Dist R>
+void BenchmarkPair( bench::Suite& suite, const DistMatrix<T,U,V>& A )
+{
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMatrix<T,S,R> B(g);
+    suite.Time
+    ( "Copy",
+      { bench::Param("type",TypeName<T>()),
+        bench::Param("from",bench::DistPairName(U,V)),
+        bench::Param("to",bench::DistPairName(S,R)),
+        bench::Param("m",m), bench::Param("n",n),
+        bench::Param("grid",BuildString(g.Height(),"x",g.Width())) },
+      0, double(m)*n*sizeof(T),
+      [&]() { B = A; } );
+}
+
+template<typename T,Dist U,Dist V>
+void BenchmarkFrom( bench::Suite& suite, const Grid& g, Int m, Int n )
+{
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+
+    BenchmarkPair<T,U,V,CIRC,CIRC>( suite, A );
+    BenchmarkPair<T,U,V,MC,  MR  >( suite, A );
+    BenchmarkPair<T,U,V,MC,  STAR>( suite, A );
+    BenchmarkPair<T,U,V,MD,  STAR>( suite, A );
+    BenchmarkPair<T,U,V,MR,  MC  >( suite, A );
+    BenchmarkPair<T,U,V,MR,  STAR>( suite, A );
+    BenchmarkPair<T,U,V,STAR,MC  >( suite, A );
+    BenchmarkPair<T,U,V,STAR,MD  >( suite, A );
+    BenchmarkPair<T,U,V,STAR,MR  >( suite, A );
+    BenchmarkPair<T,U,V,STAR,STAR>( suite, A );
+    BenchmarkPair<T,U,V,STAR,VC  >( suite, A );
+    BenchmarkPair<T,U,V,STAR,VR  >( suite, A );
+    BenchmarkPair<T,U,V,VC,  STAR>( suite, A );
+    BenchmarkPair<T,U,V,VR,  STAR>( suite, A );
+}
+
+template<typename T>
+void BenchmarkRedistributions
+( bench::Suite& suite, const Grid& g, Int m, Int n )
+{
+    BenchmarkFrom<T,CIRC,CIRC>( suite, g, m, n );
+    BenchmarkFrom<T,MC,  MR  >( suite, g, m, n );
+    BenchmarkFrom<T,MC,  STAR>( suite, g, m, n );
+    BenchmarkFrom<T,MD,  STAR>( suite, g, m, n );
+    BenchmarkFrom<T,MR,  MC  >( suite, g, m, n );
+    BenchmarkFrom<T,MR,  STAR>( suite, g, m, n );
+    BenchmarkFrom<T,STAR,MC  >( suite, g, m, n );
+    BenchmarkFrom<T,STAR,MD  >( suite, g, m, n );
+    BenchmarkFrom<T,STAR,MR  >( suite, g, m, n );
+    BenchmarkFrom<T,STAR,STAR>( suite, g, m, n );
+    BenchmarkFrom<T,STAR,VC  >( suite, g, m, n );
+    BenchmarkFrom<T,STAR,VR  >( suite, g, m, n );
+    BenchmarkFrom<T,VC,  STAR>( suite, g, m, n );
+    BenchmarkFrom<T,VR,  STAR>( suite, g, m, n );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string sizeList =
+          Input("--sizes","comma-separated matrix sizes",string("1000"));
+        const string gridList =
+          Input("--gridHeights","grid heights (0 for default)",string("0"));
+        const Int numReps = Input("--numReps","timed repetitions",5);
+        const Int numWarmups = Input("--numWarmups","untimed repetitions",1);
+        const Int seed = Input("--seed","random seed",1);
+        const string json = Input("--json","JSON report file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        SetCounterSeed( seed );
+        bench::Suite suite( "Copy", comm, numReps, numWarmups );
+        for( const Int gridHeight : bench::IntList(gridList) )
+        {
+            const Int height = bench::GridHeight( gridHeight, comm );
+            if( mpi::Size(comm) % height != 0 )
+            {
+                OutputFromRoot(comm,"Skipping invalid grid height ",height);
+                continue;
+            }
+            const Grid g( comm, height );
+            for( const Int size : bench::IntList(sizeList) )
+                BenchmarkRedistributions<double>( suite, g, size, size );
+        }
+        suite.Write( json );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
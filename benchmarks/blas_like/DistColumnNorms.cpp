@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "BenchmarkSuite.hpp"
+using namespace El;
+
+// Sweeps the distributed column and row norms over the problem shapes and
+// grid shapes. The rates are relative to a single pass over the matrix.
+
+template<typename Field>
+void BenchmarkNorms
+( bench::Suite& suite, const Grid& g, Int m, Int n )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> A(g);
+    Uniform( A, m, n );
+    DistMatrix<Real,MR,STAR> colNorms(g);
+    DistMatrix<Real,MC,STAR> rowNorms(g);
+
+    const double bytes = double(m)*n*sizeof(Field);
+    const vector<bench::Param> params =
+      { bench::Param("type",TypeName<Field>()),
+        bench::Param("m",m), bench::Param("n",n),
+        bench::Param("grid",BuildString(g.Height(),"x",g.Width())) };
+    suite.Time
+    ( "ColumnTwoNorms", params, 0, bytes,
+      [&]() { ColumnTwoNorms( A, colNorms ); } );
+    suite.Time
+    ( "ColumnMaxNorms", params, 0, bytes,
+      [&]() { ColumnMaxNorms( A, colNorms ); } );
+    suite.Time
+    ( "RowTwoNorms", params, 0, bytes,
+      [&]() { RowTwoNorms( A, rowNorms ); } );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string heightList =
+          Input("--heights","comma-separated matrix heights",
+                string("10000,100000"));
+        const string widthList =
+          Input("--widths","comma-separated matrix widths",string("100"));
+        const string gridList =
+          Input("--gridHeights","grid heights (0 for default)",string("0,1"));
+        const Int numReps = Input("--numReps","timed repetitions",10);
+        const Int numWarmups = Input("--numWarmups","untimed repetitions",1);
+        const Int seed = Input("--seed","random seed",1);
+        const string json = Input("--json","JSON report file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        SetCounterSeed( seed );
+        bench::Suite suite( "DistColumnNorms", comm, numReps, numWarmups );
+        for( const Int gridHeight : bench::IntList(gridList) )
+        {
+            const Int height = bench::GridHeight( gridHeight, comm );
+            if( mpi::Size(comm) % height != 0 )
+            {
+                OutputFromRoot(comm,"Skipping invalid grid height ",height);
+                continue;
+            }
+            const Grid g( comm, height );
+            for( const Int m : bench::IntList(heightList) )
+                for( const Int n : bench::IntList(widthList) )
+                {
+                    BenchmarkNorms<float>( suite, g, m, n );
+                    BenchmarkNorms<double>( suite, g, m, n );
+                }
+        }
+        suite.Write( json );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares the std::function overload of EntrywiseMap, which performs an
+// indirect call per entry, with the overload templated on the callable,
+// which allows the map to be inlined and vectorized.
+
+template<typename T>
+struct ReLU
+{
+    T operator()( const T& x ) const { return x > T(0) ? x : T(0); }
+};
+
+template<typename T>
+struct Sigmoid
+{
+    T operator()( const T& x ) const { return T(1) / (T(1) + std::exp(-x)); }
+};
+
+template<typename T>
+struct Clamp
+{
+    T operator()( const T& x ) const
+    { return x < T(-1) ? T(-1) : ( x > T(1) ? T(1) : x ); }
+};
+
+template<typename T,typename F>
+double TimeMap( Matrix<T>& A, F func, Int numReps )
+{
+    // Warm up the caches and page in the buffer
+    EntrywiseMap( A, func );
+
+    Timer timer;
+    timer.Start();
+    for( Int rep=0; rep<numReps; ++rep )
+        EntrywiseMap( A, func );
+    return timer.Stop() / numReps;
+}
+
+template<typename T,typename F>
+void BenchmarkMap
+( const string& name, F func, Int m, Int n, Int ldim, Int numReps )
+{
+    Matrix<T> A( m, n, ldim );
+    MakeUniform( A );
+
+    function<T(const T&)> stdFunc = func;
+    const double stdTime = TimeMap( A, stdFunc, numReps );
+    const double inlineTime = TimeMap( A, func, numReps );
+
+    // Each entry is read and written once
+    const double numBytes = 2.*m*n*sizeof(T);
+    Output
+    (name," (ldim=",ldim,"): std::function ",numBytes/stdTime/1.e9," GB/s, ",
+     "inlined ",numBytes/inlineTime/1.e9," GB/s, speedup ",
+     stdTime/inlineTime);
+}
+
+template<typename T>
+void BenchmarkMaps( Int m, Int n, Int ldimPad, Int numReps )
+{
+    Output("Benchmarking with ",TypeName<T>());
+    PushIndent();
+    for( Int pad : { Int(0), ldimPad } )
+    {
+        const Int ldim = m + pad;
+        BenchmarkMap<T>( "ReLU", ReLU<T>(), m, n, ldim, numReps );
+        BenchmarkMap<T>( "sigmoid", Sigmoid<T>(), m, n, ldim, numReps );
+        BenchmarkMap<T>( "clamp", Clamp<T>(), m, n, ldim, numReps );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",4096);
+        const Int n = Input("--n","width of matrix",4096);
+        const Int ldimPad = Input("--ldimPad","padding for strided case",16);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        // The maps are purely local, so only the root process runs them
+        if( mpi::Rank(comm) == 0 )
+        {
+            BenchmarkMaps<float>( m, n, ldimPad, numReps );
+            BenchmarkMaps<double>( m, n, ldimPad, numReps );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compares chains of level-1 calls, each of which makes a full pass over
+// memory, with the equivalent lazy expressions, which are evaluated in a
+// single fused sweep.
+
+template<typename F>
+double TimeKernel( F kernel, Int numReps )
+{
+    // Warm up the caches and page in the buffers
+    kernel();
+
+    Timer timer;
+    timer.Start();
+    for( Int rep=0; rep<numReps; ++rep )
+        kernel();
+    return timer.Stop() / numReps;
+}
+
+template<typename T>
+void CheckClose
+( const string& name, const Matrix<T>& X, const Matrix<T>& Y )
+{
+    Matrix<T> E( Y );
+    E -= X;
+    const Base<T> tol = 10*limits::Epsilon<Base<T>>()*(FrobeniusNorm(X)+1);
+    if( FrobeniusNorm(E) > tol )
+        LogicError(name," did not match the unfused result");
+}
+
+template<typename T>
+void Report
+( const string& name, Int numPasses, Int m, Int n,
+  double unfusedTime, double fusedTime )
+{
+    // The minimum traffic is one read per operand and one write
+    const double numBytes = double(numPasses)*m*n*sizeof(T);
+    Output
+    (name,": unfused ",numBytes/unfusedTime/1.e9," GB/s, fused ",
+     numBytes/fusedTime/1.e9," GB/s, speedup ",unfusedTime/fusedTime);
+}
+
+template<typename T>
+void BenchmarkExpressions( Int m, Int n, Int numReps )
+{
+    Output("Benchmarking with ",TypeName<T>());
+    PushIndent();
+
+    Matrix<T> A, B, Y, YOrig, Z, W;
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( YOrig, m, n );
+    const T alpha = T(2), beta = T(-3), gamma = T(1)/T(2);
+
+    // Y := alpha A .* B + beta Y
+    {
+        const double unfusedTime = TimeKernel
+        ( [&]()
+          {
+              Z = YOrig;
+              Hadamard( A, B, W );
+              Scale( beta, Z );
+              Axpy( alpha, W, Z );
+          }, numReps );
+        const double fusedTime = TimeKernel
+        ( [&]()
+          {
+              Y = YOrig;
+              expr::Evaluate
+              ( alpha*expr::Hadamard(expr::Lazy(A),expr::Lazy(B)) +
+                beta*expr::Lazy(Y), Y );
+          }, numReps );
+        CheckClose( "axpby of a Hadamard product", Z, Y );
+        Report<T>( "axpby of a Hadamard product", 4, m, n,
+                   unfusedTime, fusedTime );
+    }
+
+    // Y := alpha (A .* B + gamma) + beta Y
+    {
+        const double unfusedTime = TimeKernel
+        ( [&]()
+          {
+              Z = YOrig;
+              Hadamard( A, B, W );
+              Shift( W, gamma );
+              Scale( beta, Z );
+              Axpy( alpha, W, Z );
+          }, numReps );
+        const double fusedTime = TimeKernel
+        ( [&]()
+          {
+              Y = YOrig;
+              expr::Evaluate
+              ( alpha*(expr::Hadamard(expr::Lazy(A),expr::Lazy(B))+gamma) +
+                beta*expr::Lazy(Y), Y );
+          }, numReps );
+        CheckClose( "shifted axpby of a Hadamard product", Z, Y );
+        Report<T>( "shifted axpby of a Hadamard product", 4, m, n,
+                   unfusedTime, fusedTime );
+    }
+
+    // || alpha A - B ||_F and max |alpha A - B|
+    {
+        Base<T> unfusedNorm=0, fusedNorm=0, unfusedMax=0, fusedMax=0;
+        const double unfusedTime = TimeKernel
+        ( [&]()
+          {
+              W = B;
+              W *= T(-1);
+              Axpy( alpha, A, W );
+              unfusedNorm = FrobeniusNorm( W );
+              unfusedMax = MaxAbs( W );
+          }, numReps );
+        const double fusedTime = TimeKernel
+        ( [&]()
+          {
+              auto diff = alpha*expr::Lazy(A) - expr::Lazy(B);
+              fusedNorm = expr::FrobeniusNorm( diff );
+              fusedMax = expr::MaxAbs( diff );
+          }, numReps );
+        const Base<T> tol = 10*limits::Epsilon<Base<T>>()*unfusedNorm*m;
+        if( Abs(unfusedNorm-fusedNorm) > tol ||
+            Abs(unfusedMax-fusedMax) > tol )
+            LogicError("norms of a difference did not match");
+        Report<T>( "norms of a difference", 2, m, n,
+                   unfusedTime, fusedTime );
+    }
+
+    // Dot( A, B .* Y )
+    {
+        T unfusedDot=0, fusedDot=0;
+        const double unfusedTime = TimeKernel
+        ( [&]()
+          {
+              Hadamard( B, YOrig, W );
+              unfusedDot = Dot( A, W );
+          }, numReps );
+        const double fusedTime = TimeKernel
+        ( [&]()
+          {
+              fusedDot = expr::Dot
+              ( expr::Lazy(A),
+                expr::Hadamard(expr::Lazy(B),expr::Lazy(YOrig)) );
+          }, numReps );
+        const Base<T> tol =
+          10*limits::Epsilon<Base<T>>()*m*n*(Abs(unfusedDot)+1);
+        if( Abs(unfusedDot-fusedDot) > tol )
+            LogicError("dot product of a Hadamard product did not match");
+        Report<T>( "dot product of a Hadamard product", 3, m, n,
+                   unfusedTime, fusedTime );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",4096);
+        const Int n = Input("--n","width of matrix",4096);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        // The expressions are purely local, so only the root process runs
+        // them
+        if( mpi::Rank(comm) == 0 )
+        {
+            BenchmarkExpressions<float>( m, n, numReps );
+            BenchmarkExpressions<double>( m, n, numReps );
+            BenchmarkExpressions<Complex<double>>( m, n, numReps );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
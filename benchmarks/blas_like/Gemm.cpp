@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "BenchmarkSuite.hpp"
+using namespace El;
+
+// Sweeps the local Gemm, run simultaneously on every process, and the
+// distributed Gemm over the problem sizes, grid shapes, algorithms and
+// algorithmic blocksizes.
+
+template<typename T>
+double GemmFlops( Int m, Int n, Int k )
+{ return (IsComplex<T>::value ? 8. : 2.)*m*n*k; }
+
+template<typename T>
+void BenchmarkLocalGemm
+( bench::Suite& suite, mpi::Comm comm, const vector<Int>& sizes )
+{
+    const int commSize = mpi::Size( comm );
+    for( const Int size : sizes )
+    {
+        Matrix<T> A, B, C;
+        Uniform( A, size, size );
+        Uniform( B, size, size );
+        Zeros( C, size, size );
+        suite.Time
+        ( "LocalGemm",
+          { bench::Param("type",TypeName<T>()), bench::Param("n",size) },
+          commSize*GemmFlops<T>(size,size,size),
+          commSize*3.*size*size*sizeof(T),
+          [&]() { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C ); } );
+    }
+}
+
+template<typename T>
+void BenchmarkDistGemm
+( bench::Suite& suite, mpi::Comm comm,
+  Orientation orientA, Orientation orientB,
+  const vector<Int>& sizes, const vector<Int>& gridHeights,
+  const vector<GemmAlgorithm>& algs, const vector<Int>& blocksizes )
+{
+    for( const Int gridHeight : gridHeights )
+    {
+        const Int height = bench::GridHeight( gridHeight, comm );
+        if( mpi::Size(comm) % height != 0 )
+        {
+            OutputFromRoot(comm,"Skipping invalid grid height ",height);
+            continue;
+        }
+        const Grid g( comm, height );
+        for( const Int size : sizes )
+        {
+            DistMatrix<T> A(g), B(g), C(g);
+            Uniform( A, size, size );
+            Uniform( B, size, size );
+            Zeros( C, size, size );
+            for( const GemmAlgorithm alg : algs )
+            {
+                // The dot-product variant only supports normal operands
+                if( alg == GEMM_SUMMA_DOT &&
+                    (orientA != NORMAL || orientB != NORMAL) )
+                    continue;
+                for( const Int blocksize : blocksizes )
+                {
+                    SetBlocksize( blocksize );
+                    suite.Time
+                    ( "Gemm",
+                      { bench::Param("type",TypeName<T>()),
+                        bench::Param("orient",
+                          BuildString(OrientationToChar(orientA),
+                                      OrientationToChar(orientB))),
+                        bench::Param("n",size),
+                        bench::Param("grid",
+                          BuildString(g.Height(),"x",g.Width())),
+                        bench::Param("alg",bench::GemmAlgorithmName(alg)),
+                        bench::Param("nb",blocksize) },
+                      GemmFlops<T>(size,size,size),
+                      3.*size*size*sizeof(T),
+                      [&]()
+                      { Gemm( orientA, orientB, T(1), A, B, T(0), C, alg ); } );
+                }
+            }
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string sizeList =
+          Input("--sizes","comma-separated matrix sizes",string("500,1000"));
+        const string localSizeList =
+          Input("--localSizes","sizes for the local Gemm",string("256,512"));
+        const string gridList =
+          Input("--gridHeights","grid heights (0 for default)",string("0"));
+        const string algList =
+          Input("--algs","Gemm algorithms",
+                string("DEFAULT,SUMMA_A,SUMMA_B,SUMMA_C,SUMMA_DOT,CANNON,"
+                       "SUMMA_C_PIPELINED,SUMMA_25D"));
+        const string blocksizeList =
+          Input("--blocksizes","algorithmic blocksizes",string("64,128"));
+        const char transA = Input("--transA","orientation of A: N/T/C",'N');
+        const char transB = Input("--transB","orientation of B: N/T/C",'N');
+        const Int numReps = Input("--numReps","timed repetitions",5);
+        const Int numWarmups = Input("--numWarmups","untimed repetitions",1);
+        const Int seed = Input("--seed","random seed",1);
+        const string json = Input("--json","JSON report file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        SetCounterSeed( seed );
+        vector<GemmAlgorithm> algs;
+        for( const auto& name : bench::SplitList(algList) )
+            algs.push_back( bench::StringToGemmAlgorithm(name) );
+
+        bench::Suite suite( "Gemm", comm, numReps, numWarmups );
+        BenchmarkLocalGemm<float>( suite, comm, bench::IntList(localSizeList) );
+        BenchmarkLocalGemm<double>
+        ( suite, comm, bench::IntList(localSizeList) );
+        BenchmarkDistGemm<double>
+        ( suite, comm,
+          CharToOrientation(transA), CharToOrientation(transB),
+          bench::IntList(sizeList), bench::IntList(gridList),
+          algs, bench::IntList(blocksizeList) );
+        suite.Write( json );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "BenchmarkSuite.hpp"
+using namespace El;
+
+// Sweeps the distributed Gemv over the problem sizes, grid shapes and
+// orientations. Since Gemv is bound by the memory bandwidth, the rate is
+// reported relative to a single pass over the matrix.
+
+template<typename T>
+void BenchmarkGemv
+( bench::Suite& suite, mpi::Comm comm,
+  const vector<Int>& sizes, const vector<Int>& gridHeights )
+{
+    for( const Int gridHeight : gridHeights )
+    {
+        const Int height = bench::GridHeight( gridHeight, comm );
+        if( mpi::Size(comm) % height != 0 )
+        {
+            OutputFromRoot(comm,"Skipping invalid grid height ",height);
+            continue;
+        }
+        const Grid g( comm, height );
+        for( const Int size : sizes )
+        {
+            DistMatrix<T> A(g), x(g), y(g);
+            Uniform( A, size, size );
+            Uniform( x, size, 1 );
+            Zeros( y, size, 1 );
+            const double flops = (IsComplex<T>::value ? 8. : 2.)*size*size;
+            const double bytes = double(size)*size*sizeof(T);
+            for( const Orientation orient : { NORMAL, TRANSPOSE } )
+            {
+                suite.Time
+                ( "Gemv",
+                  { bench::Param("type",TypeName<T>()),
+                    bench::Param("orient",string(1,OrientationToChar(orient))),
+                    bench::Param("n",size),
+                    bench::Param("grid",
+                      BuildString(g.Height(),"x",g.Width())) },
+                  flops, bytes,
+                  [&]() { Gemv( orient, T(1), A, x, T(0), y ); } );
+            }
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string sizeList =
+          Input("--sizes","comma-separated matrix sizes",string("2000,4000"));
+        const string gridList =
+          Input("--gridHeights","grid heights (0 for default)",string("0,1"));
+        const Int numReps = Input("--numReps","timed repetitions",10);
+        const Int numWarmups = Input("--numWarmups","untimed repetitions",1);
+        const Int seed = Input("--seed","random seed",1);
+        const string json = Input("--json","JSON report file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        SetCounterSeed( seed );
+        bench::Suite suite( "Gemv", comm, numReps, numWarmups );
+        BenchmarkGemv<float>
+        ( suite, comm, bench::IntList(sizeList), bench::IntList(gridList) );
+        BenchmarkGemv<double>
+        ( suite, comm, bench::IntList(sizeList), bench::IntList(gridList) );
+        suite.Write( json );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Measures the bandwidth of the local packing kernels used by the
+// redistributions, AllReduce, and Broadcast of non-contiguous matrices and
+// compares it against a plain memcpy of the same number of bytes.
+
+template<typename F>
+double TimeKernel( F kernel, Int numReps )
+{
+    // Warm up the caches and page in the buffers
+    kernel();
+
+    Timer timer;
+    timer.Start();
+    for( Int rep=0; rep<numReps; ++rep )
+        kernel();
+    return timer.Stop() / numReps;
+}
+
+template<typename T>
+void CheckEqual( const string& name, const T* A, const T* B, Int numEntries )
+{
+    for( Int k=0; k<numEntries; ++k )
+        if( A[k] != B[k] )
+            LogicError(name," produced an incorrect result at entry ",k);
+}
+
+template<typename T>
+void Report
+( const string& name, Int numEntries, double time, double memcpyTime )
+{
+    // Each entry is read and written once
+    const double numBytes = 2.*numEntries*sizeof(T);
+    Output
+    (name,": ",numBytes/time/1.e9," GB/s (",
+     100.*memcpyTime/time,"% of memcpy)");
+}
+
+template<typename T>
+void BenchmarkPacks( Int m, Int n, Int stride, Int align, Int numReps )
+{
+    Output("Benchmarking with ",TypeName<T>()," and stride ",stride);
+    PushIndent();
+
+    const Int numEntries = m*n;
+    vector<T> A(numEntries), B(numEntries), C(numEntries);
+    for( Int k=0; k<numEntries; ++k )
+        A[k] = T(k);
+
+    const double memcpyTime = TimeKernel
+    ( [&]() { std::memcpy( B.data(), A.data(), numEntries*sizeof(T) ); },
+      numReps );
+    Report<T>( "memcpy", numEntries, memcpyTime, memcpyTime );
+
+    // Unit column stride (a strided 2D copy of a contiguous panel)
+    {
+        const Int height = m - m/4;
+        const double time = TimeKernel
+        ( [&]()
+          { copy::util::InterleaveMatrix<T,Device::CPU>
+            ( height, n, A.data(), 1, m, B.data(), 1, height ); },
+          numReps );
+        Report<T>( "unit column stride", height*n, time, memcpyTime );
+    }
+
+    // Transposing pack
+    {
+        const double time = TimeKernel
+        ( [&]()
+          { copy::util::InterleaveMatrix<T,Device::CPU>
+            ( m, n, A.data(), 1, m, B.data(), n, 1 ); },
+          numReps );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                C[j+i*n] = A[i+j*m];
+        CheckEqual( "transposing pack", B.data(), C.data(), numEntries );
+        Report<T>( "transposing pack", numEntries, time, memcpyTime );
+    }
+
+    // Column-strided pack and unpack
+    {
+        const Int portionSize = MaxLength( m, stride )*n;
+        vector<T> portions(stride*portionSize);
+        const double packTime = TimeKernel
+        ( [&]()
+          { copy::util::ColStridedPack<T,Device::CPU>
+            ( m, n, align, stride, A.data(), m,
+              portions.data(), portionSize ); },
+          numReps );
+        for( Int k=0; k<stride; ++k )
+        {
+            const Int colShift = Shift( k, align, stride );
+            const Int localHeight = Length( m, colShift, stride );
+            for( Int j=0; j<n; ++j )
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    if( portions[k*portionSize+iLoc+j*localHeight] !=
+                        A[colShift+iLoc*stride+j*m] )
+                        LogicError("column-strided pack was incorrect");
+        }
+        Report<T>( "column-strided pack", numEntries, packTime, memcpyTime );
+
+        const double unpackTime = TimeKernel
+        ( [&]()
+          { copy::util::ColStridedUnpack<T,Device::CPU>
+            ( m, n, align, stride, portions.data(), portionSize,
+              B.data(), m ); },
+          numReps );
+        CheckEqual( "column-strided unpack", B.data(), A.data(), numEntries );
+        Report<T>
+        ( "column-strided unpack", numEntries, unpackTime, memcpyTime );
+    }
+
+    // Row-strided pack
+    {
+        const Int portionSize = m*MaxLength( n, stride );
+        vector<T> portions(stride*portionSize);
+        const double time = TimeKernel
+        ( [&]()
+          { copy::util::RowStridedPack<T,Device::CPU>
+            ( m, n, align, stride, A.data(), m,
+              portions.data(), portionSize ); },
+          numReps );
+        Report<T>( "row-strided pack", numEntries, time, memcpyTime );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",4096);
+        const Int n = Input("--n","width of matrix",4096);
+        const Int stride = Input("--stride","process grid stride",4);
+        const Int align = Input("--align","alignment of the portions",1);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        // The kernels are purely local, so only the root process runs them
+        if( mpi::Rank(comm) == 0 )
+        {
+            BenchmarkPacks<float>( m, n, stride, align, numReps );
+            BenchmarkPacks<double>( m, n, stride, align, numReps );
+            BenchmarkPacks<Complex<double>>( m, n, stride, align, numReps );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "BenchmarkSuite.hpp"
+using namespace El;
+
+// Times the matrix-level AllReduce and Broadcast over the full
+// communicator and over the column and row communicators of the default
+// grid. The rates are relative to the size of each process's matrix.
+
+template<typename T>
+void BenchmarkCollectives
+( bench::Suite& suite, mpi::Comm comm, const string& commName,
+  const vector<Int>& sizes )
+{
+    for( const Int size : sizes )
+    {
+        Matrix<T> A;
+        Uniform( A, size, size );
+        const double bytes = double(size)*size*sizeof(T);
+        const vector<bench::Param> params =
+          { bench::Param("type",TypeName<T>()),
+            bench::Param("comm",commName),
+            bench::Param("commSize",Int(mpi::Size(comm))),
+            bench::Param("n",size) };
+        // The maximum keeps the entries bounded over the repetitions
+        suite.Time
+        ( "AllReduce", params, 0, bytes,
+          [&]() { AllReduce( A, comm, mpi::MAX ); } );
+        suite.Time
+        ( "Broadcast", params, 0, bytes,
+          [&]() { Broadcast( A, comm, 0 ); } );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string sizeList =
+          Input("--sizes","comma-separated matrix sizes",string("64,256,1024"));
+        const Int numReps = Input("--numReps","timed repetitions",10);
+        const Int numWarmups = Input("--numWarmups","untimed repetitions",1);
+        const Int seed = Input("--seed","random seed",1);
+        const string json = Input("--json","JSON report file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        SetCounterSeed( seed );
+        const vector<Int> sizes = bench::IntList( sizeList );
+        const Grid g( comm );
+        bench::Suite suite( "Collectives", comm, numReps, numWarmups );
+        BenchmarkCollectives<double>( suite, comm, "world", sizes );
+        BenchmarkCollectives<double>( suite, g.ColComm(), "col", sizes );
+        BenchmarkCollectives<double>( suite, g.RowComm(), "row", sizes );
+        suite.Write( json );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "BenchmarkSuite.hpp"
+using namespace El;
+
+// Times the uniform and Gaussian fills of local matrices, run
+// simultaneously on every process, and of distributed matrices. The rates
+// are relative to the bytes written.
+
+template<typename T>
+void BenchmarkLocalFills
+( bench::Suite& suite, mpi::Comm comm, const vector<Int>& sizes )
+{
+    const int commSize = mpi::Size( comm );
+    for( const Int size : sizes )
+    {
+        Matrix<T> A;
+        const double bytes = commSize*double(size)*size*sizeof(T);
+        const vector<bench::Param> params =
+          { bench::Param("type",TypeName<T>()), bench::Param("n",size) };
+        suite.Time
+        ( "LocalUniform", params, 0, bytes,
+          [&]() { Uniform( A, size, size ); } );
+        suite.Time
+        ( "LocalGaussian", params, 0, bytes,
+          [&]() { Gaussian( A, size, size ); } );
+    }
+}
+
+template<typename T,Dist U,Dist V>
+void BenchmarkDistFills
+( bench::Suite& suite, const Grid& g, const vector<Int>& sizes )
+{
+    for( const Int size : sizes )
+    {
+        DistMatrix<T,U,V> A(g);
+        // Each redundant copy is written in full
+        const double bytes =
+          A.RedundantSize()*double(size)*size*sizeof(T);
+        const vector<bench::Param> params =
+          { bench::Param("type",TypeName<T>()),
+            bench::Param("dist",bench::DistPairName(U,V)),
+            bench::Param("n",size),
+            bench::Param("grid",BuildString(g.Height(),"x",g.Width())) };
+        suite.Time
+        ( "Uniform", params, 0, bytes,
+          [&]() { Uniform( A, size, size ); } );
+        suite.Time
+        ( "Gaussian", params, 0, bytes,
+          [&]() { Gaussian( A, size, size ); } );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const string sizeList =
+          Input("--sizes","comma-separated matrix sizes",string("1000,2000"));
+        const Int numReps = Input("--numReps","timed repetitions",5);
+        const Int numWarmups = Input("--numWarmups","untimed repetitions",1);
+        const Int seed = Input("--seed","random seed",1);
+        const string json = Input("--json","JSON report file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        SetCounterSeed( seed );
+        const vector<Int> sizes = bench::IntList( sizeList );
+        const Grid g( comm );
+        bench::Suite suite( "RandomMatrices", comm, numReps, numWarmups );
+        BenchmarkLocalFills<float>( suite, comm, sizes );
+        BenchmarkLocalFills<double>( suite, comm, sizes );
+        BenchmarkLocalFills<Complex<double>>( suite, comm, sizes );
+        BenchmarkDistFills<double,MC,MR>( suite, g, sizes );
+        BenchmarkDistFills<double,VC,STAR>( suite, g, sizes );
+        BenchmarkDistFills<double,STAR,STAR>( suite, g, sizes );
+        suite.Write( json );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
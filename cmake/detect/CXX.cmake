@@ -131,5 +131,19 @@ set(PRETTY_FUNCTION_CODE
      }")
 check_cxx_source_compiles("${PRETTY_FUNCTION_CODE}" EL_HAVE_PRETTY_FUNCTION)
 
+# POSIX memory mapping of files
+# =============================
+set(MMAP_CODE
+    "#include <sys/mman.h>
+     #include <fcntl.h>
+     #include <unistd.h>
+     int main()
+     {
+         void* data = mmap( 0, 4096, PROT_READ, MAP_SHARED, -1, 0 );
+         madvise( data, 4096, MADV_WILLNEED );
+         return munmap( data, 4096 );
+     }")
+check_cxx_source_compiles("${MMAP_CODE}" EL_HAVE_MMAP)
+
 unset(CMAKE_REQUIRED_FLAGS)
 unset(CMAKE_REQUIRED_DEFINITIONS)
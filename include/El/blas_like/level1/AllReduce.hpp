@@ -81,6 +81,87 @@ void AllReduce(AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op)
     AllReduce(A.Matrix(), comm, op);
 }
 
+template<typename T>
+MatrixRequest<T>
+IAllReduce(AbstractMatrix<T>& A, mpi::Comm comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    MatrixRequest<T> request;
+    if(mpi::Size(comm) == 1)
+        return request;
+    if(A.GetDevice() != Device::CPU)
+    {
+        // Fall back to the blocking version for device memory
+        AllReduce(A, comm, op);
+        return request;
+    }
+
+    auto& ACPU = static_cast<Matrix<T,Device::CPU>&>(A);
+    const Int height = ACPU.Height();
+    const Int width = ACPU.Width();
+    const Int size = height*width;
+    if(height == ACPU.LDim())
+    {
+        mpi::IAllReduce(ACPU.Buffer(), size, op, comm, request.request);
+    }
+    else
+    {
+        FastResize(request.buffer, size);
+        copy::util::InterleaveMatrix<T,Device::CPU>
+            (height, width,
+             ACPU.LockedBuffer(),    1, ACPU.LDim(),
+             request.buffer.data(), 1, height);
+        request.target = &ACPU;
+        mpi::IAllReduce
+        (request.buffer.data(), size, op, comm, request.request);
+    }
+    request.active = true;
+    return request;
+}
+
+template<typename T>
+MatrixRequest<T>
+IAllReduce(AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    if(mpi::Size(comm) == 1 || !A.Participating())
+        return MatrixRequest<T>();
+    return IAllReduce(A.Matrix(), comm, op);
+}
+
+template<typename T>
+void Wait(MatrixRequest<T>& request)
+{
+    EL_DEBUG_CSE
+    if(!request.active)
+        return;
+    mpi::Wait(request.request);
+    if(request.target != nullptr)
+    {
+        auto& A = *request.target;
+        copy::util::InterleaveMatrix<T,Device::CPU>
+            (A.Height(), A.Width(),
+             request.buffer.data(), 1, A.Height(),
+             A.Buffer(),            1, A.LDim());
+        request.target = nullptr;
+    }
+    SwapClear(request.buffer);
+    request.active = false;
+}
+
+template<typename T>
+bool Test(MatrixRequest<T>& request)
+{
+    EL_DEBUG_CSE
+    if(!request.active)
+        return true;
+    if(!mpi::Test(request.request))
+        return false;
+    // Unpack (and, for non-packed types, deserialize) the result
+    Wait(request);
+    return true;
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -91,7 +172,13 @@ void AllReduce(AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op)
   EL_EXTERN template void AllReduce \
   (AbstractMatrix<T>& A, mpi::Comm comm, mpi::Op op); \
   EL_EXTERN template void AllReduce \
-  (AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op);
+  (AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op); \
+  EL_EXTERN template MatrixRequest<T> IAllReduce \
+  (AbstractMatrix<T>& A, mpi::Comm comm, mpi::Op op); \
+  EL_EXTERN template MatrixRequest<T> IAllReduce \
+  (AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op); \
+  EL_EXTERN template void Wait(MatrixRequest<T>& request); \
+  EL_EXTERN template bool Test(MatrixRequest<T>& request);
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -108,6 +108,60 @@ void Broadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank )
     }
 }
 
+template<typename T>
+MatrixRequest<T> IBroadcast( AbstractMatrix<T>& A, mpi::Comm comm, int rank )
+{
+    EL_DEBUG_CSE
+    MatrixRequest<T> request;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    if( commSize == 1 )
+        return request;
+    if( A.GetDevice() != Device::CPU )
+    {
+        // Fall back to the blocking version for device memory
+        Broadcast( A, comm, rank );
+        return request;
+    }
+
+    auto& ACPU = static_cast<Matrix<T,Device::CPU>&>(A);
+    const Int height = ACPU.Height();
+    const Int width = ACPU.Width();
+    const Int size = height*width;
+    if( height == ACPU.LDim() )
+    {
+        mpi::IBroadcast( ACPU.Buffer(), size, rank, comm, request.request );
+    }
+    else
+    {
+        FastResize( request.buffer, size );
+
+        // Pack on the root and unpack everywhere else
+        if( commRank == rank )
+            copy::util::InterleaveMatrix<T,Device::CPU>
+            ( height, width,
+              ACPU.LockedBuffer(),    1, ACPU.LDim(),
+              request.buffer.data(), 1, height );
+        else
+            request.target = &ACPU;
+
+        mpi::IBroadcast
+        ( request.buffer.data(), size, rank, comm, request.request );
+    }
+    request.active = true;
+    return request;
+}
+
+template<typename T>
+MatrixRequest<T>
+IBroadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank )
+{
+    EL_DEBUG_CSE
+    if( mpi::Size(comm) == 1 || !A.Participating() )
+        return MatrixRequest<T>();
+    return IBroadcast( A.Matrix(), comm, rank );
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -118,6 +172,10 @@ void Broadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank )
   EL_EXTERN template void Broadcast \
   ( AbstractMatrix<T>& A, mpi::Comm comm, int rank ); \
   EL_EXTERN template void Broadcast \
+  ( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank ); \
+  EL_EXTERN template MatrixRequest<T> IBroadcast \
+  ( AbstractMatrix<T>& A, mpi::Comm comm, int rank ); \
+  EL_EXTERN template MatrixRequest<T> IBroadcast \
   ( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank );
 
 #define EL_ENABLE_DOUBLEDOUBLE
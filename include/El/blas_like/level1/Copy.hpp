@@ -16,6 +16,7 @@
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
+#include <El/blas_like/level1/Copy/RedistPlan.hpp>
 
 namespace El {
 
@@ -80,6 +80,7 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>(),BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::AllGather");
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
@@ -176,6 +176,7 @@ void ColAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "ColAllGather: For now, A and B must be on same device.");
@@ -200,6 +201,7 @@ void ColAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather");
     AssertSameGrids( A, B );
 
     EL_DEBUG_ONLY(
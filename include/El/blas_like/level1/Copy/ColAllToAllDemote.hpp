@@ -125,6 +125,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   ,BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllDemote");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
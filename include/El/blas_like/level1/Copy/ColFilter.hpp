@@ -83,6 +83,7 @@ void ColFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColFilter");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "ColFilter: For now, A and B must be on same device.");
@@ -107,6 +108,7 @@ void ColFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColFilter");
     EL_DEBUG_ONLY(
       if( A.ColDist() != Collect(B.ColDist()) ||
           A.RowDist() != B.RowDist() )
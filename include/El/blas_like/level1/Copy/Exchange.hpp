@@ -119,6 +119,7 @@ void Exchange
         ElementalMatrix<T>& B,
   int sendRank, int recvRank, mpi::Comm comm )
 {
+    EL_PROFILE_REGION("copy::Exchange");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError("Exchange: Device error.");
     switch (A.GetLocalDevice())
@@ -46,6 +46,7 @@ void Filter
         DistMatrix<T,        U,           V   ,BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Filter");
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
 }
@@ -97,6 +97,7 @@ void Gather
         DistMatrix<T,CIRC,CIRC,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Gather");
     AssertSameGrids(A, B);
     if(A.DistSize() == 1 && A.CrossSize() == 1)
     {
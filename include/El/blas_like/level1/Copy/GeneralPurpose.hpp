@@ -14,160 +14,170 @@ namespace El
 namespace copy
 {
 
+// Map each rank in the distribution communicator of A to the rank of its
+// redundant root within either the VC or the viewing communicator
+template<typename T>
+vector<int> DistRanksToComm(const AbstractDistMatrix<T>& A, bool viewing)
+{
+    const Grid& g = A.Grid();
+    const int distSize = A.DistSize();
+    vector<int> distToComm(distSize);
+    for(int distRank=0; distRank<distSize; ++distRank)
+    {
+        const int vcRank =
+          g.CoordsToVC(A.ColDist(),A.RowDist(),distRank,A.Root(),0);
+        distToComm[distRank] = (viewing ? g.VCToViewing(vcRank) : vcRank);
+    }
+    return distToComm;
+}
+
+// Since every process can evaluate the owner maps of both A and B, only the
+// values are transmitted: each sender walks its local entries of A in
+// column-major order and each receiver walks its local entries of B in the
+// same global order, attributing each entry to the process which owns it in
+// A. Whichever of S and T is smaller is used as the transmission type, and
+// the matrix is processed in column chunks so that the staging buffers on
+// each process stay within GeneralPurposeMemoryBudget() bytes.
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Helper
 (const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    typedef typename std::conditional<(sizeof(T)<sizeof(S)),T,S>::type W;
 
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
     const Int height = A.Height();
     const Int width = A.Width();
     const Grid& g = B.Grid();
     B.Resize(height, width);
     Zero(B);
-    const bool BPartic = B.Participating();
-    const int BRoot = B.Root();
 
     const bool includeViewers = (A.Grid() != B.Grid());
+    mpi::Comm comm;
+    if (includeViewers)
+        comm = g.ViewingComm();
+    else
+    {
+        if (!g.InGrid())
+            return;
+        comm = g.VCComm();
+    }
+    const int commSize = mpi::Size(comm);
+    const int commRank = mpi::Rank(comm);
+
+    // We will first push to redundant rank 0 of B
+    const int redundantRootB = 0;
+    const bool noRedundant = B.RedundantSize() == 1;
+    const bool sending = (A.Participating() && A.RedundantRank() == 0);
+    const bool receiving =
+      (B.Participating() && B.RedundantRank() == redundantRootB);
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
+    const auto distAToComm = DistRanksToComm(A, includeViewers);
+    const auto distBToComm = DistRanksToComm(B, includeViewers);
+    const int colStrideA = A.ColStride();
+    const int colStrideB = B.ColStride();
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if (A.RedundantRank() == 0)
+    // Precompute the owning process rows of the local rows
+    const Int localHeightA = A.LocalHeight();
+    const Int localHeightB = B.LocalHeight();
+    vector<int> ownerRowsB(sending ? localHeightA : 0);
+    for(Int iLoc=0; iLoc<Int(ownerRowsB.size()); ++iLoc)
+        ownerRowsB[iLoc] = B.RowOwner(A.GlobalRow(iLoc));
+    vector<int> ownerRowsA(receiving ? localHeightB : 0);
+    for(Int iLoc=0; iLoc<Int(ownerRowsA.size()); ++iLoc)
+        ownerRowsA[iLoc] = A.RowOwner(B.GlobalRow(iLoc));
+
+    // Every process must agree upon the chunk width, so it is based upon
+    // the average number of entries each process sends or receives
+    const size_t budgetEntries =
+      Max(GeneralPurposeMemoryBudget()/sizeof(W), size_t(1));
+    const Int minDistSize = Min(A.DistSize(), B.DistSize());
+    const Int chunkWidth =
+      Max(Min(Int(budgetEntries*minDistSize/Max(height,Int(1))), width),
+          Int(1));
+
+    vector<int> sendCounts(commSize), sendOffs(commSize),
+                recvCounts(commSize), recvOffs(commSize), offs;
+    vector<W> sendBuf, recvBuf;
+    for(Int jStart=0; jStart<width; jStart+=chunkWidth)
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for(Int iLoc=0; iLoc<localHeight; ++iLoc)
+        const Int jEnd = Min(jStart+chunkWidth, width);
+
+        // Count and pack the values from A
+        // ================================
+        const Int jLocBegA = (sending ? A.LocalColOffset(jStart) : 0);
+        const Int jLocEndA = (sending ? A.LocalColOffset(jEnd) : 0);
+        std::fill(sendCounts.begin(), sendCounts.end(), 0);
+        for(Int jLoc=jLocBegA; jLoc<jLocEndA; ++jLoc)
         {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
+            const int ownerCol = B.ColOwner(A.GlobalCol(jLoc));
+            for(Int iLoc=0; iLoc<localHeightA; ++iLoc)
+                ++sendCounts[distBToComm[ownerRowsB[iLoc]+colStrideB*ownerCol]];
         }
-
-        remoteEntries.reserve(localHeight*localWidth);
-        distOwners.reserve(localHeight*localWidth);
-        for(Int jLoc=0; jLoc<localWidth; ++jLoc)
+        if (noRedundant)
+            sendCounts[commRank] = 0;
+        const Int totalSend = Scan(sendCounts, sendOffs);
+        FastResize(sendBuf, totalSend);
+        offs = sendOffs;
+        for(Int jLoc=jLocBegA; jLoc<jLocEndA; ++jLoc)
         {
             const Int j = A.GlobalCol(jLoc);
             const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = (BPartic && ownerCol == rowRank);
-            for(Int iLoc=0; iLoc<localHeight; ++iLoc)
+            for(Int iLoc=0; iLoc<localHeightA; ++iLoc)
             {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = (BPartic && ownerRow == colRank);
+                const int owner =
+                  distBToComm[ownerRowsB[iLoc]+colStrideB*ownerCol];
                 const S& alpha = A.GetLocal(iLoc,jLoc);
-                if (noRedundant && isLocalRow && isLocalCol)
-                {
-                    B.SetLocal(localRow,localCol,Caster<S,T>::Cast(alpha));
-                }
+                if (noRedundant && owner == commRank)
+                    B.SetLocal
+                    (B.LocalRow(A.GlobalRow(iLoc)),B.LocalCol(j),
+                     Caster<S,T>::Cast(alpha));
                 else
-                {
-                    remoteEntries.push_back
-                    (Entry<S>{localRow,localCol,alpha});
-                    distOwners.push_back(ownerRow + colStride*ownerCol);
-                }
+                    sendBuf[offs[owner]++] = Caster<S,W>::Cast(alpha);
             }
         }
-    }
-
-    // We will first push to redundant rank 0 of B
-    const int redundantRootB = 0;
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
-    {
-        comm = g.ViewingComm();
-        const int viewingSize = mpi::Size(g.ViewingComm());
-        const int distBSize = mpi::Size(B.DistComm());
-
-        vector<int> distBToViewing(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
-        {
-            const int vcOwner =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
-            distBToViewing[distBRank] = g.VCToViewing(vcOwner);
-        }
-
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        // Count the values destined for B
+        // ===============================
+        const Int jLocBegB = (receiving ? B.LocalColOffset(jStart) : 0);
+        const Int jLocEndB = (receiving ? B.LocalColOffset(jEnd) : 0);
+        std::fill(recvCounts.begin(), recvCounts.end(), 0);
+        for(Int jLoc=jLocBegB; jLoc<jLocEndB; ++jLoc)
         {
-            owners[k] = distBToViewing[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const int ownerCol = A.ColOwner(B.GlobalCol(jLoc));
+            for(Int iLoc=0; iLoc<localHeightB; ++iLoc)
+                ++recvCounts[distAToComm[ownerRowsA[iLoc]+colStrideA*ownerCol]];
         }
-    }
-    else
-    {
-        if (!g.InGrid())
-            return;
-        comm = g.VCComm();
+        if (noRedundant)
+            recvCounts[commRank] = 0;
+        const Int totalRecv = Scan(recvCounts, recvOffs);
+        FastResize(recvBuf, totalRecv);
 
-        const int distBSize = mpi::Size(B.DistComm());
-        vector<int> distBToVC(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
+        // Exchange and unpack the values
+        // ==============================
+        mpi::AllToAll
+        (sendBuf.data(), sendCounts.data(), sendOffs.data(),
+         recvBuf.data(), recvCounts.data(), recvOffs.data(), comm);
+        offs = recvOffs;
+        for(Int jLoc=jLocBegB; jLoc<jLocEndB; ++jLoc)
         {
-            distBToVC[distBRank] =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
-        }
-
-        const int vcSize = mpi::Size(g.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
-        {
-            owners[k] = distBToVC[distOwners[k]];
-            ++sendCounts[owners[k]];
-        }
-    }
-    SwapClear(distOwners);
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
-    vector<Entry<S>> sendBuf;
-    FastResize(sendBuf, totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear(remoteEntries);
-    SwapClear(owners);
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
-    if (BPartic)
-    {
-        if (B.RedundantRank() == redundantRootB)
-        {
-            Int recvBufSize = recvBuf.size();
-            for(Int k=0; k<recvBufSize; ++k)
+            const int ownerCol = A.ColOwner(B.GlobalCol(jLoc));
+            for(Int iLoc=0; iLoc<localHeightB; ++iLoc)
             {
-                const auto& entry = recvBuf[k];
-                B.SetLocal(entry.i,entry.j,Caster<S,T>::Cast(entry.value));
+                const int owner =
+                  distAToComm[ownerRowsA[iLoc]+colStrideA*ownerCol];
+                if (noRedundant && owner == commRank)
+                    continue;
+                B.SetLocal
+                (iLoc,jLoc,Caster<W,T>::Cast(recvBuf[offs[owner]++]));
             }
         }
-        El::Broadcast(B, B.RedundantComm(), redundantRootB);
     }
+    SwapClear(sendBuf);
+    SwapClear(recvBuf);
+
+    if (B.Participating())
+        El::Broadcast(B, B.RedundantComm(), redundantRootB);
 }
 
 template<typename S,typename T,typename>
@@ -176,11 +186,16 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose");
 
-    if (A.Grid().Size() == 1 && B.Grid().Size() == 1)
+    // Converting copies between local matrices are only defined on the CPU
+    if (A.Grid().Size() == 1 && B.Grid().Size() == 1 &&
+        A.GetLocalDevice() == Device::CPU && B.GetLocalDevice() == Device::CPU)
     {
         B.Resize(A.Height(), A.Width());
-        Copy(A.LockedMatrix(), B.Matrix());
+        Copy
+        (static_cast<const Matrix<S,Device::CPU>&>(A.LockedMatrix()),
+         static_cast<Matrix<T,Device::CPU>&>(B.Matrix()));
         return;
     }
 
@@ -193,6 +208,7 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose");
 
     const Int height = A.Height();
     const Int width = A.Width();
@@ -133,6 +133,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V,BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColAllGather");
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
@@ -96,6 +96,7 @@ void PartialColFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColFilter");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "PartialColFilter: For now, A and B must be on same device.");
@@ -120,6 +121,7 @@ void PartialColFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColFilter");
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
@@ -106,6 +106,7 @@ void PartialRowAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowAllGather");
     EL_DEBUG_ONLY(
       if( B.ColDist() != A.ColDist() ||
           B.RowDist() != Partial(A.RowDist()) )
@@ -142,6 +143,7 @@ void PartialRowAllGather
         BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowAllGather");
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
@@ -95,6 +95,7 @@ void PartialRowFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowFilter");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "PartialRowFilter: For now, A and B must be on same device.");
@@ -119,6 +120,7 @@ void PartialRowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowFilter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
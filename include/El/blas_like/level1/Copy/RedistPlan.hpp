@@ -0,0 +1,328 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTPLAN_HPP
+#define EL_BLAS_COPY_REDISTPLAN_HPP
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+namespace El
+{
+namespace copy
+{
+
+// Everything which determines the communication pattern of a redistribution
+// between two element-wise distributions over the same grid
+struct RedistPlanKey
+{
+    Int height, width;
+    Dist colDistA, rowDistA, colDistB, rowDistB;
+    int colAlignA, rowAlignA, rootA;
+    int colAlignB, rowAlignB, rootB;
+    // Grid::Id rather than the address, which a later grid may reuse
+    std::uint64_t gridId;
+
+    bool operator<(const RedistPlanKey& other) const
+    {
+        return std::tie
+               (height, width, colDistA, rowDistA, colDistB, rowDistB,
+                colAlignA, rowAlignA, rootA, colAlignB, rowAlignB, rootB,
+                gridId) <
+               std::tie
+               (other.height, other.width,
+                other.colDistA, other.rowDistA,
+                other.colDistB, other.rowDistB,
+                other.colAlignA, other.rowAlignA, other.rootA,
+                other.colAlignB, other.rowAlignB, other.rootB,
+                other.gridId);
+    }
+};
+
+template<typename T>
+RedistPlanKey MakeRedistPlanKey
+(const ElementalMatrix<T>& A, const ElementalMatrix<T>& B)
+{
+    RedistPlanKey key;
+    key.height = A.Height();
+    key.width = A.Width();
+    key.colDistA = A.ColDist();
+    key.rowDistA = A.RowDist();
+    key.colDistB = B.ColDist();
+    key.rowDistB = B.RowDist();
+    key.colAlignA = A.ColAlign();
+    key.rowAlignA = A.RowAlign();
+    key.rootA = A.Root();
+    key.colAlignB = B.ColAlign();
+    key.rowAlignB = B.RowAlign();
+    key.rootB = B.Root();
+    key.gridId = A.Grid().Id();
+    return key;
+}
+
+// A precomputed redistribution from A into the distribution (and alignment)
+// of B.
+//
+// Building the plan performs the same owner computations as the
+// general-purpose redistribution (plus one exchange of the target indices),
+// after which each execution only packs the values through a precomputed
+// index map, performs a single AllToAll of the values over the VC
+// communicator, and scatters them through a second index map.
+template<typename T>
+class RedistPlan
+{
+public:
+    RedistPlan(const ElementalMatrix<T>& A, ElementalMatrix<T>& B);
+
+    const RedistPlanKey& Key() const { return key_; }
+
+    void Execute(const ElementalMatrix<T>& A, ElementalMatrix<T>& B);
+
+private:
+    RedistPlanKey key_;
+
+    // The leading dimensions which the local offsets below refer to
+    Int ldimA_, ldimB_;
+
+    // Entries which stay on this process
+    vector<Int> localOffsetsA_, localOffsetsB_;
+
+    // Local offsets into A grouped by destination, and local offsets into B
+    // in the order in which the values are received
+    vector<Int> sendOffsets_, recvOffsets_;
+    vector<int> sendCounts_, sendDispls_, recvCounts_, recvDispls_;
+
+    // Persistent staging buffers
+    vector<T> sendBuf_, recvBuf_;
+
+    static Int Relocate(Int offset, Int oldLDim, Int newLDim)
+    {
+        return (oldLDim == newLDim ? offset :
+                (offset % oldLDim) + (offset / oldLDim)*newLDim);
+    }
+};
+
+template<typename T>
+RedistPlan<T>::RedistPlan(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    if (A.Grid() != B.Grid())
+        LogicError("Redistribution plans require A and B to share a grid");
+
+    B.Resize(A.Height(), A.Width());
+    key_ = MakeRedistPlanKey(A, B);
+    ldimA_ = A.LDim();
+    ldimB_ = B.LDim();
+
+    const Grid& g = A.Grid();
+    if (!g.InGrid())
+        return;
+    mpi::Comm comm = g.VCComm();
+    const int commSize = mpi::Size(comm);
+
+    // Map from ranks in the distribution communicator of B to the VC ranks
+    // of its redundant root
+    const int distBSize = mpi::Size(B.DistComm());
+    vector<int> distBToVC(distBSize);
+    for (int distBRank=0; distBRank<distBSize; ++distBRank)
+        distBToVC[distBRank] =
+          g.CoordsToVC(B.ColDist(), B.RowDist(), distBRank, B.Root(), 0);
+
+    // Determine the owner of each local entry of A in B
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<int> owners;
+    vector<Int> sendOffsets, remoteRows, remoteCols;
+    sendCounts_.assign(commSize, 0);
+    if (A.RedundantRank() == 0)
+    {
+        const bool BPartic = B.Participating();
+        const bool noRedundant = B.RedundantSize() == 1;
+        const int colStride = B.ColStride();
+        const int colRank = B.ColRank();
+        const int rowRank = B.RowRank();
+
+        vector<int> ownerRows(localHeight);
+        vector<Int> localRows(localHeight);
+        for (Int iLoc=0; iLoc<localHeight; ++iLoc)
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ownerRows[iLoc] = B.RowOwner(i);
+            localRows[iLoc] = B.LocalRow(i, ownerRows[iLoc]);
+        }
+
+        for (Int jLoc=0; jLoc<localWidth; ++jLoc)
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = B.ColOwner(j);
+            const Int localCol = B.LocalCol(j, ownerCol);
+            const bool isLocalCol = (BPartic && ownerCol == rowRank);
+            for (Int iLoc=0; iLoc<localHeight; ++iLoc)
+            {
+                const Int offsetA = iLoc + jLoc*ldimA_;
+                const bool isLocalRow = (BPartic && ownerRows[iLoc] == colRank);
+                if (noRedundant && isLocalRow && isLocalCol)
+                {
+                    localOffsetsA_.push_back(offsetA);
+                    localOffsetsB_.push_back(localRows[iLoc]+localCol*ldimB_);
+                }
+                else
+                {
+                    const int owner =
+                      distBToVC[ownerRows[iLoc]+colStride*ownerCol];
+                    owners.push_back(owner);
+                    sendOffsets.push_back(offsetA);
+                    remoteRows.push_back(localRows[iLoc]);
+                    remoteCols.push_back(localCol);
+                    ++sendCounts_[owner];
+                }
+            }
+        }
+    }
+
+    // Group the remote entries by destination
+    const Int totalSend = Scan(sendCounts_, sendDispls_);
+    vector<Int> sendIndices(2*totalSend);
+    sendOffsets_.resize(totalSend);
+    auto offs = sendDispls_;
+    for (Int k=0; k<totalSend; ++k)
+    {
+        const Int pos = offs[owners[k]]++;
+        sendOffsets_[pos] = sendOffsets[k];
+        sendIndices[2*pos  ] = remoteRows[k];
+        sendIndices[2*pos+1] = remoteCols[k];
+    }
+    SwapClear(owners);
+    SwapClear(sendOffsets);
+    SwapClear(remoteRows);
+    SwapClear(remoteCols);
+
+    // Exchange the counts and the target indices once
+    recvCounts_.resize(commSize);
+    mpi::AllToAll(sendCounts_.data(), 1, recvCounts_.data(), 1, comm);
+    const Int totalRecv = Scan(recvCounts_, recvDispls_);
+
+    vector<int> indexSendCounts(commSize), indexSendDispls(commSize),
+                indexRecvCounts(commSize), indexRecvDispls(commSize);
+    for (int q=0; q<commSize; ++q)
+    {
+        indexSendCounts[q] = 2*sendCounts_[q];
+        indexSendDispls[q] = 2*sendDispls_[q];
+        indexRecvCounts[q] = 2*recvCounts_[q];
+        indexRecvDispls[q] = 2*recvDispls_[q];
+    }
+    vector<Int> recvIndices(2*totalRecv);
+    mpi::AllToAll
+    (sendIndices.data(), indexSendCounts.data(), indexSendDispls.data(),
+     recvIndices.data(), indexRecvCounts.data(), indexRecvDispls.data(),
+     comm);
+
+    recvOffsets_.resize(totalRecv);
+    for (Int k=0; k<totalRecv; ++k)
+        recvOffsets_[k] = recvIndices[2*k] + recvIndices[2*k+1]*ldimB_;
+
+    FastResize(sendBuf_, totalSend);
+    FastResize(recvBuf_, totalRecv);
+}
+
+template<typename T>
+void RedistPlan<T>::Execute(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    B.Resize(A.Height(), A.Width());
+    EL_DEBUG_ONLY(
+      const auto key = MakeRedistPlanKey(A, B);
+      if (key < key_ || key_ < key)
+          LogicError("Redistribution plan does not match its arguments");
+    )
+    if (!A.Grid().InGrid())
+        return;
+
+    const Int ldimA = A.LDim();
+    const Int ldimB = B.LDim();
+    const T* ABuf = A.LockedBuffer();
+    T* BBuf = B.Buffer();
+
+    // Copy the entries which stay on this process
+    const Int numLocal = localOffsetsA_.size();
+    EL_PARALLEL_FOR
+    for (Int k=0; k<numLocal; ++k)
+        BBuf[Relocate(localOffsetsB_[k],ldimB_,ldimB)] =
+          ABuf[Relocate(localOffsetsA_[k],ldimA_,ldimA)];
+
+    // Pack, exchange, and unpack the remaining values
+    const Int totalSend = sendOffsets_.size();
+    EL_PARALLEL_FOR
+    for (Int k=0; k<totalSend; ++k)
+        sendBuf_[k] = ABuf[Relocate(sendOffsets_[k],ldimA_,ldimA)];
+
+    mpi::AllToAll
+    (sendBuf_.data(), sendCounts_.data(), sendDispls_.data(),
+     recvBuf_.data(), recvCounts_.data(), recvDispls_.data(),
+     A.Grid().VCComm());
+
+    if (B.Participating() && B.RedundantRank() == 0)
+    {
+        const Int totalRecv = recvOffsets_.size();
+        EL_PARALLEL_FOR
+        for (Int k=0; k<totalRecv; ++k)
+            BBuf[Relocate(recvOffsets_[k],ldimB_,ldimB)] = recvBuf_[k];
+    }
+    if (B.Participating() && B.RedundantSize() > 1)
+        El::Broadcast(B, B.RedundantComm(), 0);
+}
+
+template<typename T>
+std::map<RedistPlanKey,std::unique_ptr<RedistPlan<T>>>& RedistPlanCache()
+{
+    static std::map<RedistPlanKey,std::unique_ptr<RedistPlan<T>>> cache;
+    return cache;
+}
+
+} // namespace copy
+
+// Redistribute A into the current distribution and alignment of B using a
+// cached plan, which is built upon the first call with a given set of
+// dimensions, distributions, alignments, and grid. Since building a plan is
+// a collective operation, the calls must be made consistently by every
+// process in the grid.
+template<typename T>
+void PlannedCopy(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    if (A.Grid() != B.Grid() ||
+        A.GetLocalDevice() != Device::CPU ||
+        B.GetLocalDevice() != Device::CPU)
+    {
+        Copy(A, B);
+        return;
+    }
+
+    B.Resize(A.Height(), A.Width());
+    auto& cache = copy::RedistPlanCache<T>();
+    const auto key = copy::MakeRedistPlanKey(A, B);
+    auto it = cache.find(key);
+    if (it == cache.end())
+    {
+        std::unique_ptr<copy::RedistPlan<T>>
+          plan(new copy::RedistPlan<T>(A, B));
+        it = cache.emplace(key, std::move(plan)).first;
+    }
+    it->second->Execute(A, B);
+}
+
+// Plans hold the address of their grid, so they should be cleared before a
+// grid is destroyed
+template<typename T>
+void ClearRedistPlans()
+{ copy::RedistPlanCache<T>().clear(); }
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTPLAN_HPP
@@ -137,6 +137,7 @@ void RowAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "RowAllGather: For now, A and B must be on same device.");
@@ -166,6 +167,7 @@ template<typename T>
 void RowAllGather(const BlockMatrix<T>& A, BlockMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather");
     AssertSameGrids(A, B);
 
     EL_DEBUG_ONLY(
@@ -120,6 +120,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   ,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllDemote");
     AssertSameGrids(A, B);
     // TODO(poulson): More efficient implementation
     GeneralPurpose(A, B);
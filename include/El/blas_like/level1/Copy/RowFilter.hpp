@@ -85,6 +85,7 @@ void RowFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowFilter");
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError("Interdevice row filter not supported yet.");
 
@@ -108,6 +109,7 @@ void RowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowFilter");
     AssertSameGrids( A, B );
     EL_DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() ||
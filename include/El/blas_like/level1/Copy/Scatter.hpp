@@ -19,6 +19,7 @@ void Scatter
         ElementalMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids(A, B);
 
     const Int m = A.Height();
@@ -95,6 +96,7 @@ void Scatter
         BlockMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids(A, B);
     // TODO(poulson): More efficient implementation
     GeneralPurpose(A, B);
@@ -106,6 +108,7 @@ void Scatter
   DistMatrix<T,STAR,STAR,ELEMENT,D>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids(A, B);
     B.Resize(A.Height(), A.Width());
     if (B.Participating())
@@ -122,6 +125,7 @@ void Scatter
         DistMatrix<T,STAR,STAR,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids(A, B);
     B.Resize(A.Height(), A.Width());
     if (B.Participating())
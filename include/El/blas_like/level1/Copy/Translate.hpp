@@ -130,6 +130,7 @@ void Translate
         DistMatrix<T,U,V,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Translate");
     const Int height = A.Height();
     const Int width = A.Width();
     const Int blockHeight = A.BlockHeight();
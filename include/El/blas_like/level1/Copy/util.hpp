@@ -31,6 +31,18 @@ struct Impl
         LogicError("copy::util::Bad device/type combination.");
     }
 
+    template <typename... Ts>
+    static void ColStridedPack(Ts&&...)
+    {
+        LogicError("copy::util::Bad device/type combination.");
+    }
+
+    template <typename... Ts>
+    static void ColStridedUnpack(Ts&&...)
+    {
+        LogicError("copy::util::Bad device/type combination.");
+    }
+
     template <typename... Ts>
     static void RowStridedPack(Ts&&...)
     {
@@ -62,6 +74,35 @@ struct Impl
     }
 };
 
+// Packing kernels with fewer entries than this run serially, since the cost
+// of starting a parallel region would dominate
+constexpr Int packParallelThreshold = Int(1) << 15;
+
+// The tile dimension used when one of the two matrices is traversed
+// across its rows (e.g., a transposing pack)
+constexpr Int packTileSize = 64;
+
+// The number of entries of a single portion processed per row block of the
+// fused column-strided kernels, chosen so that the corresponding block of
+// the strided matrix stays in cache while every portion is visited
+constexpr Int packRowBlockSize = 1024;
+
+template <typename F>
+void ForEachColumn(Int height, Int width, F body)
+{
+    if (height*width >= packParallelThreshold)
+    {
+        EL_PARALLEL_FOR
+        for (Int j=0; j<width; ++j)
+            body(j);
+    }
+    else
+    {
+        for (Int j=0; j<width; ++j)
+            body(j);
+    }
+}
+
 template <typename T>
 struct Impl<T, Device::CPU, true>
 {
@@ -72,7 +113,15 @@ struct Impl<T, Device::CPU, true>
     {
         if (colStrideA == 1 && colStrideB == 1)
         {
-            lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
+            if (height*width < packParallelThreshold)
+            {
+                lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
+                return;
+            }
+            ForEachColumn(height, width, [&](Int j)
+            {
+                MemCopy(&B[j*rowStrideB], &A[j*rowStrideA], height);
+            });
         }
         else
         {
@@ -82,14 +131,128 @@ struct Impl<T, Device::CPU, true>
                   A, rowStrideA, colStrideA,
                   B, rowStrideB, colStrideB);
 #else
-            for(Int j=0; j<width; ++j)
-                StridedMemCopy
-                    (&B[j*rowStrideB], colStrideB,
-                      &A[j*rowStrideA], colStrideA, height);
+            if (rowStrideA == 1 || rowStrideB == 1)
+            {
+                // One of the matrices is stored by rows, so traversing
+                // either one column at a time would touch a new cache line
+                // per entry of the other; work on square tiles instead
+                const Int numColTiles = (width+packTileSize-1)/packTileSize;
+                ForEachColumn(height, numColTiles, [&](Int jTile)
+                {
+                    const Int jBeg = jTile*packTileSize;
+                    const Int jEnd = Min(jBeg+packTileSize, width);
+                    for (Int iBeg=0; iBeg<height; iBeg+=packTileSize)
+                    {
+                        const Int iEnd = Min(iBeg+packTileSize, height);
+                        for (Int j=jBeg; j<jEnd; ++j)
+                        {
+                            T const* EL_RESTRICT a = &A[j*rowStrideA];
+                            T* EL_RESTRICT b = &B[j*rowStrideB];
+                            EL_SIMD
+                            for (Int i=iBeg; i<iEnd; ++i)
+                                b[i*colStrideB] = a[i*colStrideA];
+                        }
+                    }
+                });
+            }
+            else
+            {
+                // Strided gathers and scatters of whole columns
+                ForEachColumn(height, width, [&](Int j)
+                {
+                    T const* EL_RESTRICT a = &A[j*rowStrideA];
+                    T* EL_RESTRICT b = &B[j*rowStrideB];
+                    EL_SIMD
+                    for (Int i=0; i<height; ++i)
+                        b[i*colStrideB] = a[i*colStrideA];
+                });
+            }
 #endif
         }
     }
 
+    // Rather than making colStride passes over A (one per portion), each
+    // block of rows of a column of A is scattered into every portion while
+    // it is still in cache
+    static void ColStridedPack(Int height, Int width,
+                               Int colAlign, Int colStride,
+                               T const* A, Int ALDim,
+                               T* BPortions, Int portionSize)
+    {
+        if (colStride == 1)
+        {
+            InterleaveMatrix
+                (height, width, A, 1, ALDim, BPortions, 1, height);
+            return;
+        }
+        vector<T*> portions(colStride);
+        vector<Int> localHeights(colStride);
+        for (Int colShift=0; colShift<colStride; ++colShift)
+        {
+            const Int k = Mod(colShift+colAlign, colStride);
+            portions[colShift] = &BPortions[k*portionSize];
+            localHeights[colShift] = Length_(height, colShift, colStride);
+        }
+        ForEachColumn(height, width, [&](Int j)
+        {
+            for (Int iLocBeg=0; iLocBeg<localHeights[0];
+                 iLocBeg+=packRowBlockSize)
+            {
+                for (Int colShift=0; colShift<colStride; ++colShift)
+                {
+                    const Int localHeight = localHeights[colShift];
+                    const Int iLocEnd =
+                        Min(iLocBeg+packRowBlockSize, localHeight);
+                    T const* EL_RESTRICT a = &A[colShift+j*ALDim];
+                    T* EL_RESTRICT b = &portions[colShift][j*localHeight];
+                    EL_SIMD
+                    for (Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc)
+                        b[iLoc] = a[iLoc*colStride];
+                }
+            }
+        });
+    }
+
+    static void ColStridedUnpack(Int height, Int width,
+                                 Int colAlign, Int colStride,
+                                 T const* APortions, Int portionSize,
+                                 T* B, Int BLDim)
+    {
+        if (colStride == 1)
+        {
+            InterleaveMatrix
+                (height, width, APortions, 1, height, B, 1, BLDim);
+            return;
+        }
+        vector<T const*> portions(colStride);
+        vector<Int> localHeights(colStride);
+        for (Int colShift=0; colShift<colStride; ++colShift)
+        {
+            const Int k = Mod(colShift+colAlign, colStride);
+            portions[colShift] = &APortions[k*portionSize];
+            localHeights[colShift] = Length_(height, colShift, colStride);
+        }
+        ForEachColumn(height, width, [&](Int j)
+        {
+            for (Int iLocBeg=0; iLocBeg<localHeights[0];
+                 iLocBeg+=packRowBlockSize)
+            {
+                for (Int colShift=0; colShift<colStride; ++colShift)
+                {
+                    const Int localHeight = localHeights[colShift];
+                    const Int iLocEnd =
+                        Min(iLocBeg+packRowBlockSize, localHeight);
+                    T const* EL_RESTRICT a =
+                        &portions[colShift][j*localHeight];
+                    T* EL_RESTRICT b = &B[colShift+j*BLDim];
+                    EL_SIMD
+                    for (Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc)
+                        b[iLoc*colStride] = a[iLoc];
+                }
+            }
+        });
+    }
+
     static void RowStridedPack(Int height, Int width,
                                Int rowAlign, Int rowStride,
                                T const* A,Int ALDim,
@@ -99,10 +262,10 @@ struct Impl<T, Device::CPU, true>
         {
             const Int rowShift = Shift_(k, rowAlign, rowStride);
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &A[rowShift*ALDim],        rowStride*ALDim,
-                 &BPortions[k*portionSize], height);
+            InterleaveMatrix
+                (height, localWidth,
+                 &A[rowShift*ALDim],        1, rowStride*ALDim,
+                 &BPortions[k*portionSize], 1, height);
         }
     }
 
@@ -116,10 +279,10 @@ struct Impl<T, Device::CPU, true>
         {
             const Int rowShift = Shift_(k, rowAlign, rowStride);
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &APortions[k*portionSize], height,
-                 &B[rowShift*BLDim],        rowStride*BLDim);
+            InterleaveMatrix
+                (height, localWidth,
+                 &APortions[k*portionSize], 1, height,
+                 &B[rowShift*BLDim],        1, rowStride*BLDim);
         }
     }
 
@@ -137,10 +300,10 @@ struct Impl<T, Device::CPU, true>
                 Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
             const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-                 &BPortions[k*portionSize], height);
+            InterleaveMatrix
+                (height, localWidth,
+                 &A[rowOffset*ALDim],       1, rowStrideUnion*ALDim,
+                 &BPortions[k*portionSize], 1, height);
         }
     }
 
@@ -158,10 +321,10 @@ struct Impl<T, Device::CPU, true>
                 Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
             const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &APortions[k*portionSize], height,
-                 &B[rowOffset*BLDim],       rowStrideUnion*BLDim);
+            InterleaveMatrix
+                (height, localWidth,
+                 &APortions[k*portionSize], 1, height,
+                 &B[rowOffset*BLDim],       1, rowStrideUnion*BLDim);
         }
     }
 
@@ -211,6 +374,38 @@ struct Impl<T, Device::GPU, true>
         }
     }
 
+    static void ColStridedPack(Int height, Int width,
+                               Int colAlign, Int colStride,
+                               T const* A, Int ALDim,
+                               T* BPortions, Int portionSize)
+    {
+        for (Int k=0; k<colStride; ++k)
+        {
+            const Int colShift = Shift_(k, colAlign, colStride);
+            const Int localHeight = Length_(height, colShift, colStride);
+            InterleaveMatrix
+                (localHeight, width,
+                 &A[colShift],              colStride, ALDim,
+                 &BPortions[k*portionSize], 1,         localHeight);
+        }
+    }
+
+    static void ColStridedUnpack(Int height, Int width,
+                                 Int colAlign, Int colStride,
+                                 T const* APortions, Int portionSize,
+                                 T* B, Int BLDim)
+    {
+        for (Int k=0; k<colStride; ++k)
+        {
+            const Int colShift = Shift_(k, colAlign, colStride);
+            const Int localHeight = Length_(height, colShift, colStride);
+            InterleaveMatrix
+                (localHeight, width,
+                 &APortions[k*portionSize], 1,         localHeight,
+                 &B[colShift],              colStride, BLDim);
+        }
+    }
+
     static void RowStridedPack(Int height, Int width,
                                Int rowAlign, Int rowStride,
                                T const* A,Int ALDim,
@@ -397,15 +592,8 @@ void ColStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize)
 {
-    for (Int k=0; k<colStride; ++k)
-    {
-        const Int colShift = Shift_(k, colAlign, colStride);
-        const Int localHeight = Length_(height, colShift, colStride);
-        InterleaveMatrix<T,D>
-        (localHeight, width,
-          &A[colShift],              colStride, ALDim,
-          &BPortions[k*portionSize], 1,         localHeight);
-    }
+    details::Impl<T,D>::ColStridedPack(height, width, colAlign, colStride,
+                                       A, ALDim, BPortions, portionSize);
 }
 
 // FIXME: GPU IMPL
@@ -434,15 +622,8 @@ void ColStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim)
 {
-    for (Int k=0; k<colStride; ++k)
-    {
-        const Int colShift = Shift_(k, colAlign, colStride);
-        const Int localHeight = Length_(height, colShift, colStride);
-        InterleaveMatrix<T,D>
-        (localHeight, width,
-          &APortions[k*portionSize], 1,         localHeight,
-          &B[colShift],              colStride, BLDim);
-    }
+    details::Impl<T,D>::ColStridedUnpack(height, width, colAlign, colStride,
+                                         APortions, portionSize, B, BLDim);
 }
 
 template<typename T>
@@ -11,17 +11,34 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseFill( Matrix<T, Device::CPU>& A, function<T(void)> func )
+// The callable is typically a stateful random number generator, so the
+// entries are filled serially in column-major order.
+template<typename T,typename F>
+void EntrywiseFill( Matrix<T, Device::CPU>& A, F func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
-    for( Int j=0; j<n; ++j )
-        for( Int i=0; i<m; ++i )
-            A(i,j) = func();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    if( ALDim == m )
+    {
+        const Int size = m*n;
+        for( Int i=0; i<size; ++i )
+            ABuf[i] = func();
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                ABuf[i+j*ALDim] = func();
+    }
 }
 
+template<typename T>
+void EntrywiseFill( Matrix<T, Device::CPU>& A, function<T(void)> func )
+{ EntrywiseFill<T,function<T(void)>>( A, std::move(func) ); }
+
 // FIXME: Make proper kernel
 #ifdef HYDROGEN_HAVE_CUDA
 template <typename T>
@@ -34,9 +51,16 @@ void EntrywiseFill(Matrix<T,Device::GPU> &A, function<T(void)> func)
 }
 #endif // HYDROGEN_HAVE_CUDA
 
+template<typename T,typename F>
+void EntrywiseFill( AbstractDistMatrix<T>& A, F func )
+{
+    EntrywiseFill
+    ( dynamic_cast<Matrix<T,Device::CPU>&>(A.Matrix()), std::move(func) );
+}
+
 template<typename T>
 void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func )
-{ EntrywiseFill( dynamic_cast<Matrix<T,Device::CPU>&>(A.Matrix()), func ); }
+{ EntrywiseFill<T,function<T(void)>>( A, std::move(func) ); }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
@@ -11,14 +11,15 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+// The kernels below are templated on the type of the callable so that it
+// can be inlined into (and vectorized along with) the inner loops. The
+// std::function overloads are kept as thin wrappers for compatibility.
+
+template<typename T,typename F>
+void EntrywiseMap(Matrix<T,Device::CPU>& A, F func)
 {
     EL_DEBUG_CSE
 
-    if (A.GetDevice() != Device::CPU)
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     T* ABuf = A.Buffer();
@@ -28,8 +29,9 @@ void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
     // iterate over double loop.
     if (ALDim == m)
     {
-        EL_PARALLEL_FOR
-        for(Int i=0; i<m*n; ++i)
+        const Int size = m*n;
+        EL_PARALLEL_FOR_SIMD
+        for(Int i=0; i<size; ++i)
         {
             ABuf[i] = func(ABuf[i]);
         }
@@ -39,28 +41,45 @@ void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
         EL_PARALLEL_FOR
         for(Int j=0; j<n; ++j)
         {
+            T* EL_RESTRICT ACol = &ABuf[j*ALDim];
             EL_SIMD
             for(Int i=0; i<m; ++i)
             {
-                ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
+                ACol[i] = func(ACol[i]);
             }
         }
     }
 }
 
+template<typename T,typename F>
+void EntrywiseMap(AbstractMatrix<T>& A, F func)
+{
+    EL_DEBUG_CSE
+
+    if (A.GetDevice() != Device::CPU)
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+
+    EntrywiseMap(static_cast<Matrix<T,Device::CPU>&>(A), std::move(func));
+}
+
+template<typename T,typename F>
+void EntrywiseMap(AbstractDistMatrix<T>& A, F func)
+{ EntrywiseMap(A.Matrix(), std::move(func)); }
+
+template<typename T>
+void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+{ EntrywiseMap<T,function<T(const T&)>>(A, std::move(func)); }
+
 template<typename T>
 void EntrywiseMap(AbstractDistMatrix<T>& A, function<T(const T&)> func)
-{ EntrywiseMap(A.Matrix(), func); }
+{ EntrywiseMap<T,function<T(const T&)>>(A.Matrix(), std::move(func)); }
 
-template<typename S,typename T>
+template<typename S,typename T,typename F>
 void EntrywiseMap
-(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+(const Matrix<S,Device::CPU>& A, Matrix<T,Device::CPU>& B, F func)
 {
     EL_DEBUG_CSE
 
-    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize(m, n);
@@ -68,23 +87,56 @@ void EntrywiseMap
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
-    EL_PARALLEL_FOR
-    for(Int j=0; j<n; ++j)
+    if (ALDim == m && BLDim == m)
+    {
+        const Int size = m*n;
+        EL_PARALLEL_FOR_SIMD
+        for(Int i=0; i<size; ++i)
+        {
+            BBuf[i] = func(ABuf[i]);
+        }
+    }
+    else
     {
-        EL_SIMD
-        for(Int i=0; i<m; ++i)
+        EL_PARALLEL_FOR
+        for(Int j=0; j<n; ++j)
         {
-            BBuf[i+j*BLDim] = func(ABuf[i+j*ALDim]);
+            const S* EL_RESTRICT ACol = &ABuf[j*ALDim];
+            T* EL_RESTRICT BCol = &BBuf[j*BLDim];
+            EL_SIMD
+            for(Int i=0; i<m; ++i)
+            {
+                BCol[i] = func(ACol[i]);
+            }
         }
     }
 }
 
+template<typename S,typename T,typename F>
+void EntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, F func)
+{
+    EL_DEBUG_CSE
+
+    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+
+    EntrywiseMap
+    (static_cast<const Matrix<S,Device::CPU>&>(A),
+     static_cast<Matrix<T,Device::CPU>&>(B), std::move(func));
+}
+
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+{ EntrywiseMap<S,T,function<T(const S&)>>(A, B, std::move(func)); }
+
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
-          typename=EnableIf<IsDeviceValidType<S,D>>>
+          typename F, typename=EnableIf<IsDeviceValidType<S,D>>>
 void EntrywiseMap_payload(
     AbstractDistMatrix<S> const& A,
     AbstractDistMatrix<T>& B,
-    function<T(const S&)> func)
+    F const& func)
 {
     DistMatrix<S,U,V,W,D> AProx(B.Grid());
     AProx.AlignWith(B.DistData());
@@ -93,20 +145,21 @@ void EntrywiseMap_payload(
 }
 
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
-          typename=DisableIf<IsDeviceValidType<S,D>>, typename=void>
+          typename F, typename=DisableIf<IsDeviceValidType<S,D>>,
+          typename=void>
 void EntrywiseMap_payload(
     AbstractDistMatrix<S> const&,
     AbstractDistMatrix<T>&,
-    function<T(const S&)>)
+    F const&)
 {
     LogicError("EntrywiseMap: Bad device/type combination.");
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename F>
 void EntrywiseMap
 (const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func)
+        F func)
 {
     if (A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
@@ -130,6 +183,13 @@ void EntrywiseMap
     }
 }
 
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        function<T(const S&)> func)
+{ EntrywiseMap<S,T,function<T(const S&)>>(A, B, std::move(func)); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
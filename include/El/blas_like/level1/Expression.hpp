@@ -0,0 +1,448 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_EXPRESSION_HPP
+#define EL_BLAS_EXPRESSION_HPP
+
+namespace El {
+namespace expr {
+
+// Lazy entrywise expressions over CPU matrices.
+//
+// Chaining calls such as Hadamard, Scale, Axpy, and Shift makes one pass
+// over memory (and often one temporary) per call, whereas these kernels are
+// bound by memory bandwidth. Instead, an update such as
+//
+//   Evaluate(alpha*Hadamard(Lazy(A),Lazy(B)) + beta*Lazy(Y), Y);
+//
+// only builds a small tree of references and scalars, which Evaluate then
+// traverses in a single (parallel and vectorized) sweep over the entries.
+// Reductions such as Dot, FrobeniusNorm, and MaxAbs may likewise be applied
+// directly to an expression.
+//
+// Since every operation is entrywise, the target of Evaluate may also
+// appear within the expression. The leaves of an expression only hold
+// references to their matrices, so an expression should not outlive them.
+
+template<typename Derived>
+struct Expression
+{
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+};
+
+template<typename T>
+class Terminal : public Expression<Terminal<T>>
+{
+public:
+    typedef T value_type;
+
+    Terminal(const Matrix<T,Device::CPU>& A)
+    : buffer_(A.LockedBuffer()), height_(A.Height()), width_(A.Width()),
+      ldim_(A.LDim())
+    { }
+
+    Int Height() const { return height_; }
+    Int Width() const { return width_; }
+    bool Contiguous() const { return ldim_ == height_; }
+
+    T operator()(Int i, Int j) const { return buffer_[i+j*ldim_]; }
+    T operator[](Int k) const { return buffer_[k]; }
+
+private:
+    const T* buffer_;
+    Int height_, width_, ldim_;
+};
+
+template<typename E,typename F>
+class Unary : public Expression<Unary<E,F>>
+{
+public:
+    typedef typename E::value_type argument_type;
+    typedef decltype(std::declval<F>()(std::declval<argument_type>()))
+      value_type;
+
+    Unary(const E& arg, F func) : arg_(arg), func_(func) { }
+
+    Int Height() const { return arg_.Height(); }
+    Int Width() const { return arg_.Width(); }
+    bool Contiguous() const { return arg_.Contiguous(); }
+
+    value_type operator()(Int i, Int j) const { return func_(arg_(i,j)); }
+    value_type operator[](Int k) const { return func_(arg_[k]); }
+
+private:
+    E arg_;
+    F func_;
+};
+
+template<typename L,typename R,typename F>
+class Binary : public Expression<Binary<L,R,F>>
+{
+public:
+    typedef decltype
+      (std::declval<F>()
+       (std::declval<typename L::value_type>(),
+        std::declval<typename R::value_type>())) value_type;
+
+    Binary(const L& left, const R& right, F func)
+    : left_(left), right_(right), func_(func)
+    {
+        if (left.Height() != right.Height() || left.Width() != right.Width())
+            LogicError
+            ("Nonconformal expression: ",left.Height()," x ",left.Width(),
+             " and ",right.Height()," x ",right.Width());
+    }
+
+    Int Height() const { return left_.Height(); }
+    Int Width() const { return left_.Width(); }
+    bool Contiguous() const
+    { return left_.Contiguous() && right_.Contiguous(); }
+
+    value_type operator()(Int i, Int j) const
+    { return func_(left_(i,j), right_(i,j)); }
+    value_type operator[](Int k) const
+    { return func_(left_[k], right_[k]); }
+
+private:
+    L left_;
+    R right_;
+    F func_;
+};
+
+// Leaves
+// ======
+template<typename T>
+Terminal<T> Lazy(const Matrix<T,Device::CPU>& A)
+{ return Terminal<T>(A); }
+
+template<typename T>
+Terminal<T> Lazy(const AbstractMatrix<T>& A)
+{
+    if (A.GetDevice() != Device::CPU)
+        LogicError("Lazy expressions are only supported on the CPU");
+    return Terminal<T>(static_cast<const Matrix<T,Device::CPU>&>(A));
+}
+
+// The local portion of a distributed matrix. All of the distributed
+// matrices within an expression should share a distribution and alignment.
+template<typename T>
+Terminal<T> Lazy(const AbstractDistMatrix<T>& A)
+{ return Lazy(A.LockedMatrix()); }
+
+// Entrywise operations
+// ====================
+namespace op {
+
+template<typename T>
+struct Scale
+{
+    T alpha;
+    template<typename S>
+    auto operator()(const S& x) const -> decltype(alpha*x)
+    { return alpha*x; }
+};
+
+template<typename T>
+struct Shift
+{
+    T alpha;
+    template<typename S>
+    auto operator()(const S& x) const -> decltype(x+alpha)
+    { return x+alpha; }
+};
+
+struct Negate
+{
+    template<typename S>
+    S operator()(const S& x) const { return -x; }
+};
+
+struct Conjugate
+{
+    template<typename S>
+    S operator()(const S& x) const { return Conj(x); }
+};
+
+struct AbsValue
+{
+    template<typename S>
+    Base<S> operator()(const S& x) const { return El::Abs(x); }
+};
+
+struct Plus
+{
+    template<typename S,typename T>
+    auto operator()(const S& x, const T& y) const -> decltype(x+y)
+    { return x+y; }
+};
+
+struct Minus
+{
+    template<typename S,typename T>
+    auto operator()(const S& x, const T& y) const -> decltype(x-y)
+    { return x-y; }
+};
+
+struct Times
+{
+    template<typename S,typename T>
+    auto operator()(const S& x, const T& y) const -> decltype(x*y)
+    { return x*y; }
+};
+
+} // namespace op
+
+template<typename L,typename R>
+Binary<L,R,op::Plus>
+operator+(const Expression<L>& left, const Expression<R>& right)
+{ return Binary<L,R,op::Plus>(left.Self(), right.Self(), op::Plus()); }
+
+template<typename L,typename R>
+Binary<L,R,op::Minus>
+operator-(const Expression<L>& left, const Expression<R>& right)
+{ return Binary<L,R,op::Minus>(left.Self(), right.Self(), op::Minus()); }
+
+template<typename E>
+Unary<E,op::Negate> operator-(const Expression<E>& arg)
+{ return Unary<E,op::Negate>(arg.Self(), op::Negate()); }
+
+// The scalars are converted to the value type of the expression
+template<typename E>
+Unary<E,op::Scale<typename E::value_type>>
+operator*(typename E::value_type alpha, const Expression<E>& arg)
+{
+    typedef op::Scale<typename E::value_type> F;
+    return Unary<E,F>(arg.Self(), F{alpha});
+}
+
+template<typename E>
+Unary<E,op::Scale<typename E::value_type>>
+operator*(const Expression<E>& arg, typename E::value_type alpha)
+{ return alpha*arg; }
+
+template<typename E>
+Unary<E,op::Shift<typename E::value_type>>
+operator+(const Expression<E>& arg, typename E::value_type alpha)
+{
+    typedef op::Shift<typename E::value_type> F;
+    return Unary<E,F>(arg.Self(), F{alpha});
+}
+
+template<typename E>
+Unary<E,op::Shift<typename E::value_type>>
+operator+(typename E::value_type alpha, const Expression<E>& arg)
+{ return arg + alpha; }
+
+template<typename E>
+Unary<E,op::Shift<typename E::value_type>>
+operator-(const Expression<E>& arg, typename E::value_type alpha)
+{ return arg + (-alpha); }
+
+template<typename L,typename R>
+Binary<L,R,op::Times>
+Hadamard(const Expression<L>& left, const Expression<R>& right)
+{ return Binary<L,R,op::Times>(left.Self(), right.Self(), op::Times()); }
+
+template<typename E>
+Unary<E,op::Conjugate> Conjugate(const Expression<E>& arg)
+{ return Unary<E,op::Conjugate>(arg.Self(), op::Conjugate()); }
+
+template<typename E>
+Unary<E,op::AbsValue> Abs(const Expression<E>& arg)
+{ return Unary<E,op::AbsValue>(arg.Self(), op::AbsValue()); }
+
+// Apply an arbitrary callable to each entry; as with EntrywiseMap, passing
+// a lambda or functor (rather than a std::function) allows it to be inlined
+template<typename E,typename F>
+Unary<E,F> Map(const Expression<E>& arg, F func)
+{ return Unary<E,F>(arg.Self(), std::move(func)); }
+
+// Evaluation
+// ==========
+template<typename T,typename E>
+void Evaluate(const Expression<E>& exprPre, Matrix<T,Device::CPU>& Y)
+{
+    EL_DEBUG_CSE
+    const E& expr = exprPre.Self();
+    const Int m = expr.Height();
+    const Int n = expr.Width();
+    Y.Resize(m, n);
+    T* YBuf = Y.Buffer();
+    const Int YLDim = Y.LDim();
+    if (YLDim == m && expr.Contiguous())
+    {
+        const Int size = m*n;
+        EL_PARALLEL_FOR_SIMD
+        for (Int k=0; k<size; ++k)
+            YBuf[k] = T(expr[k]);
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for (Int j=0; j<n; ++j)
+        {
+            T* EL_RESTRICT YCol = &YBuf[j*YLDim];
+            EL_SIMD
+            for (Int i=0; i<m; ++i)
+                YCol[i] = T(expr(i,j));
+        }
+    }
+}
+
+template<typename T,typename E>
+void Evaluate(const Expression<E>& expr, AbstractMatrix<T>& Y)
+{
+    if (Y.GetDevice() != Device::CPU)
+        LogicError("Lazy expressions are only supported on the CPU");
+    Evaluate(expr, static_cast<Matrix<T,Device::CPU>&>(Y));
+}
+
+// Overwrite the local portion of Y, which must already be sized and
+// distributed consistently with the matrices within the expression
+template<typename T,typename E>
+void Evaluate(const Expression<E>& expr, AbstractDistMatrix<T>& Y)
+{
+    EL_DEBUG_CSE
+    if (Y.LocalHeight() != expr.Self().Height() ||
+        Y.LocalWidth() != expr.Self().Width())
+        LogicError
+        ("Local portion of Y was ",Y.LocalHeight()," x ",Y.LocalWidth(),
+         " but the expression was ",expr.Self().Height()," x ",
+         expr.Self().Width());
+    Evaluate(expr, Y.Matrix());
+}
+
+// Reductions
+// ==========
+namespace reduce {
+
+// Reduce an expression with a per-thread partial result for each column
+// (or, in the contiguous case, each block of entries) so that the sweep
+// parallelizes without relying upon OpenMP reductions of custom types
+template<typename Acc,typename E,typename Update,typename Combine>
+Acc Reduce
+(const E& expr, Acc init, Update update, Combine combine)
+{
+    const Int m = expr.Height();
+    const Int n = expr.Width();
+    Acc result = init;
+    if (expr.Contiguous())
+    {
+        const Int size = m*n;
+        const Int blockSize = 4096;
+        const Int numBlocks = (size+blockSize-1) / blockSize;
+        vector<Acc> partials(numBlocks, init);
+        EL_PARALLEL_FOR
+        for (Int block=0; block<numBlocks; ++block)
+        {
+            const Int kEnd = Min(size, (block+1)*blockSize);
+            Acc partial = init;
+            for (Int k=block*blockSize; k<kEnd; ++k)
+                update(partial, expr[k]);
+            partials[block] = partial;
+        }
+        for (const Acc& partial : partials)
+            result = combine(result, partial);
+    }
+    else
+    {
+        vector<Acc> partials(n, init);
+        EL_PARALLEL_FOR
+        for (Int j=0; j<n; ++j)
+        {
+            Acc partial = init;
+            for (Int i=0; i<m; ++i)
+                update(partial, expr(i,j));
+            partials[j] = partial;
+        }
+        for (const Acc& partial : partials)
+            result = combine(result, partial);
+    }
+    return result;
+}
+
+} // namespace reduce
+
+template<typename E>
+typename E::value_type Sum(const Expression<E>& expr)
+{
+    EL_DEBUG_CSE
+    typedef typename E::value_type T;
+    return reduce::Reduce
+    (expr.Self(), T(0),
+     [](T& partial, const T& x) { partial += x; },
+     [](const T& a, const T& b) { return a+b; });
+}
+
+// The Hilbert-Schmidt inner product, sum(conj(left) .* right)
+template<typename L,typename R>
+auto Dot(const Expression<L>& left, const Expression<R>& right)
+-> typename Binary<L,R,op::Times>::value_type
+{
+    EL_DEBUG_CSE
+    return Sum(Hadamard(Conjugate(left), right));
+}
+
+// The sum of the squared moduli of the entries
+template<typename E>
+Base<typename E::value_type> SumOfSquares(const Expression<E>& expr)
+{
+    EL_DEBUG_CSE
+    typedef Base<typename E::value_type> Real;
+    return reduce::Reduce
+    (expr.Self(), Real(0),
+     [](Real& partial, const typename E::value_type& x)
+     { const Real alpha = El::Abs(x); partial += alpha*alpha; },
+     [](const Real& a, const Real& b) { return a+b; });
+}
+
+// NOTE: The squares are accumulated without rescaling, so, unlike
+//       El::FrobeniusNorm, this may overflow for entries near the square
+//       root of the largest representable value
+template<typename E>
+Base<typename E::value_type> FrobeniusNorm(const Expression<E>& expr)
+{ return Sqrt(SumOfSquares(expr)); }
+
+template<typename E>
+Base<typename E::value_type> MaxAbs(const Expression<E>& expr)
+{
+    EL_DEBUG_CSE
+    typedef Base<typename E::value_type> Real;
+    return reduce::Reduce
+    (expr.Self(), Real(0),
+     [](Real& partial, const typename E::value_type& x)
+     { partial = Max(partial, El::Abs(x)); },
+     [](const Real& a, const Real& b) { return Max(a,b); });
+}
+
+// Reductions over distributed expressions, which sum (or maximize) the
+// local results over the given communicator (typically the distribution
+// communicator of the participating matrices)
+template<typename E>
+typename E::value_type Sum(const Expression<E>& expr, mpi::Comm comm)
+{ return mpi::AllReduce(Sum(expr), comm); }
+
+template<typename L,typename R>
+auto Dot
+(const Expression<L>& left, const Expression<R>& right, mpi::Comm comm)
+-> typename Binary<L,R,op::Times>::value_type
+{ return mpi::AllReduce(Dot(left, right), comm); }
+
+template<typename E>
+Base<typename E::value_type>
+FrobeniusNorm(const Expression<E>& expr, mpi::Comm comm)
+{ return Sqrt(mpi::AllReduce(SumOfSquares(expr), comm)); }
+
+template<typename E>
+Base<typename E::value_type> MaxAbs(const Expression<E>& expr, mpi::Comm comm)
+{ return mpi::AllReduce(MaxAbs(expr), mpi::MAX, comm); }
+
+} // namespace expr
+} // namespace El
+
+#endif // ifndef EL_BLAS_EXPRESSION_HPP
@@ -76,6 +76,34 @@ void AllReduce( Matrix<T,D>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
 template<typename T>
 void AllReduce( AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
 
+// A handle to a nonblocking AllReduce or Broadcast of the entries of a
+// matrix. The matrix must not be accessed until the handle has been
+// completed with Wait (or a Test which returned true).
+template<typename T>
+struct MatrixRequest
+{
+    mpi::Request<T> request;
+
+    // Contiguous copy of the entries when the leading dimension exceeds
+    // the height, which is unpacked into 'target' upon completion
+    vector<T> buffer;
+    Matrix<T>* target=nullptr;
+
+    bool active=false;
+};
+
+template<typename T>
+MatrixRequest<T>
+IAllReduce( AbstractMatrix<T>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
+template<typename T>
+MatrixRequest<T>
+IAllReduce( AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
+
+template<typename T>
+void Wait( MatrixRequest<T>& request );
+template<typename T>
+bool Test( MatrixRequest<T>& request );
+
 // Axpy
 // ====
 template<typename Ring1,typename Ring2>
@@ -148,6 +176,13 @@ void Broadcast( AbstractMatrix<T>& A, mpi::Comm comm, int rank=0 );
 template<typename T>
 void Broadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank=0 );
 
+// Nonblocking variants which are completed with Wait/Test as for IAllReduce
+template<typename T>
+MatrixRequest<T> IBroadcast( AbstractMatrix<T>& A, mpi::Comm comm, int rank=0 );
+template<typename T>
+MatrixRequest<T>
+IBroadcast( AbstractDistMatrix<T>& A, mpi::Comm comm, int rank=0 );
+
 // Send
 // ====
 template<typename T>
@@ -373,6 +408,18 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+// Redistribute into the current distribution and alignment of B through a
+// cached, precomputed plan (see Copy/RedistPlan.hpp)
+template<typename T>
+void PlannedCopy( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+template<typename T>
+void ClearRedistPlans();
+
+// The number of bytes of staging memory which each process may use per
+// chunk of a general-purpose redistribution (the default is 256 MiB)
+void SetGeneralPurposeMemoryBudget( size_t numBytes );
+size_t GeneralPurposeMemoryBudget();
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
@@ -594,6 +641,13 @@ template<typename T>
 void EntrywiseFill( Matrix<T,Device::GPU>& A, function<T(void)> func );
 #endif // HYDROGEN_HAVE_CUDA
 
+// Versions which inline an arbitrary callable rather than paying for an
+// indirect std::function call per entry
+template<typename T,typename F>
+void EntrywiseFill( Matrix<T>& A, F func );
+template<typename T,typename F>
+void EntrywiseFill( AbstractDistMatrix<T>& A, F func );
+
 // EntrywiseMap
 // ============
 template<typename T>
@@ -609,6 +663,23 @@ void EntrywiseMap
 ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
   function<T(const S&)> func );
 
+// Versions which inline an arbitrary callable rather than paying for an
+// indirect std::function call per entry
+template<typename T,typename F>
+void EntrywiseMap( Matrix<T>& A, F func );
+template<typename T,typename F>
+void EntrywiseMap( AbstractMatrix<T>& A, F func );
+template<typename T,typename F>
+void EntrywiseMap( AbstractDistMatrix<T>& A, F func );
+
+template<typename S,typename T,typename F>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, F func );
+template<typename S,typename T,typename F>
+void EntrywiseMap( const AbstractMatrix<S>& A, AbstractMatrix<T>& B, F func );
+template<typename S,typename T,typename F>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, F func );
+
 // Fill
 // ====
 template<typename T>
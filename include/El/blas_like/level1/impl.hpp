@@ -26,6 +26,7 @@
 #include <El/blas_like/level1/Dot.hpp>
 #include <El/blas_like/level1/EntrywiseFill.hpp>
 #include <El/blas_like/level1/EntrywiseMap.hpp>
+#include <El/blas_like/level1/Expression.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
 #include <El/blas_like/level1/GetDiagonal.hpp>
@@ -86,6 +86,75 @@ void LocalGemv
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& x,
   T beta,        AbstractDistMatrix<T>& y );
 
+// Multi-vector Gemv
+// -----------------
+// Form Y := alpha op(A) X + beta Y for a fixed A and the columns of X,
+// e.g., the right-hand sides of a block iterative solver.
+//
+// X is redistributed once into an [MR,* ] (or [MC,* ]) panel rather than
+// once per vector, and the partial products of each block of blockSize
+// columns are summed with a single reduce-scatter, which is overlapped with
+// the local product of the next block. The [MC,MR] form of A is kept
+// between calls: it is a view when A is already a CPU [MC,MR] matrix and a
+// copy otherwise, in which case Refresh must be called after A changes.
+template<typename T>
+class MultiGemvPlan
+{
+public:
+    MultiGemvPlan( const AbstractDistMatrix<T>& A, Int blockSize=32 );
+
+    void Apply
+    ( Orientation orientation,
+      T alpha, const AbstractDistMatrix<T>& X,
+      T beta,        AbstractDistMatrix<T>& Y ) const;
+
+    void Refresh();
+
+    const DistMatrix<T,MC,MR>& CachedMatrix() const { return A_; }
+
+private:
+    const AbstractDistMatrix<T>* APre_;
+    DistMatrix<T,MC,MR> A_;
+    Int blockSize_;
+};
+
+// A single product through a temporary plan
+template<typename T>
+void MultiGemv
+( Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& X,
+  T beta,        AbstractDistMatrix<T>& Y, Int blockSize=32 );
+
+// Batched Gemv
+// ------------
+// Form y[i] := alpha op(A[i]) x[i] + beta y[i] for a batch of independent
+// products which share their dimensions, leading dimensions, and strides,
+// which are spread over the OpenMP threads
+template<typename T>
+void GemvBatched
+( Orientation orientation, Int m, Int n,
+  T alpha, const T* const* A, Int ALDim,
+           const T* const* x, Int incx,
+  T beta,        T* const* y, Int incy, Int batchSize );
+
+// As above, but with the i'th operands at A+i*strideA, x+i*stridex, and
+// y+i*stridey
+template<typename T>
+void GemvStridedBatched
+( Orientation orientation, Int m, Int n,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* x, Int incx, Int stridex,
+  T beta,        T* y, Int incy, Int stridey, Int batchSize );
+
+// Batches of CPU matrices and column vectors, whose dimensions may vary
+// between the products
+template<typename T>
+void GemvBatched
+( Orientation orientation,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& x,
+  T beta,        vector<Matrix<T>>& y );
+
 // Ger
 // ===
 template<typename T>
@@ -26,11 +26,84 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  // Stationary-C SUMMA which prefetches the next panels of A and B with
+  // nonblocking collectives while the current local update runs
+  GEMM_SUMMA_C_PIPELINED,
+  // 2.5D/3D algorithm which splits the grid into GemmReplicationDepth()
+  // layers, each of which multiplies a slice of the inner dimension
+  GEMM_SUMMA_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of process layers used by GEMM_SUMMA_25D, which must divide the
+// grid size; zero (the default) selects the depth from the grid size
+void SetGemmReplicationDepth( int depth );
+int GemmReplicationDepth();
+
+// Automatic algorithm selection
+// -----------------------------
+// When a distributed Gemm is called with GEMM_DEFAULT, the algorithm and
+// blocksize are taken from the tuning table if it holds an entry for the
+// orientations, the power-of-two buckets of m, n, and k, the grid shape, and
+// the scalar size. Otherwise (unless calibration is enabled, in which case
+// the candidates are timed and the winner recorded) the stationary A, B, and
+// C variants are ranked with an alpha-beta model of their communication plus
+// the local Gemm rate. Disabling model selection restores the fixed
+// shape-ratio heuristics.
+struct GemmChoice
+{
+    GemmAlgorithm alg=GEMM_DEFAULT;
+    // Zero means that the current Blocksize() is kept
+    Int blocksize=0;
+};
+
+struct GemmModel
+{
+    // Seconds per message, seconds per byte, and local flops per second
+    double latency=2.e-6;
+    double inverseBandwidth=2.e-10;
+    double flopRate=1.e10;
+};
+
+void SetGemmModel( const GemmModel& model );
+const GemmModel& GetGemmModel();
+
+// Measure the model parameters over the viewing communicator of the grid
+template<typename T>
+void CalibrateGemmModel( const Grid& grid );
+
+// The model is uncalibrated until CalibrateGemmModel or SetGemmModel is
+// called, so GEMM_DEFAULT keeps the built-in heuristics unless it is enabled
+void SetGemmModelSelection( bool useModel );
+bool GemmModelSelection();
+
+// While enabled, GEMM_DEFAULT calls whose shape is missing from the tuning
+// table are calibrated (which is collective over the grid) before running
+void SetGemmCalibration( bool calibrate );
+bool GemmCalibration();
+
+template<typename T>
+GemmChoice SelectGemmAlgorithm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid );
+
+// Time each candidate (algorithm,blocksize) pair on random matrices of the
+// given shape, record the fastest in the tuning table, and return it
+template<typename T>
+GemmChoice CalibrateGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, Int numReps=1 );
+
+// The table is stored as plain text; the root of comm performs the file
+// access and the entries are broadcast so that every process agrees
+void LoadGemmTuningTable
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+void SaveGemmTuningTable
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+void ClearGemmTuningTable();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -86,6 +159,54 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Batched Gemm
+// ------------
+// Form C[i] := alpha op(A[i]) op(B[i]) + beta C[i] for a batch of
+// independent (and typically small) products whose dimensions and leading
+// dimensions agree, so that the arguments are only checked once. The
+// products are spread over the OpenMP threads, or handed to MKL's
+// gemm_batch when it is available.
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  T alpha, const T* const* A, Int ALDim,
+           const T* const* B, Int BLDim,
+  T beta,        T* const* C, Int CLDim, Int batchSize );
+
+// As above, but with the i'th operands at A+i*strideA, B+i*strideB, and
+// C+i*strideC
+template<typename T>
+void GemmStridedBatched
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* B, Int BLDim, Int strideB,
+  T beta,        T* C, Int CLDim, Int strideC, Int batchSize );
+
+// Batches of CPU matrices, whose dimensions may vary between the products
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C );
+
+// Batches of replicated matrices: each process forms every p'th product
+// and the results are then exchanged over the grid
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<DistMatrix<T,STAR,STAR>>& A,
+           const vector<DistMatrix<T,STAR,STAR>>& B,
+  T beta,        vector<DistMatrix<T,STAR,STAR>>& C );
+
+// Batches of matrices which each reside on a single process: each process
+// forms the products which it owns, without any communication
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<DistMatrix<T,CIRC,CIRC>>& A,
+           const vector<DistMatrix<T,CIRC,CIRC>>& B,
+  T beta,        vector<DistMatrix<T,CIRC,CIRC>>& C );
+
 // Hemm
 // ====
 template<typename T>
@@ -383,12 +504,18 @@ void LocalTrmm
 
 // Trsm
 // ====
+// TRSM_LARGE_LOOKAHEAD is the TRSM_LARGE algorithm for left-sided,
+// non-transposed solves with the redistributions of the next diagonal block
+// overlapped with the trailing update of the current one. It requires
+// nonblocking collectives and CPU matrices, and otherwise falls back to
+// TRSM_LARGE.
 namespace TrsmAlgorithmNS {
 enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  TRSM_LARGE_LOOKAHEAD
 };
 }
 using namespace TrsmAlgorithmNS;
@@ -397,7 +524,20 @@ template<typename F>
 void Trsm
 ( LeftOrRight side, UpperOrLower uplo,
   Orientation orientation, UnitOrNonUnit diag,
-  F alpha, const Matrix<F>& A, Matrix<F>& B,
+  F alpha, const AbstractMatrix<F>& A, AbstractMatrix<F>& B,
+  bool checkIfSingular=false );
+template<typename F, Device D, typename=EnableIf<IsDeviceValidType<F,D>>>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const Matrix<F,D>& A, Matrix<F,D>& B,
+  bool checkIfSingular=false );
+template<typename F, Device D,
+         typename=DisableIf<IsDeviceValidType<F,D>>, typename=void>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const Matrix<F,D>& A, Matrix<F,D>& B,
   bool checkIfSingular=false );
 template<typename F>
 void Trsm
@@ -408,12 +548,12 @@ void Trsm
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
 
-template<typename F>
+template<typename F, Device D>
 void LocalTrsm
 ( LeftOrRight side, UpperOrLower uplo,
   Orientation orientation, UnitOrNonUnit diag,
   F alpha,
-  const DistMatrix<F,STAR,STAR>& A,
+  const DistMatrix<F,STAR,STAR,ELEMENT,D>& A,
         AbstractDistMatrix<F>& X,
   bool checkIfSingular=false );
 
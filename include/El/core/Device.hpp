@@ -47,6 +47,9 @@ constexpr bool IsDeviceValidType_v() { return IsDeviceValidType<T,D>::value; }
 template <Device D1, Device D2>
 using SameDevice = EnumSame<Device,D1,D2>;
 
+// Defined in Memory/decl.hpp
+template <typename G, Device D> class Memory;
+
 // A simple data management class for temporary contiguous memory blocks
 template <typename T, Device D> class simple_buffer;
 
@@ -62,16 +65,17 @@ public:
     }
 
     simple_buffer(size_t size, T const& value)
-        : vec_(size, value)
+        : simple_buffer(size)
     {
-        data_ = vec_.data();
+        std::fill_n(data_, size, value);
     }
 
+    // Draws from the current default CPU memory mode, so that temporaries
+    // are recycled when the caching host allocator is enabled
     void allocate(size_t size)
     {
-        vec_.reserve(size);
+        data_ = mem_.Require(size);
         size_ = size;
-        data_ = vec_.data();
     }
 
     size_t size() const noexcept
@@ -103,7 +107,7 @@ public:
 
 private:
     T* data_ = nullptr;// To be used as VIEW ONLY.
-    std::vector<T> vec_;
+    Memory<T,Device::CPU> mem_;
     size_t size_ = 0;
 };// class simple_buffer<T,Device::CPU>
 
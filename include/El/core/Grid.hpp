@@ -93,6 +93,18 @@ public:
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
 
+    // An identifier which no other grid constructed by this process shares,
+    // even one which is later allocated at the same address
+    std::uint64_t Id() const EL_NO_EXCEPT;
+
+    // The stream of the counter-based random number generator to use for
+    // the next random matrix distributed over this grid. Every viewing
+    // process advances the stream in lockstep, without communicating.
+    std::uint64_t NextRandomStream() const EL_NO_EXCEPT;
+    // Restart the streams of this grid at the given one, e.g., to draw the
+    // same random matrix over another grid
+    void SetRandomStream( std::uint64_t stream ) const EL_NO_EXCEPT;
+
     // To be used internally by Elemental
     static void InitializeDefault();
     static void InitializeTrivial();
@@ -106,6 +118,8 @@ private:
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    std::uint64_t id_;
+    mutable std::atomic<std::uint64_t> randomStream_;
 
     static Grid* defaultGrid;
     static Grid* trivialGrid;
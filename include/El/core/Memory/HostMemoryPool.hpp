@@ -0,0 +1,53 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_MEMORY_HOSTMEMORYPOOL_HPP_
+#define EL_CORE_MEMORY_HOSTMEMORYPOOL_HPP_
+
+namespace El
+{
+
+// A caching allocator for host memory, used by CPU memory mode 2.
+//
+// Requests are rounded up to a power-of-two number of bytes and freed
+// blocks are kept on per-thread free lists (one per size class) so that
+// the short-lived temporaries created by redistributions and SUMMA panels
+// can be recycled without returning to malloc. The total number of bytes
+// held on free lists (across all threads) is bounded by a configurable
+// cap; blocks that would exceed it are returned to the system.
+
+struct HostMemoryPoolStatistics
+{
+    // Requests satisfied from / not satisfied from a free list
+    size_t numHits=0;
+    size_t numMisses=0;
+
+    // Bytes currently handed out and currently held on free lists
+    size_t numBytesInUse=0;
+    size_t numBytesCached=0;
+
+    // The largest value of numBytesInUse+numBytesCached seen so far
+    size_t highWaterBytes=0;
+};
+
+void* HostMemoryPoolAllocate( size_t numBytes );
+void HostMemoryPoolFree( void* ptr, size_t numBytes );
+
+// Return all blocks cached by the calling thread to the system
+void HostMemoryPoolRelease();
+
+void SetHostMemoryPoolMaxCachedBytes( size_t maxCachedBytes );
+size_t HostMemoryPoolMaxCachedBytes();
+
+HostMemoryPoolStatistics GetHostMemoryPoolStatistics();
+void ResetHostMemoryPoolStatistics();
+void PrintHostMemoryPoolStatistics( ostream& os=cout );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_MEMORY_HOSTMEMORYPOOL_HPP_
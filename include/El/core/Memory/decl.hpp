@@ -12,12 +12,33 @@
 namespace El
 {
 
+// Allocation modes understood by Memory<G,Device::CPU>:
+//   0: operator new[]
+//   1: CUDA pinned host memory (only with HYDROGEN_HAVE_CUDA)
+//   2: the caching host allocator (see HostMemoryPool.hpp)
+// and by Memory<G,Device::GPU>:
+//   0: cudaMalloc
+//   1: the CUB caching device allocator (only with HYDROGEN_HAVE_CUB)
+
+// The mode used by newly-constructed Memory objects on device D
+template<Device D>
+unsigned int DefaultMemoryMode();
+template<Device D>
+void SetDefaultMemoryMode(unsigned int mode);
+
+template<> unsigned int DefaultMemoryMode<Device::CPU>();
+template<> void SetDefaultMemoryMode<Device::CPU>(unsigned int mode);
+#ifdef HYDROGEN_HAVE_CUDA
+template<> unsigned int DefaultMemoryMode<Device::GPU>();
+template<> void SetDefaultMemoryMode<Device::GPU>(unsigned int mode);
+#endif // HYDROGEN_HAVE_CUDA
+
 template<typename G, Device D=Device::CPU>
 class Memory
 {
 public:
     Memory();
-    Memory(size_t size, unsigned int mode = 0);
+    Memory(size_t size, unsigned int mode = DefaultMemoryMode<D>());
     ~Memory();
 
     Memory(Memory<G,D>&& mem);
@@ -53,11 +53,19 @@ struct MemHelper<G,Device::CPU>
             }
             break;
 #endif // HYDROGEN_HAVE_CUDA
+        case 2:
+            // The pool hands out raw bytes, so only types which do not
+            // require construction can be drawn from it
+            if (IsPacked<G>::value)
+                ptr = static_cast<G*>(HostMemoryPoolAllocate(size*sizeof(G)));
+            else
+                ptr = new G[size];
+            break;
         default: RuntimeError("Invalid CPU memory allocation mode");
         }
         return ptr;
     }
-    static void Delete( G*& ptr, unsigned int mode )
+    static void Delete( G*& ptr, size_t size, unsigned int mode )
     {
         switch (mode) {
         case 0: delete[] ptr; break;
@@ -74,6 +82,12 @@ struct MemHelper<G,Device::CPU>
             }
             break;
 #endif // HYDROGEN_HAVE_CUDA
+        case 2:
+            if (IsPacked<G>::value)
+                HostMemoryPoolFree(ptr, size*sizeof(G));
+            else
+                delete[] ptr;
+            break;
         default: RuntimeError("Invalid CPU memory deallocation mode");
         }
         ptr = nullptr;
@@ -130,7 +144,7 @@ struct MemHelper<G,Device::GPU>
         return ptr;
     }
 
-    static void Delete( G*& ptr, unsigned int mode )
+    static void Delete( G*& ptr, size_t size, unsigned int mode )
     {
 
         // Deallocate memory
@@ -168,7 +182,8 @@ struct MemHelper<G,Device::GPU>
 
 template<typename G, Device D>
 Memory<G,D>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr), mode_(0)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr),
+  mode_(DefaultMemoryMode<D>())
 { }
 
 template<typename G, Device D>
@@ -249,7 +264,7 @@ void Memory<G,D>::Empty()
 {
     if(rawBuffer_ != nullptr)
     {
-        MemHelper<G,D>::Delete(rawBuffer_, mode_);
+        MemHelper<G,D>::Delete(rawBuffer_, size_, mode_);
     }
     buffer_ = nullptr;
     size_ = 0;
@@ -263,7 +278,7 @@ void Memory<G,D>::SetMode(unsigned int mode)
         G* newRawBuffer = MemHelper<G,D>::New(size_, mode);
         G* newBuffer = newRawBuffer;
         MemCopy(newBuffer, buffer_, size_);
-        MemHelper<G,D>::Delete(rawBuffer_, mode_);
+        MemHelper<G,D>::Delete(rawBuffer_, size_, mode_);
         rawBuffer_ = newRawBuffer;
         buffer_ = newBuffer;
     }
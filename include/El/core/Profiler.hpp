@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILER_HPP
+#define EL_PROFILER_HPP
+
+namespace El {
+
+// Region profiling
+// ================
+// Unlike the call stack maintained by EL_DEBUG_CSE, the profiler is
+// available in release builds and is toggled at runtime. When it is
+// disabled, entering a region costs a single branch.
+//
+// Regions form a tree keyed by the sequence of region names leading to
+// them, and each node accumulates its inclusive time, call count, and the
+// bytes communicated and flops performed directly within it. Only the
+// master thread records regions, so they may not be opened within parallel
+// loops.
+
+namespace profiler {
+extern bool enabled;
+extern bool countingComm;
+} // namespace profiler
+
+// If 'trace' is true, every entry into a region is also recorded as an
+// event of the Chrome trace written by WriteProfileTrace
+void EnableProfiling( bool trace=false );
+void DisableProfiling();
+inline bool ProfilingEnabled() EL_NO_EXCEPT { return profiler::enabled; }
+
+// Discard all of the recorded regions and events
+void ResetProfile();
+
+// The region names must outlive the profile, e.g., be string literals
+void PushProfileRegion( const char* name );
+void PopProfileRegion();
+
+// Attribute work to the innermost open region
+void ProfileBytes( double numBytes );
+void ProfileFlops( double numFlops );
+
+// The name of the innermost open region, or nullptr if there is none
+const char* CurrentProfileRegion();
+
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name )
+    : active_(ProfilingEnabled())
+    {
+        if( active_ )
+            PushProfileRegion( name );
+    }
+    ~ProfileRegion()
+    {
+        if( active_ )
+            PopProfileRegion();
+    }
+    ProfileRegion( const ProfileRegion& ) = delete;
+    const ProfileRegion& operator=( const ProfileRegion& ) = delete;
+private:
+    bool active_;
+};
+
+// Prints the region tree of this process, with the inclusive and exclusive
+// times, call counts, bytes and flops of each region
+void PrintProfile( ostream& os=cout );
+
+// Collectively prints, from the root of the communicator, the minimum,
+// average and maximum over its processes of the times, bytes and flops of
+// each region. Regions which a process never entered contribute zeros.
+void PrintReducedProfile( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+
+// Collectively writes the traced events of every process in the
+// communicator to a single Chrome trace (chrome://tracing) JSON file, with
+// one trace process per rank
+void WriteProfileTrace
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Communication counters
+// ======================
+// When enabled, each call through the mpi:: wrappers records its number of
+// calls, the bytes of its buffers which this process sends and receives,
+// and the time spent within it, both for its communicator and for its call
+// site. The volumes are those of the arguments rather than the wire traffic
+// of the underlying MPI implementation, so that they may be compared
+// against the cost model of each algorithm. For Wait and WaitAll, which are
+// recorded under a null communicator, the time is that spent waiting.
+//
+// A call site is the wrapper together with the innermost open profiler
+// region, so sites are only distinguished while profiling is enabled.
+// Communicators are identified by their size and first two members in
+// COMM_WORLD so that the counts of the processes may be compared.
+
+struct CommCounts
+{
+    Int numCalls=0;
+    double bytesSent=0, bytesReceived=0, time=0;
+
+    CommCounts& operator+=( const CommCounts& counts );
+};
+
+// If 'dumpAtFinalize' is true, Finalize collectively prints the counters
+// over COMM_WORLD
+void EnableCommCounters( bool dumpAtFinalize=true );
+void DisableCommCounters();
+inline bool CommCountersEnabled() EL_NO_EXCEPT
+{ return profiler::countingComm; }
+void ResetCommCounters();
+
+// The counts of this process for the given communicator
+CommCounts GetCommCounts( mpi::Comm comm );
+// The counts of this process keyed by communicator and by call site
+std::map<string,CommCounts> CommCountsByComm();
+std::map<string,CommCounts> CommCountsBySite();
+
+// Collectively prints, from the root of the communicator, the minimum,
+// average and maximum over its processes of the counts of each
+// communicator and call site
+void PrintCommCounters( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+
+// Used by the mpi:: wrappers
+void RecordCommCall
+( const char* name, const char* site, mpi::Comm comm,
+  double bytesSent, double bytesReceived, double time );
+// Moves the counts of a communicator which is about to be freed out from
+// under its handle, which MPI may hand out again
+void RetireCommCounters( mpi::Comm comm );
+
+// Called by Finalize
+void FinalizeCommCounters();
+
+} // namespace El
+
+#define EL_PROFILE_CONCAT_IMPL(a,b) a ## b
+#define EL_PROFILE_CONCAT(a,b) EL_PROFILE_CONCAT_IMPL(a,b)
+
+// Profiles the rest of the enclosing scope as the given region
+#define EL_PROFILE_REGION(name) \
+  El::ProfileRegion EL_PROFILE_CONCAT(elProfileRegion,__LINE__)(name)
+
+#endif // ifndef EL_PROFILER_HPP
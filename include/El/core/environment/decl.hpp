@@ -93,6 +93,22 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// Frees the process grids and communicators which GEMM_SUMMA_25D and
+// GEMM_CANNON cache between calls
+void FreeGemmCaches();
+
+// Pushes a blocksize for the lifetime of the guard, so that the stack is
+// restored even if an exception is thrown
+class BlocksizeGuard
+{
+public:
+    explicit BlocksizeGuard( Int blocksize )
+    { PushBlocksizeStack( blocksize ); }
+    ~BlocksizeGuard() { PopBlocksizeStack(); }
+    BlocksizeGuard( const BlocksizeGuard& ) = delete;
+    BlocksizeGuard& operator=( const BlocksizeGuard& ) = delete;
+};
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -133,6 +133,14 @@ namespace cublas
         ScalarType const& beta,                                         \
         ScalarType* C, BlasInt CLDim);
 
+#define ADD_TRSM_DECL(ScalarType)                                       \
+    void Trsm(                                                          \
+        char side, char uplo, char trans, char diag,                    \
+        BlasInt m, BlasInt n,                                           \
+        ScalarType const& alpha,                                        \
+        ScalarType const* A, BlasInt ALDim,                             \
+        ScalarType* B, BlasInt BLDim);
+
 //
 // BLAS-like Extension Routines
 //
@@ -158,6 +166,8 @@ ADD_GEMV_DECL(double)
 // BLAS 3
 ADD_GEMM_DECL(float)
 ADD_GEMM_DECL(double)
+ADD_TRSM_DECL(float)
+ADD_TRSM_DECL(double)
 
 // BLAS-like Extension
 ADD_GEAM_DECL(float)
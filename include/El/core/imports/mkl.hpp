@@ -180,6 +180,45 @@ void Trrk
         dcomplex beta,
         dcomplex* C, BlasInt CLDim );
 
+// Batched Gemm over groups of products which share their dimensions, where
+// the i'th group consists of the next groupSizes[i] entries of A, B, and C
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const float* alpha,
+  const float** A, const BlasInt* ALDim,
+  const float** B, const BlasInt* BLDim,
+  const float* beta,
+        float** C, const BlasInt* CLDim,
+  BlasInt groupCount, const BlasInt* groupSizes );
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const double* alpha,
+  const double** A, const BlasInt* ALDim,
+  const double** B, const BlasInt* BLDim,
+  const double* beta,
+        double** C, const BlasInt* CLDim,
+  BlasInt groupCount, const BlasInt* groupSizes );
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const scomplex* alpha,
+  const scomplex** A, const BlasInt* ALDim,
+  const scomplex** B, const BlasInt* BLDim,
+  const scomplex* beta,
+        scomplex** C, const BlasInt* CLDim,
+  BlasInt groupCount, const BlasInt* groupSizes );
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const dcomplex* alpha,
+  const dcomplex** A, const BlasInt* ALDim,
+  const dcomplex** B, const BlasInt* BLDim,
+  const dcomplex* beta,
+        dcomplex** C, const BlasInt* CLDim,
+  BlasInt groupCount, const BlasInt* groupSizes );
+
 } // namespace mkl
 } // namespace El
 #endif // ifdef HYDROGEN_HAVE_MKL
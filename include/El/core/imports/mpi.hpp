@@ -22,6 +22,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -95,6 +96,15 @@ struct Request
     bool receivingPacked=false;
     int recvCount;
     T* unpackedRecvBuf;
+
+    // Rescaled counts and displacements which must outlive a nonblocking
+    // variable-length collective
+    vector<int> counts;
+
+    // The communicator and message size of a persistent request, which are
+    // counted each time that it is started
+    MPI_Comm persistentComm=MPI_COMM_NULL;
+    double persistentBytesSent=0, persistentBytesReceived=0;
 };
 
 // Standard constants
@@ -531,6 +541,53 @@ EL_NO_RELEASE_EXCEPT;
 template<typename T>
 T IRecv( int from, Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 
+// Persistent send and recv
+// ------------------------
+// The requests are initialized once, repeatedly activated with Start or
+// StartAll and completed with Wait or WaitAll, and finally released with
+// Free. Since the buffers are bound at initialization, only packed datatypes
+// are supported.
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void SendInit
+( const Real* buf, int count, int to, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void SendInit
+( const Complex<Real>* buf, int count, int to, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void SendInit
+( const T* buf, int count, int to, Comm comm,
+  Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void RecvInit
+( Real* buf, int count, int from, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void RecvInit
+( Complex<Real>* buf, int count, int from, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void RecvInit
+( T* buf, int count, int from, Comm comm,
+  Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
 // SendRecv
 // --------
 template<typename Real,
@@ -728,6 +785,30 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// The send buffer may be reused, and the receive buffer read, only after the
+// request has been completed with Wait/WaitAll
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,
@@ -841,6 +922,52 @@ vector<T> AllToAll
   const vector<int>& sendDispls,
   Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllToAll
+// ---------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
+// Non-blocking AllToAll with non-uniform send/recv sizes
+// ------------------------------------------------------
+// NOTE: The count and displacement arrays must remain valid until the
+//       request has completed
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request );
+
 // Reduce
 // ------
 template<typename Real,
@@ -1022,6 +1149,54 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllReduce
+// ----------------------
+// NOTE: Only the built-in reduction operations are supported, as the
+//       user-defined ones are held in global state which could change
+//       before the request completes
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request );
+
+// Single-buffer non-blocking AllReduce
+// ------------------------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -1090,6 +1265,30 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void ReduceScatter( T* buf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking ReduceScatter
+// --------------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Variable-length ReduceScatter
 // -----------------------------
 template<typename Real,
@@ -1231,6 +1430,46 @@ void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Derived datatypes
+// -----------------
+// The new datatypes are committed and must be released with Free
+void CreateContiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateVector
+( int count, int blockLength, int stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+// The stride is in bytes rather than in units of the old datatype
+void CreateHVector
+( int count, int blockLength, Aint stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+
+// Parallel file I/O
+// -----------------
+// Unlike the communication routines, failures are reported with a
+// RuntimeError in every build, since they usually stem from the filesystem
+// rather than from a programming error
+typedef MPI_File File;
+typedef MPI_Offset Offset;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_CREATE = MPI_MODE_CREATE;
+
+void FileOpen
+( Comm comm, const std::string& filename, int mode, File& file );
+void FileClose( File& file );
+Offset FileGetSize( File file );
+void FileSetSize( File file, Offset size );
+// Restricts the subsequent collective reads and writes to the portions of
+// the file selected by tiling 'fileType' starting 'disp' bytes in
+void FileSetView
+( File file, Offset disp, Datatype entryType, Datatype fileType );
+void FileReadAtAll
+( File file, Offset offset, void* buf, int count, Datatype type );
+void FileWriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type );
+void FileReadAll( File file, void* buf, int count, Datatype type );
+void FileWriteAll( File file, const void* buf, int count, Datatype type );
+
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
@@ -19,13 +19,16 @@
 # endif
 # ifdef EL_HAVE_OMP_SIMD
 #  define EL_SIMD _Pragma("omp simd")
+#  define EL_PARALLEL_FOR_SIMD _Pragma("omp parallel for simd")
 # else
 #  define EL_SIMD
+#  define EL_PARALLEL_FOR_SIMD EL_PARALLEL_FOR
 # endif
 #else
 # define EL_PARALLEL_FOR 
 # define EL_PARALLEL_FOR_COLLAPSE2
 # define EL_SIMD
+# define EL_PARALLEL_FOR_SIMD
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
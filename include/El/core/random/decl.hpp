@@ -13,6 +13,39 @@ namespace El {
 
 std::mt19937& Generator();
 
+// Counter-based random numbers
+// ----------------------------
+// The Philox4x32-10 generator of Salmon et al., "Parallel random numbers: as
+// easy as 1, 2, 3", maps a 128-bit counter and a 64-bit key to 128 random
+// bits. Random matrices are generated by keying on CounterSeed() and
+// forming the counter from a stream and the global indices of each entry,
+// so that every process and thread can draw its own entries independently
+// and the result does not depend on the distribution or thread count.
+std::array<std::uint32_t,4>
+Philox4x32
+( std::array<std::uint32_t,4> counter, std::array<std::uint32_t,2> key )
+EL_NO_EXCEPT;
+
+// The 128 random bits for entry (i,j) of the given stream
+std::array<std::uint32_t,4>
+CounterBits( std::uint64_t seed, std::uint64_t stream, Int i, Int j )
+EL_NO_EXCEPT;
+
+// The key shared by all processes, which must be set collectively
+std::uint64_t CounterSeed();
+void SetCounterSeed( std::uint64_t seed );
+
+// The stream to use for the next random matrix which is local to this
+// process. These are disjoint from the streams of the other processes and
+// from those of distributed matrices.
+std::uint64_t NextLocalRandomStream();
+
+// The first of a block of 2^28 streams for the random matrices distributed
+// over a new grid with the given viewing communicator. This is collective
+// over the communicator, and grids built on overlapping processes receive
+// disjoint blocks.
+std::uint64_t FirstDistRandomStream( mpi::Comm comm );
+
 template<typename Real>
 Real Choose( Int n, Int k );
 template<typename Real>
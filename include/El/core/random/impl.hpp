@@ -11,6 +11,47 @@
 
 namespace El {
 
+inline std::array<std::uint32_t,4>
+Philox4x32
+( std::array<std::uint32_t,4> counter, std::array<std::uint32_t,2> key )
+EL_NO_EXCEPT
+{
+    const std::uint64_t multiplier0 = 0xD2511F53;
+    const std::uint64_t multiplier1 = 0xCD9E8D57;
+    const std::uint32_t weyl0 = 0x9E3779B9;
+    const std::uint32_t weyl1 = 0xBB67AE85;
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t product0 = multiplier0*counter[0];
+        const std::uint64_t product1 = multiplier1*counter[2];
+        counter =
+        { std::uint32_t(product1>>32) ^ counter[1] ^ key[0],
+          std::uint32_t(product1),
+          std::uint32_t(product0>>32) ^ counter[3] ^ key[1],
+          std::uint32_t(product0) };
+        key[0] += weyl0;
+        key[1] += weyl1;
+    }
+    return counter;
+}
+
+inline std::array<std::uint32_t,4>
+CounterBits( std::uint64_t seed, std::uint64_t stream, Int i, Int j )
+EL_NO_EXCEPT
+{
+    // Indices beyond 2^32 are folded into the high word of the stream
+    const std::uint64_t iWide = std::uint64_t(i);
+    const std::uint64_t jWide = std::uint64_t(j);
+    const std::uint32_t highBits =
+      std::uint32_t(stream>>32) ^
+      (std::uint32_t(iWide>>32)*0x9E3779B9u) ^
+      (std::uint32_t(jWide>>32)*0x85EBCA6Bu);
+    return Philox4x32
+    ( { std::uint32_t(iWide), std::uint32_t(jWide),
+        std::uint32_t(stream), highBits },
+      { std::uint32_t(seed), std::uint32_t(seed>>32) } );
+}
+
 template<typename Real>
 Real Choose( Int n, Int k )
 {
@@ -75,6 +75,57 @@ void Read
 ( AbstractDistMatrix<T>& A,
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Memory-mapped BinaryFlat files
+// ==============================
+// Attaches a matrix directly onto a BinaryFlat file which has been mapped
+// into memory, so that no copy is made and the processes on a node share
+// the pages of the file rather than each holding a private copy. The
+// matrix may only be used while the mapping is alive.
+struct MappedFileCtrl
+{
+    // Map the file with write access such that any modifications of the
+    // matrix are carried through to the file, which is created or resized
+    // as needed. Otherwise the file must already hold the whole matrix.
+    bool writable=false;
+
+    // Fault in every page of the file when it is mapped (Linux only)
+    bool populate=false;
+
+    // Hint that the matrix will be swept through in order, or that it will
+    // be needed soon and should be read ahead
+    bool sequential=false;
+    bool willNeed=false;
+};
+
+template<typename T>
+class MappedBinaryFlat
+{
+    static_assert
+    (IsPacked<T>::value,
+     "Only types stored contiguously by value can be memory-mapped");
+public:
+    MappedBinaryFlat
+    ( const string& filename, Int height, Int width,
+      const MappedFileCtrl& ctrl=MappedFileCtrl() );
+    ~MappedBinaryFlat();
+
+    MappedBinaryFlat( const MappedBinaryFlat<T>& ) = delete;
+    const MappedBinaryFlat<T>& operator=( const MappedBinaryFlat<T>& ) = delete;
+
+    const El::Matrix<T>& LockedMatrix() const EL_NO_EXCEPT;
+    // Only writable mappings may be modified
+    El::Matrix<T>& Matrix();
+
+    // Write any modifications of a writable mapping back to the file
+    void Flush();
+
+private:
+    void* data_=nullptr;
+    std::size_t numBytes_=0;
+    bool writable_;
+    El::Matrix<T> A_;
+};
+
 // Spy
 // ===
 template<typename T>
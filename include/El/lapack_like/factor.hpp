@@ -268,20 +268,39 @@ struct RegSolveCtrl
 // LU
 // ==
 
-// NOTE: This is not yet made use of, but the fully-pivoted version of LU
-//       should (soon?) accept it as an argument and potentially return one or
-//       more of the permutation matrices as the identity
+// NOTE: The fully-pivoted version of LU should (soon?) accept this as an
+//       argument and potentially return one or more of the permutation
+//       matrices as the identity
 namespace LUPivotTypeNS {
 enum LUPivotType
 {
     LU_PARTIAL,
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    // Choose the pivot rows of each panel with a reduction tree of local
+    // partially-pivoted factorizations (as in CALU), which requires
+    // O(log p) rather than O(nb) messages per panel
+    LU_TOURNAMENT
 };
 }
 using namespace LUPivotTypeNS;
 
+struct LUCtrl
+{
+    LUPivotType pivotType=LU_PARTIAL;
+
+    // Measure the element growth of the factorization
+    bool growth=false;
+};
+
+template<typename Real>
+struct LUInfo
+{
+    // max_{i,j} |U(i,j)| / max_{i,j} |A(i,j)|, if it was requested
+    Real growthFactor=Real(0);
+};
+
 // LU without pivoting
 // -------------------
 template<typename Field>
@@ -298,6 +317,17 @@ void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
 
+// LU with the row pivoting strategy chosen by the control structure
+// -----------------------------------------------------------------
+// Tournament pivoting only differs from partial pivoting in the distributed
+// case, as a sequential panel requires no communication
+template<typename Field>
+LUInfo<Base<Field>>
+LU( Matrix<Field>& A, Permutation& P, const LUCtrl& ctrl );
+template<typename Field>
+LUInfo<Base<Field>>
+LU( AbstractDistMatrix<Field>& A, DistPermutation& P, const LUCtrl& ctrl );
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -558,10 +588,32 @@ void SolveAfter
 
 // Cholesky-based QR
 // -----------------
+struct CholeskyQRCtrl
+{
+    // Each pass forms the Gram matrix with one Herk and a single AllReduce of
+    // its upper triangle before a local Cholesky factorization. Two passes
+    // (CholeskyQR2) yield an orthonormal Q for condition numbers up to
+    // roughly eps^{-1/2}.
+    Int numPasses=2;
+
+    // Shift the Gram matrix of the first pass so that its Cholesky
+    // factorization cannot break down; together with two further passes
+    // (shifted CholeskyQR3), this extends the range to roughly eps^{-1}
+    bool shift=false;
+};
+
 template<typename Field>
 void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
 template<typename Field>
 void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+template<typename Field>
+void Cholesky
+( Matrix<Field>& A, Matrix<Field>& R, const CholeskyQRCtrl& ctrl );
+template<typename Field>
+void Cholesky
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  const CholeskyQRCtrl& ctrl );
 
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
@@ -636,14 +688,23 @@ void DisjointNeighborColSwaps
         Matrix<Field>& R,
   const Matrix<Int>& colSwaps );
 
+// The reduction trees for tall-skinny QR
+enum TSTreeType
+{
+  TS_BUTTERFLY, // Pairwise exchanges, after which every process holds R
+  TS_FLAT       // A gather of every local factor to the root
+};
+
 template<typename Field>
 struct TreeData
 {
+    TSTreeType tree=TS_BUTTERFLY;
     Matrix<Field> QR0, householderScalars0;
     Matrix<Base<Field>> signature0;
     vector<Matrix<Field>> QRList;
     vector<Matrix<Field>> householderScalarsList;
     vector<Matrix<Base<Field>>> signatureList;
+    Matrix<Field> R;
 
     TreeData( Int numStages=0 )
     : QRList(numStages),
@@ -652,36 +713,53 @@ struct TreeData
     { }
 
     TreeData( TreeData<Field>&& treeData )
-    : QR0(move(treeData.QR0)),
+    : tree(treeData.tree),
+      QR0(move(treeData.QR0)),
       householderScalars0(move(treeData.householderScalars0)),
       signature0(move(treeData.signature0)),
       QRList(move(treeData.QRList)),
       householderScalarsList(move(treeData.householderScalarsList)),
-      signatureList(move(treeData.signatureList))
+      signatureList(move(treeData.signatureList)),
+      R(move(treeData.R))
     { }
 
     TreeData<Field>& operator=( TreeData<Field>&& treeData )
     {
+        tree = treeData.tree;
         QR0 = move(treeData.QR0);
         householderScalars0 = move(treeData.householderScalars0);
         signature0 = move(treeData.signature0);
         QRList = move(treeData.QRList);
         householderScalarsList = move(treeData.householderScalarsList);
         signatureList = move(treeData.signatureList);
+        R = move(treeData.R);
         return *this;
     }
 };
 
 // Return an implicit tall-skinny QR factorization
 template<typename Field>
-TreeData<Field> TS( const AbstractDistMatrix<Field>& A );
+TreeData<Field>
+TS( const AbstractDistMatrix<Field>& A, TSTreeType tree=TS_BUTTERFLY );
 
 // Return an explicit tall-skinny QR factorization
 template<typename Field>
-void ExplicitTS( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void ExplicitTS
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  TSTreeType tree=TS_BUTTERFLY );
 
 namespace ts {
 
+// X := Q B or X := Q^H B for the thin Q of TS( A ), without forming Q
+template<typename Field>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const TreeData<Field>& treeData,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X );
+
 template<typename Field>
 Matrix<Field>& RootQR
 ( const AbstractDistMatrix<Field>& A, TreeData<Field>& treeData );
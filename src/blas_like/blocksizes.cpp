@@ -30,6 +30,10 @@ struct LocalTrr2kBlocksizeHelper { static Int value; };
 template<typename T>
 Int LocalTrr2kBlocksizeHelper<T>::value = 64;
 
+size_t generalPurposeMemoryBudget = size_t(256) << 20;
+
+int gemmReplicationDepth = 0;
+
 }
 
 namespace El {
@@ -70,6 +74,26 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+void SetGeneralPurposeMemoryBudget( size_t numBytes )
+{
+    if( numBytes == 0 )
+        LogicError("The general-purpose memory budget must be positive");
+    ::generalPurposeMemoryBudget = numBytes;
+}
+
+size_t GeneralPurposeMemoryBudget()
+{ return ::generalPurposeMemoryBudget; }
+
+void SetGemmReplicationDepth( int depth )
+{
+    if( depth < 0 )
+        LogicError("The Gemm replication depth must be non-negative");
+    ::gemmReplicationDepth = depth;
+}
+
+int GemmReplicationDepth()
+{ return ::gemmReplicationDepth; }
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
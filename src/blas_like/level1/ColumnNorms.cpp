@@ -18,25 +18,10 @@ void ColumnTwoNormsHelper
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    const Int mLocal = ALoc.Height();
-    const Int nLocal = ALoc.Width();
-
-    // TODO(poulson): Ensure that NaN's propagate
-    Matrix<Real> localScales( nLocal, 1 ),
-                 localScaledSquares( nLocal, 1 );
-    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-    {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
-    }
-
-    NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
+    Matrix<Real> work( ALoc.Width(), 2 );
+    scaled_squares::ColumnScaledSquares
+    ( ALoc, work.Buffer(), work.Buffer()+work.LDim() );
+    NormsFromScaledSquares( work, normsLoc, comm );
 }
 
 template<typename Real>
@@ -49,30 +34,39 @@ void ColumnTwoNormsHelper
     const Int mLocal = ARealLoc.Height();
     const Int nLocal = ARealLoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
-    Matrix<Real> localScales( nLocal, 1 ), localScaledSquares( nLocal, 1 );
+    Matrix<Real> work( nLocal, 2 );
+    Real* localScales = work.Buffer();
+    Real* localScaledSquares = work.Buffer() + work.LDim();
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ARealLoc(iLoc,jLoc), localScale, localScaledSquare );
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( AImagLoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
+        Real realScale, realScaledSquare, imagScale, imagScaledSquare;
+        scaled_squares::VectorScaledSquare
+        ( mLocal, ARealLoc.LockedBuffer(0,jLoc), realScale, realScaledSquare );
+        scaled_squares::VectorScaledSquare
+        ( mLocal, AImagLoc.LockedBuffer(0,jLoc), imagScale, imagScaledSquare );
+
+        // Equilibrate the two sums to the larger scale
+        const Real scale = scaled_squares::MaxOrNaN( realScale, imagScale );
+        Real scaledSquare = 1;
+        if( scale != Real(0) && scale <= limits::Max<Real>() )
+        {
+            const Real realRelScale = realScale/scale;
+            const Real imagRelScale = imagScale/scale;
+            scaledSquare = realScaledSquare*realRelScale*realRelScale +
+                           imagScaledSquare*imagRelScale*imagRelScale;
+        }
+        localScales[jLoc] = scale;
+        localScaledSquares[jLoc] = scaledSquare;
     }
 
-    NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
+    NormsFromScaledSquares( work, normsLoc, comm );
 }
 
 template<typename Field>
 void ColumnTwoNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
 {
     EL_DEBUG_CSE
+    typedef Base<Field> Real;
     const Int m = X.Height();
     const Int n = X.Width();
     norms.Resize( n, 1 );
@@ -81,25 +75,30 @@ void ColumnTwoNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    Matrix<Real> scaledSquares( n, 1 );
+    scaled_squares::ColumnScaledSquares
+    ( X, norms.Buffer(), scaledSquares.Buffer() );
     for( Int j=0; j<n; ++j )
-        norms(j) = blas::Nrm2( m, &X(0,j), 1 );
+        norms(j) *= Sqrt(scaledSquares(j));
 }
 
 template<typename Field>
 void ColumnMaxNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int m = X.Height();
     const Int n = X.Width();
     norms.Resize( n, 1 );
-    for( Int j=0; j<n; ++j )
+    if( IsBlasScalar<Field>::value )
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+            norms(j) = scaled_squares::MaxModulus( m, X.LockedBuffer(0,j) );
+    }
+    else
     {
-        // TODO(poulson): Ensure that NaN's propagate
-        Real colMax = 0;
-        for( Int i=0; i<m; ++i )
-            colMax = Max(colMax,Abs(X(i,j)));
-        norms(j) = colMax;
+        for( Int j=0; j<n; ++j )
+            norms(j) = scaled_squares::MaxModulus( m, X.LockedBuffer(0,j) );
     }
 }
 
@@ -126,7 +125,7 @@ void ColumnMaxNorms
     norms.AlignWith( A );
     norms.Resize( A.Width(), 1 );
     ColumnMaxNorms( A.LockedMatrix(), norms.Matrix() );
-    AllReduce( norms.Matrix(), A.ColComm(), mpi::MAX );
+    scaled_squares::AllReduceMaxNorms( norms.Matrix(), A.ColComm() );
 }
 
 // Versions which operate on explicitly-separated complex matrices
@@ -11,42 +11,370 @@
 
 namespace El {
 
+namespace scaled_squares {
+
+// Rather than rescaling a running sum whenever a larger entry appears, as
+// UpdateScaledSquare does, the norms are formed in two branch-free passes:
+// the first finds the largest magnitude of the real and imaginary
+// components, and the second sums the squares of the components divided by
+// it. The component maximum can underestimate a complex modulus by at most
+// a factor of sqrt(2), so no scaled square can overflow. A NaN component
+// makes the maximum, and hence the norm, NaN, even alongside an infinity.
+//
+// The reductions carry 'numLanes' independent partial results so that they
+// map onto vector registers without requiring reassociation.
+const Int numLanes = 8;
+
+template<typename Real>
+Real ScaledSquare( const Real& alpha, const Real& invScale )
+{
+    const Real alphaScaled = alpha*invScale;
+    return alphaScaled*alphaScaled;
+}
+
+template<typename Real>
+Real ScaledSquare( const Complex<Real>& alpha, const Real& invScale )
+{
+    const Real realScaled = RealPart(alpha)*invScale;
+    const Real imagScaled = ImagPart(alpha)*invScale;
+    return realScaled*realScaled + imagScaled*imagScaled;
+}
+
+// The larger of two moduli, or NaN if either is. Unlike Max, which drops a
+// NaN in its second argument, this propagates NaN's regardless of their
+// position, and it still compiles to a branch-free select.
+template<typename Real>
+Real MaxOrNaN( const Real& alpha, const Real& beta )
+{ return ( alpha > beta || alpha != alpha ) ? alpha : beta; }
+
+// The larger magnitude of the components of an entry, which, unlike
+// El::MaxAbs, is NaN whenever either component is
+template<typename Real>
+Real ComponentMaxAbs( const Real& alpha )
+{ return Abs(alpha); }
+
+template<typename Real>
+Real ComponentMaxAbs( const Complex<Real>& alpha )
+{ return MaxOrNaN( Abs(RealPart(alpha)), Abs(ImagPart(alpha)) ); }
+
+template<typename Field>
+Base<Field> ComponentMax( Int n, const Field* EL_RESTRICT x )
+{
+    typedef Base<Field> Real;
+    Real lanes[numLanes];
+    for( Int k=0; k<numLanes; ++k )
+        lanes[k] = 0;
+    const Int nMain = n - n % numLanes;
+    for( Int i=0; i<nMain; i+=numLanes )
+        for( Int k=0; k<numLanes; ++k )
+            lanes[k] = MaxOrNaN( ComponentMaxAbs(x[i+k]), lanes[k] );
+
+    Real result = 0;
+    for( Int k=0; k<numLanes; ++k )
+        result = MaxOrNaN( lanes[k], result );
+    for( Int i=nMain; i<n; ++i )
+        result = MaxOrNaN( ComponentMaxAbs(x[i]), result );
+    return result;
+}
+
+template<typename Field>
+Base<Field> SumOfScaledSquares
+( Int n, const Field* EL_RESTRICT x, const Base<Field>& invScale )
+{
+    typedef Base<Field> Real;
+    Real lanes[numLanes];
+    for( Int k=0; k<numLanes; ++k )
+        lanes[k] = 0;
+    const Int nMain = n - n % numLanes;
+    for( Int i=0; i<nMain; i+=numLanes )
+        for( Int k=0; k<numLanes; ++k )
+            lanes[k] += ScaledSquare( x[i+k], invScale );
+
+    Real result = 0;
+    for( Int k=0; k<numLanes; ++k )
+        result += lanes[k];
+    for( Int i=nMain; i<n; ++i )
+        result += ScaledSquare( x[i], invScale );
+    return result;
+}
+
+// The largest modulus of a contiguous vector, which is NaN if any entry is
+template<typename Field>
+Base<Field> MaxModulus( Int n, const Field* EL_RESTRICT x )
+{
+    typedef Base<Field> Real;
+    Real lanes[numLanes];
+    for( Int k=0; k<numLanes; ++k )
+        lanes[k] = 0;
+    const Int nMain = n - n % numLanes;
+    for( Int i=0; i<nMain; i+=numLanes )
+        for( Int k=0; k<numLanes; ++k )
+            lanes[k] = MaxOrNaN( Real(Abs(x[i+k])), lanes[k] );
+
+    Real result = 0;
+    for( Int k=0; k<numLanes; ++k )
+        result = MaxOrNaN( lanes[k], result );
+    for( Int i=nMain; i<n; ++i )
+        result = MaxOrNaN( Real(Abs(x[i])), result );
+    return result;
+}
+
+// Maximizes the local maximum norms over the given communicator. MPI leaves
+// the maximum of a NaN unspecified, so, if any process has a NaN norm, the
+// NaN's are restored afterwards from a sum of the norms, which, since they
+// are nonnegative, is NaN exactly when one of its terms is.
+template<typename Real>
+void AllReduceMaxNorms( Matrix<Real>& norms, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = norms.Height();
+    Int numNaN = 0;
+    for( Int j=0; j<n; ++j )
+        if( norms(j) != norms(j) )
+            ++numNaN;
+    numNaN = mpi::AllReduce( numNaN, comm );
+    if( numNaN == 0 )
+    {
+        AllReduce( norms, comm, mpi::MAX );
+        return;
+    }
+    Matrix<Real> sums( norms );
+    AllReduce( sums, comm, mpi::SUM );
+    AllReduce( norms, comm, mpi::MAX );
+    for( Int j=0; j<n; ++j )
+        if( sums(j) != sums(j) )
+            norms(j) = sums(j);
+}
+
+// Returns the inverse of the scale when it can be formed without overflow,
+// and otherwise zero, in which case the entries must be divided by the
+// scale instead
+template<typename Real>
+Real SafeInverse( const Real& scale )
+{
+    return ( scale >= Real(1)/limits::Max<Real>() ? Real(1)/scale : Real(0) );
+}
+
+// Fixes up the results for a vector whose scale was zero or infinite, in
+// which case the scaled sum was formed with an inverse scale of one or
+// zero. A zero scale means that every entry was zero, since a NaN would
+// have made the scale NaN.
+template<typename Real>
+void FixSpecialScale( Real& scale, Real& scaledSquare )
+{
+    if( scale == Real(0) || scale > limits::Max<Real>() )
+        scaledSquare = 1;
+}
+
+// The scale and scaled square of a contiguous vector, i.e., its two-norm is
+// scale*sqrt(scaledSquare)
+template<typename Field>
+void VectorScaledSquare
+( Int n, const Field* x, Base<Field>& scale, Base<Field>& scaledSquare )
+{
+    typedef Base<Field> Real;
+    scale = ComponentMax( n, x );
+    if( scale == Real(0) || scale > limits::Max<Real>() || scale != scale )
+    {
+        scaledSquare = 1;
+        return;
+    }
+    const Real invScale = SafeInverse( scale );
+    if( invScale != Real(0) )
+    {
+        scaledSquare = SumOfScaledSquares( n, x, invScale );
+    }
+    else
+    {
+        // A subnormal scale is rare enough to fall back to the incremental
+        // update
+        scale = 0;
+        scaledSquare = 1;
+        for( Int i=0; i<n; ++i )
+            UpdateScaledSquare( x[i], scale, scaledSquare );
+    }
+}
+
+// The scales and scaled squares of each column of A
+template<typename Field>
+void ColumnScaledSquares
+( const Matrix<Field>& A, Base<Field>* scales, Base<Field>* scaledSquares )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    if( IsBlasScalar<Field>::value )
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+            VectorScaledSquare
+            ( m, &ABuf[j*ALDim], scales[j], scaledSquares[j] );
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+            VectorScaledSquare
+            ( m, &ABuf[j*ALDim], scales[j], scaledSquares[j] );
+    }
+}
+
+// The scales and scaled squares of each row of A. The columns are swept in
+// order so that the accumulation vectorizes over contiguous rows, and the
+// rows are split into blocks over the threads.
+template<typename Field>
+void RowScaledSquares
+( const Matrix<Field>& A, Base<Field>* scales, Base<Field>* scaledSquares )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    auto rowBlock = [&]( Int iBeg, Int iEnd )
+    {
+        Real* EL_RESTRICT blockScales = &scales[iBeg];
+        Real* EL_RESTRICT blockSquares = &scaledSquares[iBeg];
+        const Int mBlock = iEnd - iBeg;
+        for( Int i=0; i<mBlock; ++i )
+        {
+            blockScales[i] = 0;
+            blockSquares[i] = 0;
+        }
+        for( Int j=0; j<n; ++j )
+        {
+            const Field* EL_RESTRICT ACol = &ABuf[iBeg+j*ALDim];
+            for( Int i=0; i<mBlock; ++i )
+                blockScales[i] =
+                  MaxOrNaN( ComponentMaxAbs(ACol[i]), blockScales[i] );
+        }
+
+        // Temporarily store the inverse scales in place of the squares
+        bool divide = false;
+        for( Int i=0; i<mBlock; ++i )
+        {
+            const Real scale = blockScales[i];
+            if( scale == Real(0) )
+                blockSquares[i] = 1;
+            else if( scale > limits::Max<Real>() || scale != scale )
+                blockSquares[i] = 0;
+            else
+            {
+                blockSquares[i] = SafeInverse( scale );
+                divide = divide || blockSquares[i] == Real(0);
+            }
+        }
+        if( divide )
+        {
+            // A subnormal scale is rare enough to not be worth vectorizing
+            for( Int i=0; i<mBlock; ++i )
+            {
+                Real scale = 0;
+                Real scaledSquare = 1;
+                for( Int j=0; j<n; ++j )
+                    UpdateScaledSquare
+                    ( ABuf[iBeg+i+j*ALDim], scale, scaledSquare );
+                blockScales[i] = scale;
+                blockSquares[i] = scaledSquare;
+            }
+            return;
+        }
+
+        vector<Real> invScales( blockSquares, blockSquares+mBlock );
+        for( Int i=0; i<mBlock; ++i )
+            blockSquares[i] = 0;
+        for( Int j=0; j<n; ++j )
+        {
+            const Field* EL_RESTRICT ACol = &ABuf[iBeg+j*ALDim];
+            for( Int i=0; i<mBlock; ++i )
+                blockSquares[i] += ScaledSquare( ACol[i], invScales[i] );
+        }
+        for( Int i=0; i<mBlock; ++i )
+            FixSpecialScale( blockScales[i], blockSquares[i] );
+    };
+
+    const Int blockHeight = 512;
+    const Int numBlocks = (m+blockHeight-1) / blockHeight;
+    if( IsBlasScalar<Field>::value )
+    {
+        EL_PARALLEL_FOR
+        for( Int block=0; block<numBlocks; ++block )
+            rowBlock( block*blockHeight, Min((block+1)*blockHeight,m) );
+    }
+    else
+    {
+        for( Int block=0; block<numBlocks; ++block )
+            rowBlock( block*blockHeight, Min((block+1)*blockHeight,m) );
+    }
+}
+
+} // namespace scaled_squares
+
+// Combines the local scales (stored in the first column of 'work') and
+// scaled squares (stored in the second) over the communicator into norms.
+// The contents of 'work' are overwritten.
 template<typename Real>
 void NormsFromScaledSquares
-( const Matrix<Real>& localScales,
-        Matrix<Real>& localScaledSquares,
-        Matrix<Real>& normsLoc,
-        mpi::Comm comm )
+( Matrix<Real>& work, Matrix<Real>& normsLoc, mpi::Comm comm )
 {
     EL_DEBUG_CSE
-    const Int nLocal = localScales.Height();
+    const Int nLocal = work.Height();
+    Real* localScales = work.Buffer();
+    Real* scaledSquares = work.Buffer() + work.LDim();
+    Real* norms = normsLoc.Buffer();
 
-    // Find the maximum relative scales
-    Matrix<Real> scales( nLocal, 1 );
-    mpi::AllReduce
-    ( localScales.LockedBuffer(), scales.Buffer(), nLocal, mpi::MAX, comm );
+    if( mpi::Size(comm) == 1 )
+    {
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+            norms[jLoc] = localScales[jLoc]*Sqrt(scaledSquares[jLoc]);
+        return;
+    }
+
+    // MPI leaves the maximum of a NaN unspecified, so a NaN scale is left
+    // out of the maximization and is instead carried by the scaled square,
+    // which the sum below propagates
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        if( localScales[jLoc] != localScales[jLoc] )
+        {
+            scaledSquares[jLoc] = localScales[jLoc];
+            localScales[jLoc] = 0;
+        }
+    }
+
+    // Find the maximum relative scales, which are held in the norms until
+    // the scaled sums have been combined
+    mpi::AllReduce( localScales, norms, nLocal, mpi::MAX, comm );
 
     // Equilibrate the local scaled sums
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
-        const Real scale = scales(jLoc);
-        if( scale != Real(0) )
+        const Real scale = norms[jLoc];
+        if( scaledSquares[jLoc] != scaledSquares[jLoc] )
+            continue;
+        if( scale > limits::Max<Real>() )
+        {
+            // Only the infinite scales contribute, so that the norm is
+            // infinite rather than the NaN of inf/inf
+            scaledSquares[jLoc] = ( localScales[jLoc] == scale ? 1 : 0 );
+        }
+        else if( scale != Real(0) )
         {
             // Equilibrate our local scaled sum to the maximum scale
-            Real relScale = localScales(jLoc)/scale;
-            localScaledSquares(jLoc) *= relScale*relScale;
+            Real relScale = localScales[jLoc]/scale;
+            scaledSquares[jLoc] *= relScale*relScale;
         }
         else
-            localScaledSquares(jLoc) = 0;
+            scaledSquares[jLoc] = 0;
     }
 
     // Combine the local contributions
-    Matrix<Real> scaledSquares( nLocal, 1 );
-    mpi::AllReduce
-    ( localScaledSquares.Buffer(),
-      scaledSquares.Buffer(), nLocal, mpi::SUM, comm );
+    mpi::AllReduce( scaledSquares, nLocal, mpi::SUM, comm );
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-        normsLoc(jLoc) = scales(jLoc)*Sqrt(scaledSquares(jLoc));
+        norms[jLoc] *= Sqrt(scaledSquares[jLoc]);
 }
 
 } // namespace El
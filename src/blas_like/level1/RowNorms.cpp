@@ -18,30 +18,17 @@ void RowTwoNormsHelper
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    const Int mLocal = ALoc.Height();
-    const Int nLocal = ALoc.Width();
-
-    // TODO(poulson): Ensure that NaN's propagate
-    Matrix<Real> localScales(mLocal,1 ), localScaledSquares(mLocal,1);
-    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-    {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(iLoc) = localScale;
-        localScaledSquares(iLoc) = localScaledSquare;
-    }
-
-    NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
+    Matrix<Real> work( ALoc.Height(), 2 );
+    scaled_squares::RowScaledSquares
+    ( ALoc, work.Buffer(), work.Buffer()+work.LDim() );
+    NormsFromScaledSquares( work, normsLoc, comm );
 }
 
 template<typename Field>
 void RowTwoNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
 {
     EL_DEBUG_CSE
+    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     norms.Resize( m, 1 );
@@ -50,8 +37,11 @@ void RowTwoNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    Matrix<Real> scaledSquares( m, 1 );
+    scaled_squares::RowScaledSquares
+    ( A, norms.Buffer(), scaledSquares.Buffer() );
     for( Int i=0; i<m; ++i )
-        norms(i) = blas::Nrm2( n, &A(i,0), A.LDim() );
+        norms(i) *= Sqrt(scaledSquares(i));
 }
 
 template<typename Field>
@@ -62,12 +52,39 @@ void RowMaxNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
     const Int m = A.Height();
     const Int n = A.Width();
     norms.Resize( m, 1 );
-    for( Int i=0; i<m; ++i )
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    Real* normsBuf = norms.Buffer();
+
+    // Sweep the columns in order over blocks of rows so that the updates
+    // vectorize over contiguous entries
+    auto rowBlock = [&]( Int iBeg, Int iEnd )
     {
-        Real rowMax = 0;
+        Real* EL_RESTRICT blockNorms = &normsBuf[iBeg];
+        const Int mBlock = iEnd - iBeg;
+        for( Int i=0; i<mBlock; ++i )
+            blockNorms[i] = 0;
         for( Int j=0; j<n; ++j )
-            rowMax = Max(rowMax,Abs(A(i,j)));
-        norms(i) = rowMax;
+        {
+            const Field* EL_RESTRICT ACol = &ABuf[iBeg+j*ALDim];
+            for( Int i=0; i<mBlock; ++i )
+                blockNorms[i] =
+                  scaled_squares::MaxOrNaN( Real(Abs(ACol[i])), blockNorms[i] );
+        }
+    };
+
+    const Int blockHeight = 512;
+    const Int numBlocks = (m+blockHeight-1) / blockHeight;
+    if( IsBlasScalar<Field>::value )
+    {
+        EL_PARALLEL_FOR
+        for( Int block=0; block<numBlocks; ++block )
+            rowBlock( block*blockHeight, Min((block+1)*blockHeight,m) );
+    }
+    else
+    {
+        for( Int block=0; block<numBlocks; ++block )
+            rowBlock( block*blockHeight, Min((block+1)*blockHeight,m) );
     }
 }
 
@@ -94,7 +111,7 @@ void RowMaxNorms
     norms.AlignWith( A );
     norms.Resize( A.Height(), 1 );
     RowMaxNorms( A.LockedMatrix(), norms.Matrix() );
-    AllReduce( norms, A.RowComm(), mpi::MAX );
+    scaled_squares::AllReduceMaxNorms( norms.Matrix(), A.RowComm() );
 }
 
 
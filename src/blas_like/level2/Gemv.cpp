@@ -8,9 +8,11 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
+#include <El/blas_like/level3.hpp>
 
 #include "./Gemv/Normal.hpp"
 #include "./Gemv/Transpose.hpp"
+#include "./Gemv/MultiVector.hpp"
 
 namespace El {
 
@@ -206,6 +208,55 @@ void LocalGemv
       beta,                    y.Matrix() );
 }
 
+template<typename T>
+MultiGemvPlan<T>::MultiGemvPlan( const AbstractDistMatrix<T>& A, Int blockSize )
+: APre_(&A), A_(A.Grid()), blockSize_(blockSize)
+{
+    EL_DEBUG_CSE
+    if( blockSize < 1 )
+        LogicError("Invalid multi-vector Gemv blocksize: ",blockSize);
+    Refresh();
+}
+
+template<typename T>
+void MultiGemvPlan<T>::Refresh()
+{
+    EL_DEBUG_CSE
+    const auto& A = *APre_;
+    if( A.ColDist() == MC && A.RowDist() == MR && A.Wrap() == ELEMENT &&
+        A.GetLocalDevice() == Device::CPU )
+    {
+        LockedView( A_, static_cast<const DistMatrix<T,MC,MR>&>(A) );
+    }
+    else
+    {
+        A_.Empty();
+        Copy( A, A_ );
+    }
+}
+
+template<typename T>
+void MultiGemvPlan<T>::Apply
+( Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& X,
+  T beta,        AbstractDistMatrix<T>& Y ) const
+{
+    EL_DEBUG_CSE
+    gemv::MultiVector( orientation, alpha, A_, X, beta, Y, blockSize_ );
+}
+
+template<typename T>
+void MultiGemv
+( Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& X,
+  T beta,        AbstractDistMatrix<T>& Y, Int blockSize )
+{
+    EL_DEBUG_CSE
+    MultiGemvPlan<T> plan( A, blockSize );
+    plan.Apply( orientation, alpha, X, beta, Y );
+}
+
 namespace gemv {
 
 template<typename T,typename=EnableIf<IsBlasScalar<T>>>
@@ -363,7 +414,13 @@ template void Gemv(Orientation orientA,
   ( Orientation orientation, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& x, \
-    T beta,        AbstractDistMatrix<T>& y );
+    T beta,        AbstractDistMatrix<T>& y ); \
+  template class MultiGemvPlan<T>; \
+  template void MultiGemv \
+  ( Orientation orientation, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const AbstractDistMatrix<T>& X, \
+    T beta,        AbstractDistMatrix<T>& Y, Int blockSize );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemv {
+
+// Y[V,U] := alpha op(A) X[U,* ] + beta Y[V,U], where the local products
+// op(A) X1 are formed into a [V,* ] panel for each block of columns X1 and
+// then reduce-scattered over the U communicator into Y1.
+//
+// The reduce-scatter of block i is left in flight while the local product
+// of block i+1 is formed. Y is constrained to share its column alignment
+// with the panels so that no realignment is needed after the reduction.
+template<typename T,Dist U,Dist V>
+void MultiVector_impl
+( Orientation orientation,
+  T alpha, const DistMatrix<T,MC,MR>& A,
+           const AbstractDistMatrix<T>& XPre,
+  T beta,        AbstractDistMatrix<T>& YPre, Int blockSize )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const Grid& g = A.Grid();
+
+    ElementalProxyCtrl ctrlX, ctrlY;
+    ctrlX.colConstrain = true;
+    ctrlX.colAlign = ( normal ? A.RowAlign() : A.ColAlign() );
+    ctrlY.colConstrain = true;
+    ctrlY.colAlign = ( normal ? A.ColAlign() : A.RowAlign() );
+
+    DistMatrixReadProxy<T,T,U,STAR> XProx( XPre, ctrlX );
+    DistMatrixReadWriteProxy<T,T,V,U> YProx( YPre, ctrlY );
+    auto& X = XProx.GetLocked();
+    auto& Y = YProx.Get();
+
+    Y *= beta;
+    if( !g.InGrid() )
+        return;
+
+    const Int height = Y.Height();
+    const Int numVecs = Y.Width();
+    const Int localHeight = Y.LocalHeight();
+    const Int rowStride = Y.RowStride();
+    mpi::Comm rowComm = Y.RowComm();
+
+    // Every block is packed into portions sized for the widest one. The
+    // buffers are zeroed once so that the padding never holds garbage.
+    const Int portionSize =
+      mpi::Pad( localHeight*MaxLength(blockSize,rowStride) );
+    simple_buffer<T,Device::CPU> sendBuf[2], recvBuf[2];
+    for( Int buf=0; buf<2; ++buf )
+    {
+        sendBuf[buf].allocate( rowStride*portionSize );
+        recvBuf[buf].allocate( portionSize );
+        MemZero( sendBuf[buf].data(), rowStride*portionSize );
+    }
+    mpi::Request<T> request[2];
+
+    auto finishBlock = [&]( Int j, Int buf )
+    {
+        const Int nb = Min(blockSize,numVecs-j);
+        auto Y1 = Y( ALL, IR(j,j+nb) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        mpi::Wait( request[buf] );
+#endif
+        axpy::util::InterleaveMatrixUpdate<T,Device::CPU>
+        ( T(1), localHeight, Y1.LocalWidth(),
+          recvBuf[buf].data(), 1, localHeight,
+          Y1.Buffer(),         1, Y1.LDim() );
+    };
+
+    DistMatrix<T,V,STAR> Z1(g);
+    Z1.AlignWith( A );
+    for( Int j=0, buf=0; j<numVecs; j+=blockSize, buf=1-buf )
+    {
+        const Int nb = Min(blockSize,numVecs-j);
+        auto X1 = X( ALL, IR(j,j+nb) );
+        auto Y1 = Y( ALL, IR(j,j+nb) );
+
+        // Z1[V,* ] := alpha op(A) X1[U,* ]
+        Z1.Resize( height, nb );
+        Zero( Z1 );
+        LocalGemm( orientation, NORMAL, alpha, A, X1, T(0), Z1 );
+
+        copy::util::RowStridedPack<T,Device::CPU>
+        ( localHeight, nb,
+          Y1.RowAlign(), rowStride,
+          Z1.LockedBuffer(), Z1.LDim(),
+          sendBuf[buf].data(), portionSize );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        mpi::IReduceScatter
+        ( sendBuf[buf].data(), recvBuf[buf].data(), portionSize,
+          rowComm, request[buf] );
+        if( j > 0 )
+            finishBlock( j-blockSize, 1-buf );
+#else
+        mpi::ReduceScatter
+        ( sendBuf[buf].data(), recvBuf[buf].data(), portionSize, rowComm );
+        finishBlock( j, buf );
+#endif
+    }
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( numVecs > 0 )
+    {
+        const Int numBlocks = (numVecs+blockSize-1) / blockSize;
+        finishBlock( (numBlocks-1)*blockSize, (numBlocks-1)%2 );
+    }
+#endif
+}
+
+template<typename T>
+void MultiVector
+( Orientation orientation,
+  T alpha, const DistMatrix<T,MC,MR>& A,
+           const AbstractDistMatrix<T>& X,
+  T beta,        AbstractDistMatrix<T>& Y, Int blockSize )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, X, Y );
+    const Int AHeight = ( orientation == NORMAL ? A.Height() : A.Width() );
+    const Int AWidth = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( AWidth != X.Height() || AHeight != Y.Height() ||
+        X.Width() != Y.Width() )
+        LogicError
+        ("Nonconformal: \n",DimsString(A,"A"),"\n",
+         DimsString(X,"X"),"\n",DimsString(Y,"Y"));
+    if( blockSize < 1 )
+        LogicError("Invalid multi-vector Gemv blocksize: ",blockSize);
+
+    if( orientation == NORMAL )
+        MultiVector_impl<T,MR,MC>
+        ( orientation, alpha, A, X, beta, Y, blockSize );
+    else
+        MultiVector_impl<T,MC,MR>
+        ( orientation, alpha, A, X, beta, Y, blockSize );
+}
+
+} // namespace gemv
+} // namespace El
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level2.hpp>
+
+namespace El {
+
+namespace {
+
+template<typename T>
+void GemvProduct
+(char trans, Int m, Int n,
+  T alpha, const T* A, Int ALDim, const T* x, Int incx,
+  T beta,        T* y, Int incy)
+{
+    const Int xDim = (trans == 'N' ? n : m);
+    const Int yDim = (trans == 'N' ? m : n);
+    if (xDim != 0)
+    {
+        if (yDim != 0)
+            blas::Gemv
+            (trans, m, n, alpha, A, ALDim, x, incx, beta, y, incy);
+    }
+    else
+    {
+        for (Int i=0; i<yDim; ++i)
+            y[i*incy] = (beta == T(0) ? T(0) : beta*y[i*incy]);
+    }
+}
+
+} // namespace <anon>
+
+template<typename T>
+void GemvBatched
+(Orientation orientation, Int m, Int n,
+  T alpha, const T* const* A, Int ALDim,
+           const T* const* x, Int incx,
+  T beta,        T* const* y, Int incy, Int batchSize)
+{
+    EL_DEBUG_CSE
+    if (m < 0 || n < 0)
+        LogicError("Invalid batched Gemv dimensions: ",m," x ",n);
+    if (ALDim < Max(m,Int(1)) || incx == 0 || incy == 0)
+        LogicError
+        ("Invalid batched Gemv strides: ",ALDim,", ",incx,", ",incy);
+    const char trans = OrientationToChar(orientation);
+
+    // As in GemmBatched, only the native BLAS types are spread over the
+    // threads
+    if (IsBlasScalar<T>::value)
+    {
+        EL_PARALLEL_FOR
+        for (Int i=0; i<batchSize; ++i)
+            GemvProduct
+            (trans, m, n, alpha, A[i], ALDim, x[i], incx, beta, y[i], incy);
+    }
+    else
+    {
+        for (Int i=0; i<batchSize; ++i)
+            GemvProduct
+            (trans, m, n, alpha, A[i], ALDim, x[i], incx, beta, y[i], incy);
+    }
+}
+
+template<typename T>
+void GemvStridedBatched
+(Orientation orientation, Int m, Int n,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* x, Int incx, Int stridex,
+  T beta,        T* y, Int incy, Int stridey, Int batchSize)
+{
+    EL_DEBUG_CSE
+    vector<const T*> ABufs(batchSize), xBufs(batchSize);
+    vector<T*> yBufs(batchSize);
+    for (Int i=0; i<batchSize; ++i)
+    {
+        ABufs[i] = &A[i*strideA];
+        xBufs[i] = &x[i*stridex];
+        yBufs[i] = &y[i*stridey];
+    }
+    GemvBatched
+    (orientation, m, n,
+     alpha, ABufs.data(), ALDim, xBufs.data(), incx,
+     beta, yBufs.data(), incy, batchSize);
+}
+
+template<typename T>
+void GemvBatched
+(Orientation orientation,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& x,
+  T beta,        vector<Matrix<T>>& y)
+{
+    EL_DEBUG_CSE
+    const Int batchSize = y.size();
+    if (Int(A.size()) != batchSize || Int(x.size()) != batchSize)
+        LogicError
+        ("Batches of ",A.size(),", ",x.size(),", and ",y.size(),
+         " matrices are incompatible");
+    const char trans = OrientationToChar(orientation);
+    for (Int i=0; i<batchSize; ++i)
+    {
+        if ((x[i].Height() != 1 && x[i].Width() != 1) ||
+            (y[i].Height() != 1 && y[i].Width() != 1))
+            LogicError
+            ("Nonconformal product ",i," in batched Gemv:\n",
+             DimsString(x[i],"x"),"\n",DimsString(y[i],"y"));
+        const Int xLength = (x[i].Width()==1 ? x[i].Height() : x[i].Width());
+        const Int yLength = (y[i].Width()==1 ? y[i].Height() : y[i].Width());
+        const Int AHeight = (trans == 'N' ? A[i].Height() : A[i].Width());
+        const Int AWidth = (trans == 'N' ? A[i].Width() : A[i].Height());
+        if (AHeight != yLength || AWidth != xLength)
+            LogicError
+            ("Nonconformal product ",i," in batched Gemv:\n",
+             DimsString(A[i],"A"),"\n",DimsString(x[i],"x"),"\n",
+             DimsString(y[i],"y"));
+    }
+
+    auto product = [&](Int i)
+    {
+        const Int incx = (x[i].Width()==1 ? 1 : x[i].LDim());
+        const Int incy = (y[i].Width()==1 ? 1 : y[i].LDim());
+        GemvProduct
+        (trans, A[i].Height(), A[i].Width(),
+         alpha, A[i].LockedBuffer(), A[i].LDim(), x[i].LockedBuffer(), incx,
+         beta, y[i].Buffer(), incy);
+    };
+    if (IsBlasScalar<T>::value)
+    {
+        EL_PARALLEL_FOR
+        for (Int i=0; i<batchSize; ++i)
+            product(i);
+    }
+    else
+    {
+        for (Int i=0; i<batchSize; ++i)
+            product(i);
+    }
+}
+
+#define PROTO(T) \
+  template void GemvBatched \
+  (Orientation orientation, Int m, Int n, \
+    T alpha, const T* const* A, Int ALDim, \
+             const T* const* x, Int incx, \
+    T beta,        T* const* y, Int incy, Int batchSize); \
+  template void GemvStridedBatched \
+  (Orientation orientation, Int m, Int n, \
+    T alpha, const T* A, Int ALDim, Int strideA, \
+             const T* x, Int incx, Int stridex, \
+    T beta,        T* y, Int incy, Int stridey, Int batchSize); \
+  template void GemvBatched \
+  (Orientation orientation, \
+    T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& x, \
+    T beta,        vector<Matrix<T>>& y);
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
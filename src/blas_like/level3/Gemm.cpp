@@ -13,6 +13,8 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
+#include "./Gemm/Cannon.hpp"
 
 namespace El
 {
@@ -140,6 +142,8 @@ void Gemm
     const Int k = (orientA == NORMAL ? A.Width() : A.Height());
     if (k != 0)
     {
+        EL_PROFILE_REGION("blas::Gemm");
+        ProfileFlops((IsComplex<T>::value ? 8. : 2.)*m*n*k);
         BLASHelper<D>::Gemm(
             transA, transB, m, n, k,
             alpha, A.LockedBuffer(), A.LDim(),
@@ -184,13 +188,38 @@ void Gemm
   GemmAlgorithm alg)
 {
     EL_DEBUG_CSE
+    if(alg == GEMM_DEFAULT)
+    {
+        const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+        const GemmChoice choice =
+            SelectGemmAlgorithm<T>
+            (orientA, orientB, C.Height(), C.Width(), k, C.Grid());
+        if(choice.alg != GEMM_DEFAULT)
+        {
+            if(choice.blocksize > 0)
+            {
+                BlocksizeGuard guard(choice.blocksize);
+                Gemm(orientA, orientB, alpha, A, B, beta, C, choice.alg);
+            }
+            else
+                Gemm(orientA, orientB, alpha, A, B, beta, C, choice.alg);
+            return;
+        }
+    }
+
+    EL_PROFILE_REGION("Gemm");
     C *= beta;
-    if(orientA == NORMAL && orientB == NORMAL)
+    if(alg == GEMM_SUMMA_25D)
+    {
+        gemm::SUMMA_25D(orientA, orientB, alpha, A, B, C);
+    }
+    else if(alg == GEMM_CANNON)
     {
-        if(alg == GEMM_CANNON)
-            gemm::Cannon_NN(alpha, A, B, C);
-        else
-            gemm::SUMMA_NN(alpha, A, B, C, alg);
+        gemm::Cannon(orientA, orientB, alpha, A, B, C);
+    }
+    else if(orientA == NORMAL && orientB == NORMAL)
+    {
+        gemm::SUMMA_NN(alpha, A, B, C, alg);
     }
     else if(orientA == NORMAL)
     {
@@ -346,6 +375,12 @@ void LocalGemm
     LocalGemm(orientA, orientB, alpha, A, B, T(0), C);
 }
 
+void FreeGemmCaches()
+{
+    gemm::LayerGridCache().clear();
+    gemm::CannonCommCache().clear();
+}
+
 #ifdef HYDROGEN_HAVE_CUDA
 template void Gemm(Orientation orientA, Orientation orientB,
                    float alpha,
@@ -0,0 +1,310 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The communicators over which Cannon gathers the initial packages: the
+// processes of each grid row whose columns agree modulo s = gcd(r,c), and
+// likewise within each grid column. Splitting these is collective, so they
+// are cached between calls, like the layer grids of SUMMA_25D, and freed
+// by Finalize.
+class CannonComms
+{
+public:
+    explicit CannonComms(const Grid& g)
+    : height_(g.Height()), order_(g.Order())
+    {
+        EL_DEBUG_CSE
+        mpi::Dup(g.VCComm(), vcComm_);
+        const int s = g.GCD();
+        if (g.Width() != s)
+            mpi::Split(g.RowComm(), g.Col() % s, g.Col() / s, rowGatherComm_);
+        if (g.Height() != s)
+            mpi::Split(g.ColComm(), g.Row() % s, g.Row() / s, colGatherComm_);
+    }
+
+    ~CannonComms()
+    {
+        if (mpi::Finalized())
+            return;
+        for (mpi::Comm* comm : {&vcComm_, &rowGatherComm_, &colGatherComm_})
+            if (*comm != mpi::COMM_NULL)
+                mpi::Free(*comm);
+    }
+
+    CannonComms(const CannonComms&) = delete;
+    CannonComms& operator=(const CannonComms&) = delete;
+
+    // Whether these communicators were split from the given grid, which
+    // holds as long as it has the same shape over the same VC ordering
+    bool Matches(const Grid& g) const
+    {
+        return g.Height() == height_ && g.Order() == order_ &&
+               mpi::Congruent(g.VCComm(), vcComm_);
+    }
+
+    mpi::Comm RowGatherComm() const { return rowGatherComm_; }
+    mpi::Comm ColGatherComm() const { return colGatherComm_; }
+
+private:
+    int height_;
+    GridOrder order_;
+    mpi::Comm vcComm_=mpi::COMM_NULL,
+              rowGatherComm_=mpi::COMM_NULL,
+              colGatherComm_=mpi::COMM_NULL;
+};
+
+inline vector<unique_ptr<CannonComms>>& CannonCommCache()
+{
+    static vector<unique_ptr<CannonComms>> cache;
+    return cache;
+}
+
+// Returns the cached communicators for the given grid, splitting them on a
+// miss. As with GetLayerGrids, only a few entries are kept.
+inline const CannonComms& GetCannonComms(const Grid& g)
+{
+    EL_DEBUG_CSE
+    const size_t maxCacheSize = 4;
+    auto& cache = CannonCommCache();
+    for (auto& entry : cache)
+        if (entry->Matches(g))
+            return *entry;
+    if (cache.size() == maxCacheSize)
+        cache.erase(cache.begin());
+    cache.emplace_back(new CannonComms(g));
+    return *cache.back();
+}
+
+// Cannon's algorithm for C += alpha op(A) op(B) over an r x c grid.
+//
+// The grid is viewed as (r/s) x (c/s) virtual square grids of order
+// s = gcd(r,c), each formed by a contiguous s x s block of processes, i.e.,
+// those sharing row/s and col/s. Within a block, a process is labeled by
+// its row and column modulo s. Process (row,col) first gathers, from the
+// c/s processes of its row which share its column modulo s (one per block),
+// every column of op(A) in its rows whose index is congruent to col modulo
+// s (and likewise for the rows of op(B)), after which the classical Cannon
+// skew and s-1 circular shifts are performed within its block. Each shift
+// is issued through persistent requests into the second of two buffers
+// before the local Gemm on the first, so that the communication overlaps
+// the computation.
+template<typename T>
+void Cannon
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::Cannon");
+    if (APre.GetLocalDevice() != Device::CPU)
+        LogicError("Cannon not implemented for device!");
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& C = CProx.Get();
+    const Grid& g = C.Grid();
+
+    // Form op(A) with its rows aligned with C and op(B) with its columns
+    // aligned with C
+    DistMatrix<T> A(g), B(g);
+    A.Align(C.ColAlign(), 0);
+    B.Align(0, C.RowAlign());
+    if (orientA == NORMAL)
+        A = APre;
+    else
+        Transpose(APre, A, orientA == ADJOINT);
+    if (orientB == NORMAL)
+        B = BPre;
+    else
+        Transpose(BPre, B, orientB == ADJOINT);
+    if (!C.Participating())
+        return;
+
+    const Int K = A.Width();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int row = g.Row();
+    const int col = g.Col();
+    const int s = g.GCD();
+    const int rowClass = row % s;
+    const int colClass = col % s;
+    mpi::Comm rowComm = g.RowComm();
+    mpi::Comm colComm = g.ColComm();
+    const CannonComms& comms = GetCannonComms(g);
+
+    // Each package has room for the largest congruence class of the inner
+    // dimension so that every shift transfers the same number of entries
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    const Int maxInner = MaxLength(K, s);
+    const Int ldimA = Max(localHeight, Int(1));
+    const Int ldimB = Max(maxInner, Int(1));
+    const Int pkgSizeA = ldimA*maxInner;
+    const Int pkgSizeB = ldimB*localWidth;
+    Matrix<T> pkgA[2], pkgB[2];
+    for (Int buf=0; buf<2; ++buf)
+    {
+        pkgA[buf].Resize(localHeight, maxInner, ldimA);
+        pkgB[buf].Resize(maxInner, localWidth, ldimB);
+    }
+
+    // Load the initial A package
+    const Int innerA = Length(K, colClass, s);
+    if (c == s)
+    {
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        (localHeight, innerA,
+         A.LockedBuffer(),   1, A.LDim(),
+         pkgA[0].Buffer(), 1, ldimA);
+    }
+    else
+    {
+        mpi::Comm gatherComm = comms.RowGatherComm();
+        const int numMembers = c / s;
+        const Int portionSize = localHeight*MaxLength(K, c);
+        vector<T> sendBuf, recvBuf;
+        FastResize(sendBuf, portionSize);
+        FastResize(recvBuf, numMembers*portionSize);
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        (localHeight, A.LocalWidth(),
+         A.LockedBuffer(), 1, A.LDim(),
+         sendBuf.data(),   1, localHeight);
+        mpi::AllGather
+        (sendBuf.data(), portionSize, recvBuf.data(), portionSize, gatherComm);
+        copy::util::RowStridedUnpack<T,Device::CPU>
+        (localHeight, innerA, 0, numMembers,
+         recvBuf.data(), portionSize, pkgA[0].Buffer(), ldimA);
+    }
+
+    // Load the initial B package
+    const Int innerB = Length(K, rowClass, s);
+    if (r == s)
+    {
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        (innerB, localWidth,
+         B.LockedBuffer(),   1, B.LDim(),
+         pkgB[0].Buffer(), 1, ldimB);
+    }
+    else
+    {
+        mpi::Comm gatherComm = comms.ColGatherComm();
+        const int numMembers = r / s;
+        const Int portionSize = MaxLength(K, r)*localWidth;
+        vector<T> sendBuf, recvBuf;
+        FastResize(sendBuf, portionSize);
+        FastResize(recvBuf, numMembers*portionSize);
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        (B.LocalHeight(), localWidth,
+         B.LockedBuffer(), 1, B.LDim(),
+         sendBuf.data(),   1, B.LocalHeight());
+        mpi::AllGather
+        (sendBuf.data(), portionSize, recvBuf.data(), portionSize, gatherComm);
+        copy::util::ColStridedUnpack<T,Device::CPU>
+        (innerB, localWidth, 0, numMembers,
+         recvBuf.data(), portionSize, pkgB[0].Buffer(), ldimB);
+    }
+
+    // Skew the packages within the virtual square grid so that process
+    // (row,col) holds the congruence class rowClass+colClass of both
+    const int ringBaseA = (col/s)*s;
+    const int ringBaseB = (row/s)*s;
+    if (s > 1)
+    {
+        mpi::SendRecv
+        (pkgA[0].Buffer(), pkgSizeA,
+         ringBaseA+Mod(colClass-rowClass,s),
+         ringBaseA+Mod(colClass+rowClass,s), rowComm);
+        mpi::SendRecv
+        (pkgB[0].Buffer(), pkgSizeB,
+         ringBaseB+Mod(rowClass-colClass,s),
+         ringBaseB+Mod(rowClass+colClass,s), colComm);
+    }
+
+    // Now begin the data flow
+    const int leftA = ringBaseA + Mod(colClass-1,s);
+    const int rightA = ringBaseA + Mod(colClass+1,s);
+    const int aboveB = ringBaseB + Mod(rowClass-1,s);
+    const int belowB = ringBaseB + Mod(rowClass+1,s);
+    const bool persistent = IsPacked<T>::value && s > 1;
+    mpi::Request<T> sendA[2], recvA[2], sendB[2], recvB[2];
+    if (persistent)
+    {
+        for (Int buf=0; buf<2; ++buf)
+        {
+            mpi::SendInit
+            (pkgA[buf].LockedBuffer(), pkgSizeA, leftA, rowComm, sendA[buf]);
+            mpi::RecvInit
+            (pkgA[buf].Buffer(), pkgSizeA, rightA, rowComm, recvA[buf]);
+            mpi::SendInit
+            (pkgB[buf].LockedBuffer(), pkgSizeB, aboveB, colComm, sendB[buf]);
+            mpi::RecvInit
+            (pkgB[buf].Buffer(), pkgSizeB, belowB, colComm, recvB[buf]);
+        }
+    }
+    Int cur = 0;
+    for (Int q=0; q<s; ++q)
+    {
+        const Int nxt = 1 - cur;
+        const bool shifting = (q != s-1);
+        if (shifting)
+        {
+            if (persistent)
+            {
+                mpi::Start(recvA[nxt]);
+                mpi::Start(recvB[nxt]);
+                mpi::Start(sendA[cur]);
+                mpi::Start(sendB[cur]);
+            }
+            else
+            {
+                mpi::IRecv
+                (pkgA[nxt].Buffer(), pkgSizeA, rightA, rowComm, recvA[nxt]);
+                mpi::IRecv
+                (pkgB[nxt].Buffer(), pkgSizeB, belowB, colComm, recvB[nxt]);
+                mpi::ISend
+                (pkgA[cur].LockedBuffer(), pkgSizeA, leftA, rowComm,
+                 sendA[cur]);
+                mpi::ISend
+                (pkgB[cur].LockedBuffer(), pkgSizeB, aboveB, colComm,
+                 sendB[cur]);
+            }
+        }
+
+        const Int inner = Length(K, Mod(rowClass+colClass+q,s), s);
+        Gemm
+        (NORMAL, NORMAL,
+         alpha, pkgA[cur](ALL,IR(0,inner)), pkgB[cur](IR(0,inner),ALL),
+         T(1), C.Matrix());
+
+        if (shifting)
+        {
+            mpi::Wait(recvA[nxt]);
+            mpi::Wait(recvB[nxt]);
+            mpi::Wait(sendA[cur]);
+            mpi::Wait(sendB[cur]);
+            cur = nxt;
+        }
+    }
+    if (persistent)
+    {
+        for (Int buf=0; buf<2; ++buf)
+        {
+            mpi::Free(sendA[buf]);
+            mpi::Free(recvA[buf]);
+            mpi::Free(sendB[buf]);
+            mpi::Free(recvB[buf]);
+        }
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -10,88 +10,6 @@
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
-template<typename T>
-void Cannon_NN
-(T alpha,
-  const AbstractDistMatrix<T>& APre,
-  const AbstractDistMatrix<T>& BPre,
-        AbstractDistMatrix<T>& CPre)
-{
-    EL_DEBUG_CSE
-
-    if (APre.GetLocalDevice() != Device::CPU)
-        LogicError("Cannon_NN not implemented for device!");
-
-    const Grid& g = APre.Grid();
-    if (g.Height() != g.Width())
-        LogicError("Process grid must be square for Cannon's");
-
-    // Force A, B, and C to be in [MC,MR] distributions aligned with C
-    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
-    auto& C = CProx.Get();
-
-    ElementalProxyCtrl ctrlA, ctrlB;
-    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
-    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
-
-    DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
-    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
-    auto& A = AProx.GetLocked();
-    auto& B = BProx.GetLocked();
-
-    const Int row = g.Row();
-    const Int col = g.Col();
-    const Int pSqrt = g.Height();
-    mpi::Comm rowComm = g.RowComm();
-    mpi::Comm colComm = g.ColComm();
-    if (A.Width() % pSqrt != 0)
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
-
-    // Load the initial A and B packages (may want to transpose B...)
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA),
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for(Int jLoc=0; jLoc<localWidthA; ++jLoc)
-        MemCopy
-        (pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA);
-    for(Int jLoc=0; jLoc<localWidthB; ++jLoc)
-        MemCopy
-        (pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB);
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv(pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm);
-    mpi::SendRecv(pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm);
-
-    // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for(Int q=0; q<pSqrt; ++q)
-    {
-        Gemm(NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix());
-        if (q != pSqrt-1)
-        {
-            mpi::SendRecv
-            (pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm);
-            mpi::SendRecv
-            (pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm);
-        }
-    }
-}
-
 // Normal Normal Gemm that avoids communicating the matrix A
 template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
 void SUMMA_NNA_impl
@@ -155,6 +73,7 @@ void SUMMA_NNA
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NNA");
 
     switch (CPre.GetLocalDevice())
     {
@@ -231,6 +150,7 @@ void SUMMA_NNB
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NNB");
 
     switch (CPre.GetLocalDevice())
     {
@@ -306,6 +226,7 @@ void SUMMA_NNC
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NNC");
 
     switch (CPre.GetLocalDevice())
     {
@@ -323,6 +244,128 @@ void SUMMA_NNC
 
 }
 
+// Normal Normal Gemm that avoids communicating the matrix C and overlaps the
+// gathering of the next panels of A and B with the local update from the
+// current ones
+//
+// The panels are gathered directly from the local data of A and B with
+// nonblocking AllGathers into double-buffered storage, so that while
+// C[MC,MR] += alpha A1[MC,*] B1[*,MR] runs for panel k, the AllGathers for
+// panel k+1 are already in flight.
+template<typename T>
+void SUMMA_NNC_Pipelined
+(T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NNC_Pipelined");
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if (CPre.GetLocalDevice() != Device::CPU)
+    {
+        SUMMA_NNC(alpha, APre, BPre, CPre);
+        return;
+    }
+
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const Int colStride = g.Height();
+    const Int rowStride = g.Width();
+    mpi::Comm colComm = g.ColComm();
+    mpi::Comm rowComm = g.RowComm();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // Force A to share the row distribution of C and B to share the column
+    // distribution of C so that the gathered panels line up with C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Every panel is packed into portions sized for the widest one
+    const Int localHeightA = A.LocalHeight();
+    const Int localWidthB = B.LocalWidth();
+    const Int portionSizeA = localHeightA*MaxLength(bsize,rowStride);
+    const Int portionSizeB = MaxLength(bsize,colStride)*localWidthB;
+
+    simple_buffer<T,Device::CPU> sendA[2], recvA[2], sendB[2], recvB[2];
+    for (Int buf=0; buf<2; ++buf)
+    {
+        sendA[buf].allocate(portionSizeA);
+        recvA[buf].allocate(rowStride*portionSizeA);
+        sendB[buf].allocate(portionSizeB);
+        recvB[buf].allocate(colStride*portionSizeB);
+    }
+    mpi::Request<T> requestA[2], requestB[2];
+
+    auto startPanel = [&](Int k, Int buf)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A(ALL,        IR(k,k+nb));
+        auto B1 = B(IR(k,k+nb), ALL       );
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        (localHeightA, A1.LocalWidth(),
+         A1.LockedBuffer(), 1, A1.LDim(),
+         sendA[buf].data(), 1, localHeightA);
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        (B1.LocalHeight(), localWidthB,
+         B1.LockedBuffer(), 1, B1.LDim(),
+         sendB[buf].data(), 1, B1.LocalHeight());
+        mpi::IAllGather
+        (sendA[buf].data(), portionSizeA,
+         recvA[buf].data(), portionSizeA, rowComm, requestA[buf]);
+        mpi::IAllGather
+        (sendB[buf].data(), portionSizeB,
+         recvB[buf].data(), portionSizeB, colComm, requestB[buf]);
+    };
+
+    // Temporary distributions
+    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR(g);
+    A1_MC_STAR.AlignWith(C);
+    B1_STAR_MR.AlignWith(C);
+
+    if (sumDim > 0)
+        startPanel(0, 0);
+    for (Int k=0, buf=0; k<sumDim; k+=bsize, buf=1-buf)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        if (k+bsize < sumDim)
+            startPanel(k+bsize, 1-buf);
+
+        auto A1 = A(ALL,        IR(k,k+nb));
+        auto B1 = B(IR(k,k+nb), ALL       );
+        A1_MC_STAR.Resize(A1.Height(), nb);
+        B1_STAR_MR.Resize(nb, B1.Width());
+
+        mpi::Wait(requestA[buf]);
+        copy::util::RowStridedUnpack<T,Device::CPU>
+        (localHeightA, nb, A1.RowAlign(), rowStride,
+         recvA[buf].data(), portionSizeA,
+         A1_MC_STAR.Buffer(), A1_MC_STAR.LDim());
+        mpi::Wait(requestB[buf]);
+        copy::util::ColStridedUnpack<T,Device::CPU>
+        (nb, localWidthB, B1.ColAlign(), colStride,
+         recvB[buf].data(), portionSizeB,
+         B1_STAR_MR.Buffer(), B1_STAR_MR.LDim());
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        LocalGemm
+        (NORMAL, NORMAL, alpha, A1_MC_STAR, B1_STAR_MR, T(1), C);
+    }
+#else
+    SUMMA_NNC(alpha, APre, BPre, CPre);
+#endif // EL_HAVE_NONBLOCKING_COLLECTIVES
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -396,6 +439,7 @@ void SUMMA_NNDot
   Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NNDot");
 
     switch (CPre.GetLocalDevice())
     {
@@ -462,6 +506,7 @@ void SUMMA_NN
     case GEMM_SUMMA_B:   SUMMA_NNB(alpha, A, B, C); break;
     case GEMM_SUMMA_C:   SUMMA_NNC(alpha, A, B, C); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot(alpha, A, B, C, blockSizeDot); break;
+    case GEMM_SUMMA_C_PIPELINED: SUMMA_NNC_Pipelined(alpha, A, B, C); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
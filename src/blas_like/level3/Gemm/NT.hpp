@@ -74,6 +74,7 @@ void SUMMA_NTA
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NTA");
 
     switch (CPre.GetLocalDevice())
     {
@@ -157,6 +158,7 @@ void SUMMA_NTB
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NTB");
 
     switch (CPre.GetLocalDevice())
     {
@@ -240,6 +242,7 @@ void SUMMA_NTC
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NTC");
 
     switch (CPre.GetLocalDevice())
     {
@@ -331,6 +334,7 @@ void SUMMA_NTDot
  Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NTDot");
 
     switch (CPre.GetLocalDevice())
     {
@@ -349,6 +353,29 @@ void SUMMA_NTDot
     }
 }
 
+// Normal Transpose Gemm that explicitly forms op(B) and then overlaps the
+// panel communication with the local updates
+template<typename T>
+void SUMMA_NTC_Pipelined
+(Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_NTC_Pipelined");
+    if (CPre.GetLocalDevice() != Device::CPU)
+    {
+        SUMMA_NTC(orientB, alpha, APre, BPre, CPre);
+        return;
+    }
+    const bool conjugate = (orientB == ADJOINT);
+    DistMatrix<T> BTrans(BPre.Grid());
+    Transpose(BPre, BTrans, conjugate);
+    SUMMA_NNC_Pipelined(alpha, APre, BTrans, CPre);
+}
+
 template<typename T>
 void SUMMA_NT
 (Orientation orientB,
@@ -398,6 +425,9 @@ void SUMMA_NT
     case GEMM_SUMMA_B: SUMMA_NTB(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_C: SUMMA_NTC(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot(orientB, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_NTC_Pipelined(orientB, alpha, A, B, C);
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The number of process layers used by SUMMA_25D: either the value set by
+// SetGemmReplicationDepth or, by default, the largest divisor c of the grid
+// size with c^3 <= p (beyond which the 3D algorithm gains nothing further)
+inline int ReplicationDepth(int gridSize)
+{
+    const int depth = GemmReplicationDepth();
+    if (depth > 0)
+        return depth;
+    int bestDepth = 1;
+    for (int c=2; c*c*c<=gridSize; ++c)
+        if (gridSize % c == 0)
+            bestDepth = c;
+    return bestDepth;
+}
+
+// The layer grids of SUMMA_25D for one grid and replication depth, along
+// with the communicator which joins corresponding processes of the layers.
+// Building these takes several collective communicator constructions, so
+// they are cached between calls. Since each Grid duplicates its viewing
+// communicator, the cached grids remain valid after the original grid is
+// destroyed and serve any grid with the same viewing processes and VC order.
+class LayerGrids
+{
+public:
+    LayerGrids(const Grid& g, int depth)
+    : depth_(depth), vcToViewing_(g.Size()), grids_(depth)
+    {
+        EL_DEBUG_CSE
+        const int gridSize = g.Size();
+        for (int q=0; q<gridSize; ++q)
+            vcToViewing_[q] = g.VCToViewing(q);
+
+        // Each layer grid is viewed by every process of g so that matrices
+        // can be redistributed between them
+        const int layerSize = gridSize / depth;
+        const int layerHeight = Grid::DefaultHeight(layerSize);
+        mpi::Group viewingGroup;
+        mpi::CommGroup(g.ViewingComm(), viewingGroup);
+        vector<int> layerRanks(layerSize);
+        for (int layer=0; layer<depth; ++layer)
+        {
+            for (int q=0; q<layerSize; ++q)
+                layerRanks[q] = vcToViewing_[q+layer*layerSize];
+            mpi::Group layerGroup;
+            mpi::Incl(viewingGroup, layerSize, layerRanks.data(), layerGroup);
+            grids_[layer].reset
+            (new Grid(g.ViewingComm(), layerGroup, layerHeight, g.Order()));
+            mpi::Free(layerGroup);
+        }
+        mpi::Free(viewingGroup);
+
+        if (g.InGrid())
+            mpi::Split
+            (g.VCComm(), g.VCRank() % layerSize, g.VCRank() / layerSize,
+             depthComm_);
+    }
+
+    ~LayerGrids()
+    {
+        if (depthComm_ != mpi::COMM_NULL && !mpi::Finalized())
+            mpi::Free(depthComm_);
+    }
+
+    LayerGrids(const LayerGrids&) = delete;
+    LayerGrids& operator=(const LayerGrids&) = delete;
+
+    // Whether these layers were built for the given grid and depth
+    bool Matches(const Grid& g, int depth) const
+    {
+        if (depth != depth_ || g.Size() != int(vcToViewing_.size()))
+            return false;
+        if (!mpi::Congruent(g.ViewingComm(), grids_[0]->ViewingComm()))
+            return false;
+        for (int q=0; q<g.Size(); ++q)
+            if (g.VCToViewing(q) != vcToViewing_[q])
+                return false;
+        return true;
+    }
+
+    const Grid& Layer(int layer) const { return *grids_[layer]; }
+    mpi::Comm DepthComm() const { return depthComm_; }
+
+private:
+    int depth_;
+    vector<int> vcToViewing_;
+    vector<unique_ptr<Grid>> grids_;
+    mpi::Comm depthComm_=mpi::COMM_NULL;
+};
+
+inline vector<unique_ptr<LayerGrids>>& LayerGridCache()
+{
+    static vector<unique_ptr<LayerGrids>> cache;
+    return cache;
+}
+
+// Returns the cached layers for the given grid and depth, building them on
+// a miss. Every viewing process makes the same decision, so the collective
+// constructions stay matched. Only a few entries are kept, and the oldest
+// is dropped first.
+inline const LayerGrids& GetLayerGrids(const Grid& g, int depth)
+{
+    EL_DEBUG_CSE
+    const size_t maxCacheSize = 4;
+    auto& cache = LayerGridCache();
+    for (auto& entry : cache)
+        if (entry->Matches(g, depth))
+            return *entry;
+    if (cache.size() == maxCacheSize)
+        cache.erase(cache.begin());
+    cache.emplace_back(new LayerGrids(g, depth));
+    return *cache.back();
+}
+
+// Communication-avoiding 2.5D/3D Gemm.
+//
+// The p processes of the grid are split into c layers of p/c processes,
+// each of which forms its own grid. Layer l receives the l'th of c
+// contiguous slices of the inner dimension of op(A) and op(B), forms its
+// partial product with SUMMA on its (smaller) grid, and the c partial
+// products are then summed across the layers and redistributed into C.
+// Relative to 2D SUMMA, the per-process bandwidth cost falls by a factor
+// of sqrt(c) at the price of c copies of C.
+template<typename T>
+void SUMMA_25D
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_25D");
+    const Grid& g = CPre.Grid();
+    const int gridSize = g.Size();
+    const int depth = ReplicationDepth(gridSize);
+    if (depth > gridSize || gridSize % depth != 0)
+        LogicError
+        ("Replication depth ",depth," does not divide the grid size ",
+         gridSize);
+    if (depth == 1 || APre.GetLocalDevice() != Device::CPU)
+    {
+        Gemm(orientA, orientB, alpha, APre, BPre, T(1), CPre, GEMM_DEFAULT);
+        return;
+    }
+
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int k = (orientA == NORMAL ? APre.Width() : APre.Height());
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre);
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const int layerSize = gridSize / depth;
+    const LayerGrids& layers = GetLayerGrids(g, depth);
+
+    // Hand each layer its slice of the inner dimension
+    vector<DistMatrix<T>> ALayers, BLayers;
+    ALayers.reserve(depth);
+    BLayers.reserve(depth);
+    for (int layer=0; layer<depth; ++layer)
+    {
+        const Range<Int> ind(k*layer/depth, k*(layer+1)/depth);
+        ALayers.emplace_back(layers.Layer(layer));
+        BLayers.emplace_back(layers.Layer(layer));
+        if (orientA == NORMAL)
+            ALayers[layer] = A(ALL, ind);
+        else
+            ALayers[layer] = A(ind, ALL);
+        if (orientB == NORMAL)
+            BLayers[layer] = B(ind, ALL);
+        else
+            BLayers[layer] = B(ALL, ind);
+    }
+
+    // Form the partial products within each layer and sum them into the
+    // first layer. Since every layer grid has the same shape and the
+    // partial products share their alignments, the local buffers of
+    // corresponding processes in different layers line up entry for entry.
+    DistMatrix<T> CLayer(layers.Layer(0));
+    if (g.InGrid())
+    {
+        const int layer = g.VCRank() / layerSize;
+        DistMatrix<T> CPartial(layers.Layer(layer));
+        auto& CProd = (layer == 0 ? CLayer : CPartial);
+        Gemm
+        (orientA, orientB, alpha, ALayers[layer], BLayers[layer],
+         CProd, GEMM_DEFAULT);
+        ALayers.clear();
+        BLayers.clear();
+
+        auto& CLoc = CProd.Matrix();
+        EL_DEBUG_ONLY(
+          if (CLoc.LDim() != Max(CLoc.Height(), Int(1)) && CLoc.Width() > 1)
+              LogicError("Expected the partial product to be contiguous");
+        )
+        mpi::Reduce
+        (CLoc.Buffer(), CLoc.Height()*CLoc.Width(), mpi::SUM, 0,
+         layers.DepthComm());
+    }
+    CLayer.Resize(m, n);
+
+    // Redistribute the sum back onto the original grid and accumulate it
+    DistMatrix<T> CSum(g);
+    CSum.AlignWith(C);
+    CSum = CLayer;
+    if (C.Participating())
+        Axpy(T(1), CSum.LockedMatrix(), C.Matrix());
+}
+
+} // namespace gemm
+} // namespace El
@@ -77,6 +77,7 @@ void SUMMA_TNA
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TNA");
 
     switch (CPre.GetLocalDevice())
     {
@@ -157,6 +158,7 @@ void SUMMA_TNB
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TNB");
 
     switch (CPre.GetLocalDevice())
     {
@@ -237,6 +239,7 @@ void SUMMA_TNC
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TNC");
 
     switch (CPre.GetLocalDevice())
     {
@@ -328,6 +331,7 @@ void SUMMA_TNDot
     Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TNDot");
 
     switch (CPre.GetLocalDevice())
     {
@@ -346,6 +350,29 @@ void SUMMA_TNDot
     }
 }
 
+// Transpose Normal Gemm that explicitly forms op(A) and then overlaps the
+// panel communication with the local updates
+template<typename T>
+void SUMMA_TNC_Pipelined
+(Orientation orientA,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TNC_Pipelined");
+    if (CPre.GetLocalDevice() != Device::CPU)
+    {
+        SUMMA_TNC(orientA, alpha, APre, BPre, CPre);
+        return;
+    }
+    const bool conjugate = (orientA == ADJOINT);
+    DistMatrix<T> ATrans(APre.Grid());
+    Transpose(APre, ATrans, conjugate);
+    SUMMA_NNC_Pipelined(alpha, ATrans, BPre, CPre);
+}
+
 template<typename T>
 void SUMMA_TN
 (Orientation orientA,
@@ -395,6 +422,9 @@ void SUMMA_TN
     case GEMM_SUMMA_B: SUMMA_TNB(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_C: SUMMA_TNC(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot(orientA, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_TNC_Pipelined(orientA, alpha, A, B, C);
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -82,6 +82,7 @@ void SUMMA_TTA
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TTA");
 
     switch (CPre.GetLocalDevice())
     {
@@ -172,6 +173,7 @@ void SUMMA_TTB
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TTB");
 
     switch (CPre.GetLocalDevice())
     {
@@ -260,6 +262,7 @@ void SUMMA_TTC
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TTC");
 
     switch (CPre.GetLocalDevice())
     {
@@ -357,6 +360,7 @@ void SUMMA_TTDot
  Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TTDot");
 
     switch (CPre.GetLocalDevice())
     {
@@ -375,6 +379,30 @@ void SUMMA_TTDot
     }
 }
 
+// Transpose Transpose Gemm that explicitly forms op(A) and op(B) and then
+// overlaps the panel communication with the local updates
+template<typename T>
+void SUMMA_TTC_Pipelined
+(Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("gemm::SUMMA_TTC_Pipelined");
+    if (CPre.GetLocalDevice() != Device::CPU)
+    {
+        SUMMA_TTC(orientA, orientB, alpha, APre, BPre, CPre);
+        return;
+    }
+    DistMatrix<T> ATrans(APre.Grid()), BTrans(BPre.Grid());
+    Transpose(APre, ATrans, orientA == ADJOINT);
+    Transpose(BPre, BTrans, orientB == ADJOINT);
+    SUMMA_NNC_Pipelined(alpha, ATrans, BTrans, CPre);
+}
+
 template<typename T>
 void SUMMA_TT
 (Orientation orientA,
@@ -432,6 +460,9 @@ void SUMMA_TT
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot(orientA, orientB, alpha, A, B, C);
         break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_TTC_Pipelined(orientA, orientB, alpha, A, B, C);
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,402 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace {
+
+// A run of consecutive products in a batch which share their orientations,
+// dimensions, and leading dimensions
+struct GemmGroup
+{
+    char transA, transB;
+    Int m, n, k;
+    Int ALDim, BLDim, CLDim;
+    Int size;
+
+    bool SameShape(const GemmGroup& other) const
+    {
+        return transA == other.transA && transB == other.transB &&
+               m == other.m && n == other.n && k == other.k &&
+               ALDim == other.ALDim && BLDim == other.BLDim &&
+               CLDim == other.CLDim;
+    }
+};
+
+void CheckGemmGroup(const GemmGroup& group)
+{
+    if (group.m < 0 || group.n < 0 || group.k < 0)
+        LogicError
+        ("Invalid batched Gemm dimensions: ",group.m," x ",group.n," x ",
+         group.k);
+    const Int AHeight = (group.transA == 'N' ? group.m : group.k);
+    const Int BHeight = (group.transB == 'N' ? group.k : group.n);
+    if (group.ALDim < Max(AHeight,Int(1)) ||
+        group.BLDim < Max(BHeight,Int(1)) ||
+        group.CLDim < Max(group.m,Int(1)))
+        LogicError
+        ("Invalid batched Gemm leading dimensions: ",group.ALDim,", ",
+         group.BLDim,", ",group.CLDim," for ",group.m," x ",group.n," x ",
+         group.k);
+}
+
+template<typename T>
+void GemmProduct
+(const GemmGroup& group,
+  T alpha, const T* A, const T* B, T beta, T* C)
+{
+    if (group.m == 0 || group.n == 0)
+        return;
+    if (group.k != 0)
+    {
+        blas::Gemm
+        (group.transA, group.transB, group.m, group.n, group.k,
+         alpha, A, group.ALDim, B, group.BLDim, beta, C, group.CLDim);
+    }
+    else
+    {
+        for (Int j=0; j<group.n; ++j)
+            for (Int i=0; i<group.m; ++i)
+                C[i+j*group.CLDim] =
+                  (beta == T(0) ? T(0) : beta*C[i+j*group.CLDim]);
+    }
+}
+
+template<typename T>
+void GenericGemmBatch
+(const vector<GemmGroup>& groups,
+  T alpha, const T* const* A, const T* const* B, T beta, T* const* C)
+{
+    vector<Int> groupOfProduct;
+    for (Int group=0; group<Int(groups.size()); ++group)
+        groupOfProduct.insert
+        (groupOfProduct.end(), groups[group].size, group);
+    const Int batchSize = groupOfProduct.size();
+
+    // The native BLAS types are spread over the threads (with each call to
+    // the BLAS expected to run sequentially within its thread), whereas the
+    // extended-precision types are processed in order
+    if (IsBlasScalar<T>::value)
+    {
+        EL_PARALLEL_FOR
+        for (Int i=0; i<batchSize; ++i)
+            GemmProduct
+            (groups[groupOfProduct[i]], alpha, A[i], B[i], beta, C[i]);
+    }
+    else
+    {
+        for (Int i=0; i<batchSize; ++i)
+            GemmProduct
+            (groups[groupOfProduct[i]], alpha, A[i], B[i], beta, C[i]);
+    }
+}
+
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void GemmBatch
+(const vector<GemmGroup>& groups,
+  T alpha, const T* const* A, const T* const* B, T beta, T* const* C)
+{
+#ifdef HYDROGEN_HAVE_MKL
+    const Int groupCount = groups.size();
+    vector<char> transA(groupCount), transB(groupCount);
+    vector<BlasInt> m(groupCount), n(groupCount), k(groupCount),
+      ALDim(groupCount), BLDim(groupCount), CLDim(groupCount),
+      groupSizes(groupCount);
+    vector<T> alphas(groupCount, alpha), betas(groupCount, beta);
+    Int batchSize = 0;
+    for (Int group=0; group<groupCount; ++group)
+    {
+        transA[group] = groups[group].transA;
+        transB[group] = groups[group].transB;
+        m[group] = groups[group].m;
+        n[group] = groups[group].n;
+        k[group] = groups[group].k;
+        ALDim[group] = groups[group].ALDim;
+        BLDim[group] = groups[group].BLDim;
+        CLDim[group] = groups[group].CLDim;
+        groupSizes[group] = groups[group].size;
+        batchSize += groups[group].size;
+    }
+    if (batchSize == 0)
+        return;
+    mkl::GemmBatch
+    (transA.data(), transB.data(), m.data(), n.data(), k.data(),
+     alphas.data(),
+     const_cast<const T**>(A), ALDim.data(),
+     const_cast<const T**>(B), BLDim.data(),
+     betas.data(),
+     const_cast<T**>(C), CLDim.data(),
+     groupCount, groupSizes.data());
+#else
+    GenericGemmBatch(groups, alpha, A, B, beta, C);
+#endif
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void GemmBatch
+(const vector<GemmGroup>& groups,
+  T alpha, const T* const* A, const T* const* B, T beta, T* const* C)
+{ GenericGemmBatch(groups, alpha, A, B, beta, C); }
+
+// Products of CPU matrices with arbitrary (conformal) dimensions, which are
+// grouped into runs of consecutive products of the same shape
+template<typename T>
+void GemmMatrixBatch
+(Orientation orientA, Orientation orientB,
+  T alpha, const vector<const Matrix<T>*>& A,
+           const vector<const Matrix<T>*>& B,
+  T beta,  const vector<Matrix<T>*>& C)
+{
+    const Int batchSize = C.size();
+    if (Int(A.size()) != batchSize || Int(B.size()) != batchSize)
+        LogicError
+        ("Batches of ",A.size(),", ",B.size(),", and ",C.size(),
+         " matrices are incompatible");
+    vector<GemmGroup> groups;
+    vector<const T*> ABufs(batchSize), BBufs(batchSize);
+    vector<T*> CBufs(batchSize);
+    for (Int i=0; i<batchSize; ++i)
+    {
+        GemmGroup group;
+        group.transA = OrientationToChar(orientA);
+        group.transB = OrientationToChar(orientB);
+        group.m = C[i]->Height();
+        group.n = C[i]->Width();
+        group.k = (orientA == NORMAL ? A[i]->Width() : A[i]->Height());
+        const Int AHeight =
+          (orientA == NORMAL ? A[i]->Height() : A[i]->Width());
+        const Int BHeight =
+          (orientB == NORMAL ? B[i]->Height() : B[i]->Width());
+        const Int BWidth =
+          (orientB == NORMAL ? B[i]->Width() : B[i]->Height());
+        if (AHeight != group.m || BHeight != group.k || BWidth != group.n)
+            LogicError
+            ("Nonconformal product ",i," in batched Gemm:\n",
+             DimsString(*A[i],"A"),"\n",DimsString(*B[i],"B"),"\n",
+             DimsString(*C[i],"C"));
+        group.ALDim = A[i]->LDim();
+        group.BLDim = B[i]->LDim();
+        group.CLDim = C[i]->LDim();
+        group.size = 1;
+        if (!groups.empty() && groups.back().SameShape(group))
+            ++groups.back().size;
+        else
+            groups.push_back(group);
+        ABufs[i] = A[i]->LockedBuffer();
+        BBufs[i] = B[i]->LockedBuffer();
+        CBufs[i] = C[i]->Buffer();
+    }
+    GemmBatch(groups, alpha, ABufs.data(), BBufs.data(), beta, CBufs.data());
+}
+
+} // namespace <anon>
+
+template<typename T>
+void GemmBatched
+(Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  T alpha, const T* const* A, Int ALDim,
+           const T* const* B, Int BLDim,
+  T beta,        T* const* C, Int CLDim, Int batchSize)
+{
+    EL_DEBUG_CSE
+    GemmGroup group;
+    group.transA = OrientationToChar(orientA);
+    group.transB = OrientationToChar(orientB);
+    group.m = m;
+    group.n = n;
+    group.k = k;
+    group.ALDim = ALDim;
+    group.BLDim = BLDim;
+    group.CLDim = CLDim;
+    group.size = batchSize;
+    CheckGemmGroup(group);
+    const vector<GemmGroup> groups(1, group);
+    GemmBatch(groups, alpha, A, B, beta, C);
+}
+
+template<typename T>
+void GemmStridedBatched
+(Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* B, Int BLDim, Int strideB,
+  T beta,        T* C, Int CLDim, Int strideC, Int batchSize)
+{
+    EL_DEBUG_CSE
+    vector<const T*> ABufs(batchSize), BBufs(batchSize);
+    vector<T*> CBufs(batchSize);
+    for (Int i=0; i<batchSize; ++i)
+    {
+        ABufs[i] = &A[i*strideA];
+        BBufs[i] = &B[i*strideB];
+        CBufs[i] = &C[i*strideC];
+    }
+    GemmBatched
+    (orientA, orientB, m, n, k,
+     alpha, ABufs.data(), ALDim, BBufs.data(), BLDim,
+     beta, CBufs.data(), CLDim, batchSize);
+}
+
+template<typename T>
+void GemmBatched
+(Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C)
+{
+    EL_DEBUG_CSE
+    vector<const Matrix<T>*> APtrs, BPtrs;
+    vector<Matrix<T>*> CPtrs;
+    for (const auto& ABlock : A)
+        APtrs.push_back(&ABlock);
+    for (const auto& BBlock : B)
+        BPtrs.push_back(&BBlock);
+    for (auto& CBlock : C)
+        CPtrs.push_back(&CBlock);
+    GemmMatrixBatch(orientA, orientB, alpha, APtrs, BPtrs, beta, CPtrs);
+}
+
+template<typename T>
+void GemmBatched
+(Orientation orientA, Orientation orientB,
+  T alpha, const vector<DistMatrix<T,STAR,STAR>>& A,
+           const vector<DistMatrix<T,STAR,STAR>>& B,
+  T beta,        vector<DistMatrix<T,STAR,STAR>>& C)
+{
+    EL_DEBUG_CSE
+    const Int batchSize = C.size();
+    if (Int(A.size()) != batchSize || Int(B.size()) != batchSize)
+        LogicError
+        ("Batches of ",A.size(),", ",B.size(),", and ",C.size(),
+         " matrices are incompatible");
+    if (batchSize == 0)
+        return;
+    const Grid& g = C[0].Grid();
+    for (Int i=0; i<batchSize; ++i)
+        if (A[i].Grid() != g || B[i].Grid() != g || C[i].Grid() != g)
+            LogicError("The batched matrices must share a grid");
+    if (!g.InGrid())
+        return;
+
+    // Form every p'th product, starting with our rank in the grid
+    const int commSize = g.Size();
+    const int commRank = g.VCRank();
+    vector<const Matrix<T>*> APtrs, BPtrs;
+    vector<Matrix<T>*> CPtrs;
+    for (Int i=commRank; i<batchSize; i+=commSize)
+    {
+        APtrs.push_back(&A[i].LockedMatrix());
+        BPtrs.push_back(&B[i].LockedMatrix());
+        CPtrs.push_back(&C[i].Matrix());
+    }
+    GemmMatrixBatch(orientA, orientB, alpha, APtrs, BPtrs, beta, CPtrs);
+    if (commSize == 1)
+        return;
+
+    // Exchange the results
+    vector<int> recvCounts(commSize, 0);
+    for (Int i=0; i<batchSize; ++i)
+        recvCounts[i % commSize] += C[i].Height()*C[i].Width();
+    vector<int> recvDispls;
+    const Int totalRecv = Scan(recvCounts, recvDispls);
+    vector<T> sendBuf, recvBuf;
+    FastResize(sendBuf, recvCounts[commRank]);
+    FastResize(recvBuf, totalRecv);
+    Int offset = 0;
+    for (Int i=commRank; i<batchSize; i+=commSize)
+    {
+        const Int height = C[i].Height();
+        const Int width = C[i].Width();
+        lapack::Copy
+        ('F', height, width, C[i].LockedBuffer(), C[i].LDim(),
+         &sendBuf[offset], height);
+        offset += height*width;
+    }
+    mpi::AllGather
+    (sendBuf.data(), recvCounts[commRank],
+     recvBuf.data(), recvCounts.data(), recvDispls.data(), g.VCComm());
+    auto offsets = recvDispls;
+    for (Int i=0; i<batchSize; ++i)
+    {
+        const int owner = i % commSize;
+        const Int height = C[i].Height();
+        const Int width = C[i].Width();
+        if (owner != commRank)
+            lapack::Copy
+            ('F', height, width, &recvBuf[offsets[owner]], height,
+             C[i].Buffer(), C[i].LDim());
+        offsets[owner] += height*width;
+    }
+}
+
+template<typename T>
+void GemmBatched
+(Orientation orientA, Orientation orientB,
+  T alpha, const vector<DistMatrix<T,CIRC,CIRC>>& A,
+           const vector<DistMatrix<T,CIRC,CIRC>>& B,
+  T beta,        vector<DistMatrix<T,CIRC,CIRC>>& C)
+{
+    EL_DEBUG_CSE
+    const Int batchSize = C.size();
+    if (Int(A.size()) != batchSize || Int(B.size()) != batchSize)
+        LogicError
+        ("Batches of ",A.size(),", ",B.size(),", and ",C.size(),
+         " matrices are incompatible");
+    vector<const Matrix<T>*> APtrs, BPtrs;
+    vector<Matrix<T>*> CPtrs;
+    for (Int i=0; i<batchSize; ++i)
+    {
+        if (A[i].Root() != C[i].Root() || B[i].Root() != C[i].Root())
+            LogicError
+            ("The operands of product ",i," of a batched Gemm must share "
+             "their root");
+        if (C[i].CrossRank() == C[i].Root())
+        {
+            APtrs.push_back(&A[i].LockedMatrix());
+            BPtrs.push_back(&B[i].LockedMatrix());
+            CPtrs.push_back(&C[i].Matrix());
+        }
+    }
+    GemmMatrixBatch(orientA, orientB, alpha, APtrs, BPtrs, beta, CPtrs);
+}
+
+#define PROTO(T) \
+  template void GemmBatched \
+  (Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    T alpha, const T* const* A, Int ALDim, \
+             const T* const* B, Int BLDim, \
+    T beta,        T* const* C, Int CLDim, Int batchSize); \
+  template void GemmStridedBatched \
+  (Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    T alpha, const T* A, Int ALDim, Int strideA, \
+             const T* B, Int BLDim, Int strideB, \
+    T beta,        T* C, Int CLDim, Int strideC, Int batchSize); \
+  template void GemmBatched \
+  (Orientation orientA, Orientation orientB, \
+    T alpha, const vector<Matrix<T>>& A, const vector<Matrix<T>>& B, \
+    T beta,        vector<Matrix<T>>& C); \
+  template void GemmBatched \
+  (Orientation orientA, Orientation orientB, \
+    T alpha, const vector<DistMatrix<T,STAR,STAR>>& A, \
+             const vector<DistMatrix<T,STAR,STAR>>& B, \
+    T beta,        vector<DistMatrix<T,STAR,STAR>>& C); \
+  template void GemmBatched \
+  (Orientation orientA, Orientation orientB, \
+    T alpha, const vector<DistMatrix<T,CIRC,CIRC>>& A, \
+             const vector<DistMatrix<T,CIRC,CIRC>>& B, \
+    T beta,        vector<DistMatrix<T,CIRC,CIRC>>& C);
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,411 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+
+#include <fstream>
+#include <map>
+#include <tuple>
+
+namespace {
+using namespace El;
+
+GemmModel gemmModel;
+bool useGemmModel = false;
+bool calibrateGemm = false;
+
+// Shapes are bucketed by the floor of the base-two logarithm of each
+// dimension so that a single calibration covers nearby problem sizes
+struct GemmTuningKey
+{
+    Int orientA, orientB;
+    Int mBucket, nBucket, kBucket;
+    Int gridHeight, gridWidth;
+    Int typeSize;
+
+    bool operator<( const GemmTuningKey& other ) const
+    {
+        return std::tie
+               (orientA, orientB, mBucket, nBucket, kBucket,
+                gridHeight, gridWidth, typeSize) <
+               std::tie
+               (other.orientA, other.orientB,
+                other.mBucket, other.nBucket, other.kBucket,
+                other.gridHeight, other.gridWidth, other.typeSize);
+    }
+};
+
+// The number of integers used to store a key and its choice in a file
+const Int numTableFields = 10;
+
+std::map<GemmTuningKey,GemmChoice> gemmTuningTable;
+
+Int Bucket( Int dim )
+{
+    Int bucket = 0;
+    while( (Int(2) << bucket) <= dim )
+        ++bucket;
+    return bucket;
+}
+
+GemmTuningKey MakeKey
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, Int typeSize )
+{
+    GemmTuningKey key;
+    key.orientA = OrientationToChar(orientA);
+    key.orientB = OrientationToChar(orientB);
+    key.mBucket = Bucket(m);
+    key.nBucket = Bucket(n);
+    key.kBucket = Bucket(k);
+    key.gridHeight = grid.Height();
+    key.gridWidth = grid.Width();
+    key.typeSize = typeSize;
+    return key;
+}
+
+double Log2Ceil( Int p )
+{
+    double logP = 0;
+    while( (Int(1) << Int(logP)) < p )
+        logP += 1;
+    return logP;
+}
+
+// Rank the stationary variants by the alpha-beta model of their panel
+// collectives plus the cost of the local updates. Stationary C all-gathers
+// panels of A and B, stationary A gathers panels of B and reduce-scatters
+// panels of C, and stationary B does the converse; the pipelined variant
+// hides whichever of its communication and computation is cheaper.
+GemmChoice ModelGemmChoice
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, Int typeSize )
+{
+    const double r = grid.Height();
+    const double c = grid.Width();
+    const double p = grid.Size();
+    const double bsize = Blocksize();
+    const double latency = gemmModel.latency*(Log2Ceil(r)+Log2Ceil(c));
+    const double wordCost = typeSize*gemmModel.inverseBandwidth;
+    const double computeTime = 2.*m*n*k/(p*gemmModel.flopRate);
+
+    const double stepsC = Max(std::ceil(k/bsize),1.);
+    const double commC =
+      stepsC*latency + wordCost*(double(m)*k*(c-1)+double(k)*n*(r-1))/p;
+    const double stepsA = Max(std::ceil(n/bsize),1.);
+    const double commA =
+      stepsA*(latency+gemmModel.latency) +
+      wordCost*(double(k)*n*(r-1)+double(m)*n*(c-1))/p;
+    const double stepsB = Max(std::ceil(m/bsize),1.);
+    const double commB =
+      stepsB*(latency+gemmModel.latency) +
+      wordCost*(double(m)*k*(c-1)+double(m)*n*(r-1))/p;
+
+    GemmChoice choice;
+    choice.alg = GEMM_SUMMA_C;
+    double bestTime = commC + computeTime;
+    if( orientA == NORMAL && orientB == NORMAL )
+    {
+        const double pipelinedTime =
+          Max(commC,computeTime) + commC/stepsC;
+        if( pipelinedTime < bestTime )
+        {
+            choice.alg = GEMM_SUMMA_C_PIPELINED;
+            bestTime = pipelinedTime;
+        }
+    }
+    if( commA + computeTime < bestTime )
+    {
+        choice.alg = GEMM_SUMMA_A;
+        bestTime = commA + computeTime;
+    }
+    if( commB + computeTime < bestTime )
+    {
+        choice.alg = GEMM_SUMMA_B;
+        bestTime = commB + computeTime;
+    }
+    return choice;
+}
+
+// Whether a parsed table entry describes a key which MakeKey could have
+// produced and a choice which Gemm can dispatch, so that a corrupted file is
+// rejected rather than silently dispatched
+bool ValidTableEntry( const Int* entry )
+{
+    for( Int field=0; field<2; ++field )
+        if( entry[field] != 'N' && entry[field] != 'T' && entry[field] != 'C' )
+            return false;
+    for( Int field=2; field<5; ++field )
+        if( entry[field] < 0 )
+            return false;
+    for( Int field=5; field<8; ++field )
+        if( entry[field] < 1 )
+            return false;
+    return entry[8] >= Int(GEMM_DEFAULT) &&
+           entry[8] <= Int(GEMM_SUMMA_25D) && entry[9] >= 0;
+}
+
+} // namespace <anonymous>
+
+namespace El {
+
+void SetGemmModel( const GemmModel& model )
+{
+    if( model.latency < 0 || model.inverseBandwidth < 0 ||
+        model.flopRate <= 0 )
+        LogicError("Invalid Gemm model parameters");
+    ::gemmModel = model;
+}
+
+const GemmModel& GetGemmModel()
+{ return ::gemmModel; }
+
+void SetGemmModelSelection( bool useModel )
+{ ::useGemmModel = useModel; }
+
+bool GemmModelSelection()
+{ return ::useGemmModel; }
+
+void SetGemmCalibration( bool calibrate )
+{ ::calibrateGemm = calibrate; }
+
+bool GemmCalibration()
+{ return ::calibrateGemm; }
+
+template<typename T>
+void CalibrateGemmModel( const Grid& grid )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid.ViewingComm();
+    const int commSize = mpi::Size(comm);
+    Timer timer;
+
+    // The local rate is limited by the slowest process
+    const Int localDim = 512;
+    Matrix<T> A, B, C;
+    Ones(A, localDim, localDim);
+    Ones(B, localDim, localDim);
+    Zeros(C, localDim, localDim);
+    Gemm(NORMAL, NORMAL, T(1), A, B, T(0), C);
+    timer.Start();
+    Gemm(NORMAL, NORMAL, T(1), A, B, T(0), C);
+    double gemmTime = timer.Stop();
+    gemmTime = mpi::AllReduce(gemmTime, mpi::MAX, comm);
+
+    GemmModel model = ::gemmModel;
+    model.flopRate = 2.*localDim*localDim*localDim/Max(gemmTime,1.e-12);
+    if( commSize > 1 )
+    {
+        // A recursive-doubling AllReduce costs roughly one latency per
+        // level for small messages and moves about twice the message size
+        const Int numSmallReps = 100, numLargeReps = 10;
+        const Int largeSize = Int(1) << 18;
+        vector<double> buf(largeSize, 1.);
+        mpi::Barrier(comm);
+        timer.Start();
+        for( Int rep=0; rep<numSmallReps; ++rep )
+            mpi::AllReduce(buf.data(), 1, mpi::SUM, comm);
+        double smallTime = timer.Stop()/numSmallReps;
+        mpi::Barrier(comm);
+        timer.Start();
+        for( Int rep=0; rep<numLargeReps; ++rep )
+            mpi::AllReduce(buf.data(), largeSize, mpi::SUM, comm);
+        double largeTime = timer.Stop()/numLargeReps;
+        smallTime = mpi::AllReduce(smallTime, mpi::MAX, comm);
+        largeTime = mpi::AllReduce(largeTime, mpi::MAX, comm);
+
+        model.latency = smallTime/Log2Ceil(commSize);
+        model.inverseBandwidth =
+          Max(largeTime-smallTime,0.)/(2.*largeSize*sizeof(double));
+    }
+    ::gemmModel = model;
+}
+
+template<typename T>
+GemmChoice SelectGemmAlgorithm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid )
+{
+    EL_DEBUG_CSE
+    const auto key = MakeKey(orientA, orientB, m, n, k, grid, sizeof(T));
+    auto it = ::gemmTuningTable.find(key);
+    if( it != ::gemmTuningTable.end() )
+        return it->second;
+    if( ::calibrateGemm )
+        return CalibrateGemm<T>(orientA, orientB, m, n, k, grid);
+    if( ::useGemmModel )
+        return ModelGemmChoice(orientA, orientB, m, n, k, grid, sizeof(T));
+    return GemmChoice();
+}
+
+template<typename T>
+GemmChoice CalibrateGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, Int numReps )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid.ViewingComm();
+    DistMatrix<T> A(grid), B(grid), C(grid);
+    if( orientA == NORMAL )
+        Ones(A, m, k);
+    else
+        Ones(A, k, m);
+    if( orientB == NORMAL )
+        Ones(B, k, n);
+    else
+        Ones(B, n, k);
+    Zeros(C, m, n);
+
+    vector<GemmAlgorithm> algs{GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C};
+    if( orientA == NORMAL && orientB == NORMAL )
+        algs.push_back(GEMM_SUMMA_C_PIPELINED);
+    const Int blocksizes[] = {64, 128, 256, 512};
+
+    Timer timer;
+    GemmChoice bestChoice;
+    double bestTime = std::numeric_limits<double>::max();
+    for( const auto alg : algs )
+    {
+        for( const Int bsize : blocksizes )
+        {
+            double time;
+            {
+                BlocksizeGuard guard(bsize);
+                mpi::Barrier(comm);
+                timer.Start();
+                for( Int rep=0; rep<numReps; ++rep )
+                    Gemm(orientA, orientB, T(1), A, B, T(0), C, alg);
+                mpi::Barrier(comm);
+                time = timer.Stop();
+            }
+
+            // Every process must reach the same decision
+            time = mpi::AllReduce(time, mpi::MAX, comm);
+            if( time < bestTime )
+            {
+                bestTime = time;
+                bestChoice.alg = alg;
+                bestChoice.blocksize = bsize;
+            }
+        }
+    }
+
+    const auto key = MakeKey(orientA, orientB, m, n, k, grid, sizeof(T));
+    ::gemmTuningTable[key] = bestChoice;
+    return bestChoice;
+}
+
+void LoadGemmTuningTable( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    vector<Int> fields;
+    Int numEntries = 0;
+    string error;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( !file.is_open() )
+            error = BuildString("Could not open ",filename);
+        string line;
+        while( error.empty() && std::getline( file, line ) )
+        {
+            if( line.empty() || line[0] == '#' )
+                continue;
+            std::istringstream lineStream( line );
+            char orientA, orientB;
+            Int entry[numTableFields];
+            lineStream >> orientA >> orientB;
+            entry[0] = orientA;
+            entry[1] = orientB;
+            for( Int field=2; field<numTableFields; ++field )
+                lineStream >> entry[field];
+            if( !lineStream || !ValidTableEntry( entry ) )
+                error = BuildString("Invalid Gemm tuning table entry: ",line);
+            fields.insert( fields.end(), entry, entry+numTableFields );
+            ++numEntries;
+        }
+        if( !error.empty() )
+            numEntries = -1;
+    }
+
+    // A failure on the root is reported to every process before any of
+    // them throws, so that none is left waiting on the entries
+    mpi::Broadcast( numEntries, 0, comm );
+    if( numEntries < 0 )
+    {
+        if( error.empty() )
+            RuntimeError("Could not load Gemm tuning table ",filename);
+        RuntimeError(error);
+    }
+    fields.resize( numEntries*numTableFields );
+    mpi::Broadcast( fields.data(), numEntries*numTableFields, 0, comm );
+
+    for( Int entry=0; entry<numEntries; ++entry )
+    {
+        const Int* f = &fields[entry*numTableFields];
+        GemmTuningKey key;
+        key.orientA = f[0];
+        key.orientB = f[1];
+        key.mBucket = f[2];
+        key.nBucket = f[3];
+        key.kBucket = f[4];
+        key.gridHeight = f[5];
+        key.gridWidth = f[6];
+        key.typeSize = f[7];
+        GemmChoice choice;
+        choice.alg = static_cast<GemmAlgorithm>(f[8]);
+        choice.blocksize = f[9];
+        ::gemmTuningTable[key] = choice;
+    }
+}
+
+void SaveGemmTuningTable( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# orientA orientB log2(m) log2(n) log2(k) gridHeight gridWidth "
+         << "typeSize algorithm blocksize\n";
+    for( const auto& entry : ::gemmTuningTable )
+    {
+        const auto& key = entry.first;
+        const auto& choice = entry.second;
+        file << char(key.orientA) << " " << char(key.orientB) << " "
+             << key.mBucket << " " << key.nBucket << " " << key.kBucket << " "
+             << key.gridHeight << " " << key.gridWidth << " "
+             << key.typeSize << " "
+             << Int(choice.alg) << " " << choice.blocksize << "\n";
+    }
+}
+
+void ClearGemmTuningTable()
+{ ::gemmTuningTable.clear(); }
+
+#define PROTO(T) \
+  template void CalibrateGemmModel<T>( const Grid& grid ); \
+  template GemmChoice SelectGemmAlgorithm<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& grid ); \
+  template GemmChoice CalibrateGemm<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& grid, Int numReps );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Syrk/TS.hpp"
 #include "./Syrk/LN.hpp"
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
@@ -73,6 +74,7 @@ void Syrk
   T beta,        AbstractDistMatrix<T>& C, bool conjugate )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Syrk");
     ScaleTrapezoid( beta, uplo, C );
     if( uplo == LOWER && orientation == NORMAL )
         syrk::LN( alpha, A, C, conjugate );
@@ -154,7 +154,13 @@ void LN
     const Int blockSizeDot = 2000;
 
     if( r > weightAwayFromDot*n ) 
-        LN_Dot( alpha, A, C, conjugate, blockSizeDot );
+    {
+        // Small Gram matrices are reduced directly into their owners
+        if( n <= blockSizeDot )
+            TS( LOWER, NORMAL, alpha, A, C, conjugate );
+        else
+            LN_Dot( alpha, A, C, conjugate, blockSizeDot );
+    }
     else
         LN_C( alpha, A, C, conjugate );
 }
@@ -121,7 +121,13 @@ void LT
     const Int blockSizeDot = 2000;
 
     if( r > weightAwayFromDot*n )
-        LT_Dot( alpha, A, C, conjugate, blockSizeDot );
+    {
+        // Small Gram matrices are reduced directly into their owners
+        if( n <= blockSizeDot )
+            TS( LOWER, TRANSPOSE, alpha, A, C, conjugate );
+        else
+            LT_Dot( alpha, A, C, conjugate, blockSizeDot );
+    }
     else
         LT_C( alpha, A, C, conjugate );
 }
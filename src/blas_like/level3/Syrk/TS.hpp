@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// Tall-skinny Syrk,
+//   C := alpha A^{T/H} A + C, with A in a [VC,* ] distribution, or
+//   C := alpha A A^{T/H} + C, with A in a [* ,VC] distribution.
+//
+// Every process forms the requested triangle of the Gram matrix of its
+// local rows (columns) with a single local Syrk, and only the entries of
+// that triangle are summed, with a ReduceScatter over the entire grid which
+// delivers each of them directly to its owner in C[MC,MR]. Relative to
+// contracting the full square, this halves both the flops and the volume of
+// the reduction.
+template<typename T>
+void TS
+( UpperOrLower uplo, Orientation orientation,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+        AbstractDistMatrix<T>& CPre,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("syrk::TS");
+    const Int n = CPre.Height();
+    const Grid& g = APre.Grid();
+
+    // Z := alpha A_loc^{T/H} A_loc, or alpha A_loc A_loc^{T/H}
+    Matrix<T> Z;
+    if( orientation == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,STAR,VC> AProx( APre );
+        auto& A = AProx.GetLocked();
+        Syrk( uplo, NORMAL, alpha, A.LockedMatrix(), Z, conjugate );
+    }
+    else
+    {
+        DistMatrixReadProxy<T,T,VC,STAR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        Syrk
+        ( uplo, (conjugate ? ADJOINT : TRANSPOSE),
+          alpha, A.LockedMatrix(), Z, conjugate );
+    }
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+    if( !C.Participating() || n == 0 )
+        return;
+
+    const Int colStride = C.ColStride();
+    const Int rowStride = C.RowStride();
+    const Int colAlign = C.ColAlign();
+    const Int rowAlign = C.RowAlign();
+    const Int p = colStride*rowStride;
+    const bool lower = ( uplo == LOWER );
+
+    // Count the entries of the triangle owned by each process, which is
+    // indexed by its rank in the [VC,* ] communicator
+    vector<Int> counts( p, 0 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int ownerCol = Mod( j+rowAlign, rowStride );
+        const Int iBeg = ( lower ? j : 0 );
+        const Int iEnd = ( lower ? n : j+1 );
+        for( Int i=iBeg; i<iEnd; ++i )
+            ++counts[Mod(i+colAlign,colStride)+ownerCol*colStride];
+    }
+    Int portionSize = 0;
+    for( Int q=0; q<p; ++q )
+        portionSize = Max( portionSize, counts[q] );
+
+    // Pack the triangle in column-major order within each portion
+    vector<T> sendBuf( p*portionSize ), recvBuf( portionSize );
+    vector<Int> offsets( p );
+    for( Int q=0; q<p; ++q )
+        offsets[q] = q*portionSize;
+    const T* ZBuf = Z.LockedBuffer();
+    const Int ZLDim = Z.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        const Int ownerCol = Mod( j+rowAlign, rowStride );
+        const Int iBeg = ( lower ? j : 0 );
+        const Int iEnd = ( lower ? n : j+1 );
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            const Int q = Mod(i+colAlign,colStride) + ownerCol*colStride;
+            sendBuf[offsets[q]++] = ZBuf[i+j*ZLDim];
+        }
+    }
+
+    mpi::ReduceScatter
+    ( sendBuf.data(), recvBuf.data(), portionSize, g.VCComm() );
+
+    // Unpack our portion in the same order in which it was packed
+    const Int colShift = C.ColShift();
+    const Int rowShift = C.RowShift();
+    const Int localWidth = C.LocalWidth();
+    T* CBuf = C.Buffer();
+    const Int CLDim = C.LDim();
+    Int offset = 0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = rowShift + jLoc*rowStride;
+        const Int iLocBeg =
+          ( lower ? Length(j,colShift,colStride) : 0 );
+        const Int iLocEnd =
+          ( lower ? C.LocalHeight() : Length(j+1,colShift,colStride) );
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            CBuf[iLoc+jLoc*CLDim] += recvBuf[offset++];
+    }
+}
+
+} // namespace syrk
+} // namespace El
@@ -117,7 +117,13 @@ void UN
     const Int blockSizeDot = 2000;
 
     if( r > weightAwayFromDot*n )
-        UN_Dot( alpha, A, C, conjugate, blockSizeDot );
+    {
+        // Small Gram matrices are reduced directly into their owners
+        if( n <= blockSizeDot )
+            TS( UPPER, NORMAL, alpha, A, C, conjugate );
+        else
+            UN_Dot( alpha, A, C, conjugate, blockSizeDot );
+    }
     else
         UN_C( alpha, A, C, conjugate );
 }
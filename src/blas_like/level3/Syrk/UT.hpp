@@ -121,7 +121,13 @@ void UT
     const Int blockSizeDot = 2000;
 
     if( r > weightAwayFromDot*n )
-        UT_Dot( alpha, A, C, conjugate, blockSizeDot );
+    {
+        // Small Gram matrices are reduced directly into their owners
+        if( n <= blockSizeDot )
+            TS( UPPER, TRANSPOSE, alpha, A, C, conjugate );
+        else
+            UT_Dot( alpha, A, C, conjugate, blockSizeDot );
+    }
     else
         UT_C( alpha, A, C, conjugate );
 }
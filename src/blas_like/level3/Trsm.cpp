@@ -29,8 +29,72 @@ void Trsm
   Orientation orientation,
   UnitOrNonUnit diag,
   F alpha,
-  const Matrix<F>& A,
-        Matrix<F>& B,
+  const AbstractMatrix<F>& A,
+        AbstractMatrix<F>& B,
+  bool checkIfSingular )
+{
+    if( A.GetDevice() != B.GetDevice() )
+        LogicError("Must call Trsm with matrices on same device.");
+
+    switch( A.GetDevice() )
+    {
+    case Device::CPU:
+        Trsm
+        ( side, uplo, orientation, diag, alpha,
+          static_cast<const Matrix<F,Device::CPU>&>(A),
+          static_cast<Matrix<F,Device::CPU>&>(B), checkIfSingular );
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        Trsm
+        ( side, uplo, orientation, diag, alpha,
+          static_cast<const Matrix<F,Device::GPU>&>(A),
+          static_cast<Matrix<F,Device::GPU>&>(B), checkIfSingular );
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("Bad device type.");
+    }
+}
+
+namespace
+{
+
+template <Device D> struct BLASHelper;
+
+template <>
+struct BLASHelper<Device::CPU>
+{
+    template <typename... Ts>
+    static void Trsm(Ts&&... args)
+    {
+        blas::Trsm(std::forward<Ts>(args)...);
+    }
+};// struct BLASHelper<Device::CPU>
+
+#ifdef HYDROGEN_HAVE_CUDA
+template <>
+struct BLASHelper<Device::GPU>
+{
+    template <typename... Ts>
+    static void Trsm(Ts&&... args)
+    {
+        cublas::Trsm(std::forward<Ts>(args)...);
+    }
+};// struct BLASHelper<Device::GPU>
+#endif // HYDROGEN_HAVE_CUDA
+
+}// namespace <anon>
+
+template<typename F, Device D, typename>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const Matrix<F,D>& A,
+        Matrix<F,D>& B,
   bool checkIfSingular )
 {
     EL_DEBUG_CSE
@@ -59,57 +123,35 @@ void Trsm
             if( A.Get(j,j) == F(0) )
                 throw SingularMatrixException();
     }
-    blas::Trsm
+    EL_PROFILE_REGION("blas::Trsm");
+    ProfileFlops
+    ( (IsComplex<F>::value ? 4. : 1.)*A.Height()*B.Height()*B.Width() );
+    BLASHelper<D>::Trsm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 }
 
-// TODO: Make the TRSM_DEFAULT switching mechanism smarter (perhaps, empirical)
-template<typename F>
+template<typename F, Device D, typename, typename>
 void Trsm
+( LeftOrRight, UpperOrLower, Orientation, UnitOrNonUnit, F,
+  const Matrix<F,D>&, Matrix<F,D>&, bool )
+{
+    LogicError("Trsm: Bad device/type combination.");
+}
+
+namespace trsm {
+
+template<Device D,typename F,typename=EnableIf<IsDeviceValidType<F,D>>>
+void Trsm_impl
 ( LeftOrRight side,
   UpperOrLower uplo,
   Orientation orientation,
   UnitOrNonUnit diag,
-  F alpha,
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
   bool checkIfSingular, TrsmAlgorithm alg )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameGrids( A, B );
-      if( A.Height() != A.Width() )
-          LogicError("A must be square");
-      if( side == LEFT )
-      {
-          if( A.Height() != B.Height() )
-              LogicError("Nonconformal Trsm");
-      }
-      else
-      {
-          if( A.Height() != B.Width() )
-              LogicError("Nonconformal Trsm");
-      }
-    )
-    B *= alpha;
-
-    // Call the single right-hand side algorithm if appropriate
-    if( side == LEFT && B.Width() == 1 )
-    {
-        Trsv( uplo, orientation, diag, A, B );
-        return;
-    }
-    // TODO: Compute appropriate transpose/conjugation options to convert
-    //       to Trsv.
-    /*
-    else if( side == RIGHT && B.Height() == 1 )
-    {
-        Trsv( uplo, orientation, diag, A, B );
-        return;
-    }
-    */
-
     const Int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
     {
@@ -118,14 +160,21 @@ void Trsm
             if( alg == TRSM_DEFAULT )
             {
                 if( B.Width() > 5*p )
-                    trsm::LLNLarge( diag, A, B, checkIfSingular );
+                    LLNLarge<D>( diag, A, B, checkIfSingular );
                 else
-                    trsm::LLNMedium( diag, A, B, checkIfSingular );
+                    LLNMedium<D>( diag, A, B, checkIfSingular );
             }
             else if( alg == TRSM_LARGE )
-                trsm::LLNLarge( diag, A, B, checkIfSingular );
+                LLNLarge<D>( diag, A, B, checkIfSingular );
+            else if( alg == TRSM_LARGE_LOOKAHEAD )
+            {
+                if( D == Device::CPU )
+                    LLNLargeLookahead( diag, A, B, checkIfSingular );
+                else
+                    LLNLarge<D>( diag, A, B, checkIfSingular );
+            }
             else if( alg == TRSM_MEDIUM )
-                trsm::LLNMedium( diag, A, B, checkIfSingular );
+                LLNMedium<D>( diag, A, B, checkIfSingular );
             else if( alg == TRSM_SMALL )
             {
                 if( A.ColDist() == VR )
@@ -140,7 +189,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VR,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LLNSmall( diag, APost, BPost, checkIfSingular );
+                    LLNSmall( diag, APost, BPost, checkIfSingular );
                 }
                 else
                 {
@@ -154,7 +203,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LLNSmall( diag, APost, BPost, checkIfSingular );
+                    LLNSmall( diag, APost, BPost, checkIfSingular );
                 }
             }
             else
@@ -165,14 +214,14 @@ void Trsm
             if( alg == TRSM_DEFAULT )
             {
                 if( B.Width() > 5*p )
-                    trsm::LLTLarge( orientation, diag, A, B, checkIfSingular );
+                    LLTLarge<D>( orientation, diag, A, B, checkIfSingular );
                 else
-                    trsm::LLTMedium( orientation, diag, A, B, checkIfSingular );
+                    LLTMedium<D>( orientation, diag, A, B, checkIfSingular );
             }
             else if( alg == TRSM_LARGE )
-                trsm::LLTLarge( orientation, diag, A, B, checkIfSingular );
+                LLTLarge<D>( orientation, diag, A, B, checkIfSingular );
             else if( alg == TRSM_MEDIUM )
-                trsm::LLTMedium( orientation, diag, A, B, checkIfSingular );
+                LLTMedium<D>( orientation, diag, A, B, checkIfSingular );
             else if( alg == TRSM_SMALL )
             {
                 if( A.ColDist() == VR )
@@ -187,7 +236,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VR,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LLTSmall
+                    LLTSmall
                     ( orientation, diag, APost, BPost, checkIfSingular );
                 }
                 else if( A.RowDist() == VC )
@@ -202,7 +251,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LLTSmall
+                    LLTSmall
                     ( orientation, diag, APost, BPost, checkIfSingular );
                 }
                 else if( A.RowDist() == VR )
@@ -217,7 +266,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VR,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LLTSmall
+                    LLTSmall
                     ( orientation, diag, APost, BPost, checkIfSingular );
                 }
                 else
@@ -232,7 +281,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LLTSmall
+                    LLTSmall
                     ( orientation, diag, APost, BPost, checkIfSingular );
                 }
             }
@@ -247,14 +296,21 @@ void Trsm
             if( alg == TRSM_DEFAULT )
             {
                 if( B.Width() > 5*p )
-                    trsm::LUNLarge( diag, A, B, checkIfSingular );
+                    LUNLarge<D>( diag, A, B, checkIfSingular );
                 else
-                    trsm::LUNMedium( diag, A, B, checkIfSingular );
+                    LUNMedium<D>( diag, A, B, checkIfSingular );
             }
             else if( alg == TRSM_LARGE )
-                trsm::LUNLarge( diag, A, B, checkIfSingular );
+                LUNLarge<D>( diag, A, B, checkIfSingular );
+            else if( alg == TRSM_LARGE_LOOKAHEAD )
+            {
+                if( D == Device::CPU )
+                    LUNLargeLookahead( diag, A, B, checkIfSingular );
+                else
+                    LUNLarge<D>( diag, A, B, checkIfSingular );
+            }
             else if( alg == TRSM_MEDIUM )
-                trsm::LUNMedium( diag, A, B, checkIfSingular );
+                LUNMedium<D>( diag, A, B, checkIfSingular );
             else if( alg == TRSM_SMALL )
             {
                 if( A.ColDist() == VR )
@@ -269,7 +325,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VR,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LUNSmall( diag, APost, BPost, checkIfSingular );
+                    LUNSmall( diag, APost, BPost, checkIfSingular );
                 }
                 else
                 {
@@ -283,7 +339,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LUNSmall( diag, APost, BPost, checkIfSingular );
+                    LUNSmall( diag, APost, BPost, checkIfSingular );
                 }
             }
             else
@@ -294,14 +350,14 @@ void Trsm
             if( alg == TRSM_DEFAULT )
             {
                 if( B.Width() > 5*p )
-                    trsm::LUTLarge( orientation, diag, A, B, checkIfSingular );
+                    LUTLarge<D>( orientation, diag, A, B, checkIfSingular );
                 else
-                    trsm::LUTMedium( orientation, diag, A, B, checkIfSingular );
+                    LUTMedium<D>( orientation, diag, A, B, checkIfSingular );
             }
             else if( alg == TRSM_LARGE )
-                trsm::LUTLarge( orientation, diag, A, B, checkIfSingular );
+                LUTLarge<D>( orientation, diag, A, B, checkIfSingular );
             else if( alg == TRSM_MEDIUM )
-                trsm::LUTMedium( orientation, diag, A, B, checkIfSingular );
+                LUTMedium<D>( orientation, diag, A, B, checkIfSingular );
             else if( alg == TRSM_SMALL )
             {
                 if( A.RowDist() == VC )
@@ -316,7 +372,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LUTSmall
+                    LUTSmall
                     ( orientation, diag, APost, BPost, checkIfSingular );
                 }
                 else
@@ -331,7 +387,7 @@ void Trsm
                     DistMatrixReadWriteProxy<F,F,VR,STAR> BProx( B, ctrl );
                     auto& BPost = BProx.Get();
 
-                    trsm::LUTSmall
+                    LUTSmall
                     ( orientation, diag, APost, BPost, checkIfSingular );
                 }
             }
@@ -344,14 +400,14 @@ void Trsm
         if( orientation == NORMAL )
         {
             if( alg == TRSM_DEFAULT )
-                trsm::RLN( diag, A, B, checkIfSingular );
+                RLN<D>( diag, A, B, checkIfSingular );
             else
                 LogicError("Unsupported TRSM algorithm");
         }
         else
         {
             if( alg == TRSM_DEFAULT )
-                trsm::RLT( orientation, diag, A, B, checkIfSingular );
+                RLT<D>( orientation, diag, A, B, checkIfSingular );
             else
                 LogicError("Unsupported TRSM algorithm");
         }
@@ -361,28 +417,87 @@ void Trsm
         if( orientation == NORMAL )
         {
             if( alg == TRSM_DEFAULT )
-                trsm::RUN( diag, A, B, checkIfSingular );
+                RUN<D>( diag, A, B, checkIfSingular );
             else
                 LogicError("Unsupported TRSM algorithm");
         }
         else
         {
             if( alg == TRSM_DEFAULT )
-                trsm::RUT( orientation, diag, A, B, checkIfSingular );
+                RUT<D>( orientation, diag, A, B, checkIfSingular );
             else
                 LogicError("Unsupported TRSM algorithm");
         }
     }
 }
 
+template<Device D,typename F,
+         typename=DisableIf<IsDeviceValidType<F,D>>,typename=void>
+void Trsm_impl
+( LeftOrRight, UpperOrLower, Orientation, UnitOrNonUnit,
+  const AbstractDistMatrix<F>&, AbstractDistMatrix<F>&, bool, TrsmAlgorithm )
+{
+    LogicError("Trsm_impl type-device combo not supported.");
+}
+
+} // namespace trsm
+
+// TODO: Make the TRSM_DEFAULT switching mechanism smarter (perhaps, empirical)
 template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& B,
+  bool checkIfSingular, TrsmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( side == LEFT )
+      {
+          if( A.Height() != B.Height() )
+              LogicError("Nonconformal Trsm");
+      }
+      else
+      {
+          if( A.Height() != B.Width() )
+              LogicError("Nonconformal Trsm");
+      }
+    )
+    EL_PROFILE_REGION("Trsm");
+    B *= alpha;
+
+    switch( B.GetLocalDevice() )
+    {
+    case Device::CPU:
+        trsm::Trsm_impl<Device::CPU>
+        ( side, uplo, orientation, diag, A, B, checkIfSingular, alg );
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        trsm::Trsm_impl<Device::GPU>
+        ( side, uplo, orientation, diag, A, B, checkIfSingular, alg );
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("Trsm: Bad device.");
+    }
+}
+
+template<typename F,Device D>
 void LocalTrsm
 ( LeftOrRight side,
   UpperOrLower uplo,
   Orientation orientation,
   UnitOrNonUnit diag,
   F alpha,
-  const DistMatrix<F,STAR,STAR>& A,
+  const DistMatrix<F,STAR,STAR,ELEMENT,D>& A,
         AbstractDistMatrix<F>& X,
   bool checkIfSingular )
 {
@@ -398,6 +513,31 @@ void LocalTrsm
       alpha, A.LockedMatrix(), X.Matrix(), checkIfSingular );
 }
 
+#ifdef HYDROGEN_HAVE_CUDA
+#define GPU_PROTO(F) \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const Matrix<F,Device::GPU>& A, \
+          Matrix<F,Device::GPU>& B, \
+    bool checkIfSingular ); \
+  template void LocalTrsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const DistMatrix<F,STAR,STAR,ELEMENT,Device::GPU>& A, \
+          AbstractDistMatrix<F>& X, \
+    bool checkIfSingular );
+
+GPU_PROTO(float)
+GPU_PROTO(double)
+#endif // HYDROGEN_HAVE_CUDA
+
 #define PROTO(F) \
   template void Trsm \
   ( LeftOrRight side, \
@@ -405,8 +545,17 @@ void LocalTrsm
     Orientation orientation, \
     UnitOrNonUnit diag, \
     F alpha, \
-    const Matrix<F>& A, \
-          Matrix<F>& B, \
+    const AbstractMatrix<F>& A, \
+          AbstractMatrix<F>& B, \
+    bool checkIfSingular ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const Matrix<F,Device::CPU>& A, \
+          Matrix<F,Device::CPU>& B, \
     bool checkIfSingular ); \
   template void Trsm \
   ( LeftOrRight side, \
@@ -424,7 +573,7 @@ void LocalTrsm
     Orientation orientation, \
     UnitOrNonUnit diag, \
     F alpha, \
-    const DistMatrix<F,STAR,STAR>& A, \
+    const DistMatrix<F,STAR,STAR,ELEMENT,Device::CPU>& A, \
           AbstractDistMatrix<F>& X, \
     bool checkIfSingular );
 
@@ -15,7 +15,7 @@ namespace trsm {
 //   X := trilu(L)^-1 X
 
 // For large numbers of RHS's, e.g., width(X) >> p
-template<typename F>
+template<Device D,typename F>
 void LLNLarge
 ( UnitOrNonUnit diag, 
   const AbstractDistMatrix<F>& LPre,
@@ -27,15 +27,15 @@ void LLNLarge
     const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> L11_STAR_STAR(g);
+    DistMatrix<F,MC,STAR,ELEMENT,D> L21_MC_STAR(g);
+    DistMatrix<F,STAR,MR,ELEMENT,D> X1_STAR_MR(g);
+    DistMatrix<F,STAR,VR,ELEMENT,D> X1_STAR_VR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -69,8 +69,156 @@ void LLNLarge
     }
 }
 
-// For medium numbers of RHS's, e.g., width(X) ~= p
+// For large numbers of RHS's, with a lookahead of one diagonal block
+//
+// The panel L(k:m,k:k+nb) and the block row X(k:k+nb,:) are gathered
+// directly from the local data with nonblocking AllGathers. The panel for
+// block k+1 only depends upon L, so its gather is started as soon as the
+// current panel has arrived, while the next block row of X is updated ahead
+// of the rest of X2 so that its gather can be started before, and overlap
+// with, the trailing update X2 -= L21 X1.
 template<typename F>
+void LLNLargeLookahead
+( UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& LPre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Int m = XPre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = LPre.Grid();
+    const Int colStride = g.Height();
+    const Int rowStride = g.Width();
+    mpi::Comm colComm = g.ColComm();
+    mpi::Comm rowComm = g.RowComm();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    // Force L to share the column distribution of X so that the gathered
+    // panels of L line up with the rows of X
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = X.ColAlign();
+
+    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre, ctrl );
+    auto& L = LProx.GetLocked();
+
+    // Every panel is packed into portions sized for the tallest one
+    const Int localWidthX = X.LocalWidth();
+    const Int portionSizeL = L.LocalHeight()*MaxLength(bsize,rowStride);
+    const Int portionSizeX = MaxLength(bsize,colStride)*localWidthX;
+
+    simple_buffer<F,Device::CPU> sendL, recvL, sendX, recvX;
+    sendL.allocate( portionSizeL );
+    recvL.allocate( rowStride*portionSizeL );
+    sendX.allocate( portionSizeX );
+    recvX.allocate( colStride*portionSizeX );
+    mpi::Request<F> requestL, requestX;
+
+    auto startPanel = [&]( Int k )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto LPan = L( IR(k,m), IR(k,k+nb) );
+        copy::util::InterleaveMatrix<F,Device::CPU>
+        ( LPan.LocalHeight(), LPan.LocalWidth(),
+          LPan.LockedBuffer(), 1, LPan.LDim(),
+          sendL.data(), 1, LPan.LocalHeight() );
+        mpi::IAllGather
+        ( sendL.data(), portionSizeL,
+          recvL.data(), portionSizeL, rowComm, requestL );
+    };
+    auto startRow = [&]( Int k )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto X1 = X( IR(k,k+nb), ALL );
+        copy::util::InterleaveMatrix<F,Device::CPU>
+        ( X1.LocalHeight(), localWidthX,
+          X1.LockedBuffer(), 1, X1.LDim(),
+          sendX.data(), 1, X1.LocalHeight() );
+        mpi::IAllGather
+        ( sendX.data(), portionSizeX,
+          recvX.data(), portionSizeX, colComm, requestX );
+    };
+
+    DistMatrix<F,MC,  STAR> LPan_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
+    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
+    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    X1_STAR_MR.AlignWith( X );
+
+    if( m > 0 )
+    {
+        startPanel( 0 );
+        startRow( 0 );
+    }
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+        const Int nbNext = Min(bsize,m-(k+nb));
+
+        auto LPan = L( IR(k,m), IR(k,k+nb) );
+        auto X1 = X( IR(k,k+nb), ALL );
+        auto XBot = X( IR(k,m), ALL );
+
+        // LPan[MC,* ] <- LPan[MC,MR]
+        LPan_MC_STAR.AlignWith( XBot );
+        LPan_MC_STAR.Resize( m-k, nb );
+        mpi::Wait( requestL );
+        copy::util::RowStridedUnpack<F,Device::CPU>
+        ( LPan.LocalHeight(), nb, LPan.RowAlign(), rowStride,
+          recvL.data(), portionSizeL,
+          LPan_MC_STAR.Buffer(), LPan_MC_STAR.LDim() );
+        if( nbNext > 0 )
+            startPanel( k+nb );
+
+        auto L11_MC_STAR = LPan_MC_STAR( IR(0,nb), ALL );
+        L11_STAR_STAR = L11_MC_STAR; // L11[* ,* ] <- L11[MC,* ]
+
+        // X1[* ,VR] <- X1[* ,MR] <- X1[MC,MR]
+        X1_STAR_MR.Resize( nb, X.Width() );
+        mpi::Wait( requestX );
+        copy::util::ColStridedUnpack<F,Device::CPU>
+        ( nb, localWidthX, X1.ColAlign(), colStride,
+          recvX.data(), portionSizeX,
+          X1_STAR_MR.Buffer(), X1_STAR_MR.LDim() );
+        X1_STAR_VR = X1_STAR_MR;
+
+        // X1[* ,VR] := L11^-1[* ,* ] X1[* ,VR]
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, diag, F(1), L11_STAR_STAR, X1_STAR_VR,
+          checkIfSingular );
+
+        X1_STAR_MR = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
+        X1         = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
+        if( nbNext == 0 )
+            break;
+
+        const Range<Int> indNext( k+nb, k+nb+nbNext ),
+                         indRest( k+nb+nbNext, m );
+        auto L21Next_MC_STAR = LPan_MC_STAR( IR(nb,nb+nbNext), ALL );
+        auto L21Rest_MC_STAR = LPan_MC_STAR( IR(nb+nbNext,END), ALL );
+        auto XNext = X( indNext, ALL );
+        auto XRest = X( indRest, ALL );
+
+        // XNext[MC,MR] -= L21Next[MC,* ] X1[* ,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), L21Next_MC_STAR, X1_STAR_MR, F(1), XNext );
+        startRow( k+nb );
+
+        // XRest[MC,MR] -= L21Rest[MC,* ] X1[* ,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), L21Rest_MC_STAR, X1_STAR_MR, F(1), XRest );
+    }
+#else
+    LLNLarge<Device::CPU>( diag, LPre, XPre, checkIfSingular );
+#endif // EL_HAVE_NONBLOCKING_COLLECTIVES
+}
+
+// For medium numbers of RHS's, e.g., width(X) ~= p
+template<Device D,typename F>
 void LLNMedium
 ( UnitOrNonUnit diag, 
   const AbstractDistMatrix<F>& LPre,
@@ -82,14 +230,14 @@ void LLNMedium
     const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> L11_STAR_STAR(g);
+    DistMatrix<F,MC,STAR,ELEMENT,D> L21_MC_STAR(g);
+    DistMatrix<F,MR,STAR,ELEMENT,D> X1Trans_MR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -17,7 +17,7 @@ namespace trsm {
 //   X := trilu(L)^-H
 
 // width(X) >> p
-template<typename F>
+template<Device D,typename F>
 void LLTLarge
 ( Orientation orientation,
   UnitOrNonUnit diag,
@@ -34,15 +34,15 @@ void LLTLarge
     const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    DistMatrix<F,STAR,MC,ELEMENT,D> L10_STAR_MC(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> L11_STAR_STAR(g);
+    DistMatrix<F,STAR,MR,ELEMENT,D> X1_STAR_MR(g);
+    DistMatrix<F,STAR,VR,ELEMENT,D> X1_STAR_VR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -80,7 +80,7 @@ void LLTLarge
 }
 
 // width(X) ~= p
-template<typename F>
+template<Device D,typename F>
 void LLTMedium
 ( Orientation orientation,
   UnitOrNonUnit diag,
@@ -97,14 +97,14 @@ void LLTMedium
     const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    DistMatrix<F,STAR,MC,ELEMENT,D> L10_STAR_MC(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> L11_STAR_STAR(g);
+    DistMatrix<F,MR,STAR,ELEMENT,D> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -14,7 +14,7 @@ namespace trsm {
 //   X := triu(U)^-1  X, or
 //   X := triuu(U)^-1 X
 
-template<typename F>
+template<Device D,typename F>
 void LUNLarge
 ( UnitOrNonUnit diag,
   const AbstractDistMatrix<F>& UPre,
@@ -26,15 +26,15 @@ void LUNLarge
     const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    DistMatrix<F,MC,STAR,ELEMENT,D> U01_MC_STAR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> U11_STAR_STAR(g);
+    DistMatrix<F,STAR,MR,ELEMENT,D> X1_STAR_MR(g);
+    DistMatrix<F,STAR,VR,ELEMENT,D> X1_STAR_VR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -69,7 +69,153 @@ void LUNLarge
     }
 }
 
+// For large numbers of RHS's, with a lookahead of one diagonal block
+//
+// The mirror image of LLNLargeLookahead: the panel U(0:k+nb,k:k+nb) and the
+// block row X(k:k+nb,:) are gathered with nonblocking AllGathers, and the
+// block row above the current one is updated first so that its gather
+// overlaps the update of the remainder of X0.
 template<typename F>
+void LUNLargeLookahead
+( UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& UPre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Int m = XPre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = UPre.Grid();
+    const Int colStride = g.Height();
+    const Int rowStride = g.Width();
+    mpi::Comm colComm = g.ColComm();
+    mpi::Comm rowComm = g.RowComm();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& X = XProx.Get();
+
+    // Force U to share the column distribution of X so that the gathered
+    // panels of U line up with the rows of X
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = X.ColAlign();
+
+    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre, ctrl );
+    auto& U = UProx.GetLocked();
+
+    // Every panel is packed into portions sized for the tallest one
+    const Int localWidthX = X.LocalWidth();
+    const Int portionSizeU = U.LocalHeight()*MaxLength(bsize,rowStride);
+    const Int portionSizeX = MaxLength(bsize,colStride)*localWidthX;
+
+    simple_buffer<F,Device::CPU> sendU, recvU, sendX, recvX;
+    sendU.allocate( portionSizeU );
+    recvU.allocate( rowStride*portionSizeU );
+    sendX.allocate( portionSizeX );
+    recvX.allocate( colStride*portionSizeX );
+    mpi::Request<F> requestU, requestX;
+
+    auto startPanel = [&]( Int k )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto UPan = U( IR(0,k+nb), IR(k,k+nb) );
+        copy::util::InterleaveMatrix<F,Device::CPU>
+        ( UPan.LocalHeight(), UPan.LocalWidth(),
+          UPan.LockedBuffer(), 1, UPan.LDim(),
+          sendU.data(), 1, UPan.LocalHeight() );
+        mpi::IAllGather
+        ( sendU.data(), portionSizeU,
+          recvU.data(), portionSizeU, rowComm, requestU );
+    };
+    auto startRow = [&]( Int k )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto X1 = X( IR(k,k+nb), ALL );
+        copy::util::InterleaveMatrix<F,Device::CPU>
+        ( X1.LocalHeight(), localWidthX,
+          X1.LockedBuffer(), 1, X1.LDim(),
+          sendX.data(), 1, X1.LocalHeight() );
+        mpi::IAllGather
+        ( sendX.data(), portionSizeX,
+          recvX.data(), portionSizeX, colComm, requestX );
+    };
+
+    DistMatrix<F,MC,  STAR> UPan_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
+    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
+    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    UPan_MC_STAR.AlignWith( X );
+    X1_STAR_MR.AlignWith( X );
+
+    const Int kLast = LastOffset( m, bsize );
+    if( m > 0 )
+    {
+        startPanel( kLast );
+        startRow( kLast );
+    }
+    for( Int k=kLast; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+
+        auto UPan = U( IR(0,k+nb), IR(k,k+nb) );
+        auto X1 = X( IR(k,k+nb), ALL );
+
+        // UPan[MC,* ] <- UPan[MC,MR]
+        UPan_MC_STAR.Resize( k+nb, nb );
+        mpi::Wait( requestU );
+        copy::util::RowStridedUnpack<F,Device::CPU>
+        ( UPan.LocalHeight(), nb, UPan.RowAlign(), rowStride,
+          recvU.data(), portionSizeU,
+          UPan_MC_STAR.Buffer(), UPan_MC_STAR.LDim() );
+        if( k > 0 )
+            startPanel( k-bsize );
+
+        auto U11_MC_STAR = UPan_MC_STAR( IR(k,k+nb), ALL );
+        U11_STAR_STAR = U11_MC_STAR; // U11[* ,* ] <- U11[MC,* ]
+
+        // X1[* ,VR] <- X1[* ,MR] <- X1[MC,MR]
+        X1_STAR_MR.Resize( nb, X.Width() );
+        mpi::Wait( requestX );
+        copy::util::ColStridedUnpack<F,Device::CPU>
+        ( nb, localWidthX, X1.ColAlign(), colStride,
+          recvX.data(), portionSizeX,
+          X1_STAR_MR.Buffer(), X1_STAR_MR.LDim() );
+        X1_STAR_VR = X1_STAR_MR;
+
+        // X1[* ,VR] := U11^-1[* ,* ] X1[* ,VR]
+        LocalTrsm
+        ( LEFT, UPPER, NORMAL, diag, F(1), U11_STAR_STAR, X1_STAR_VR,
+          checkIfSingular );
+
+        X1_STAR_MR = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
+        X1         = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
+        if( k == 0 )
+            break;
+
+        const Int kNext = k-bsize;
+        const Range<Int> indNext( kNext, k ),
+                         indRest( 0, kNext );
+        auto U01Next_MC_STAR = UPan_MC_STAR( indNext, ALL );
+        auto U01Rest_MC_STAR = UPan_MC_STAR( indRest, ALL );
+        auto XNext = X( indNext, ALL );
+        auto XRest = X( indRest, ALL );
+
+        // XNext[MC,MR] -= U01Next[MC,* ] X1[* ,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), U01Next_MC_STAR, X1_STAR_MR, F(1), XNext );
+        startRow( kNext );
+
+        // XRest[MC,MR] -= U01Rest[MC,* ] X1[* ,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), U01Rest_MC_STAR, X1_STAR_MR, F(1), XRest );
+    }
+#else
+    LUNLarge<Device::CPU>( diag, UPre, XPre, checkIfSingular );
+#endif // EL_HAVE_NONBLOCKING_COLLECTIVES
+}
+
+template<Device D,typename F>
 void LUNMedium
 ( UnitOrNonUnit diag, 
   const AbstractDistMatrix<F>& UPre,
@@ -81,14 +227,14 @@ void LUNMedium
     const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    DistMatrix<F,MC,STAR,ELEMENT,D> U01_MC_STAR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> U11_STAR_STAR(g);
+    DistMatrix<F,MR,STAR,ELEMENT,D> X1Trans_MR_STAR(g);
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -17,7 +17,7 @@ namespace trsm {
 //   X := triuu(U)^-H X
 
 // width(X) >> p
-template<typename F>
+template<Device D,typename F>
 void LUTLarge
 ( Orientation orientation,
   UnitOrNonUnit diag,
@@ -34,15 +34,15 @@ void LUTLarge
     const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
-    DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
-    DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> U11_STAR_STAR(g); 
+    DistMatrix<F,STAR,MC,ELEMENT,D> U12_STAR_MC(g);
+    DistMatrix<F,STAR,MR,ELEMENT,D> X1_STAR_MR(g);
+    DistMatrix<F,STAR,VR,ELEMENT,D> X1_STAR_VR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -79,7 +79,7 @@ void LUTLarge
 }
 
 // width(X) ~= p
-template<typename F>
+template<Device D,typename F>
 void LUTMedium
 ( Orientation orientation,
   UnitOrNonUnit diag,
@@ -96,14 +96,14 @@ void LUTMedium
     const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
-    DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> U11_STAR_STAR(g); 
+    DistMatrix<F,STAR,MC,ELEMENT,D> U12_STAR_MC(g);
+    DistMatrix<F,MR,STAR,ELEMENT,D> X1Trans_MR_STAR(g);
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -16,7 +16,7 @@ namespace trsm {
 // Right Lower Normal (Non)Unit Trsm
 //   X := X tril(L)^-1, and
 //   X := X trilu(L)^-1
-template<typename F>
+template<Device D,typename F>
 void RLN
 ( UnitOrNonUnit diag, 
   const AbstractDistMatrix<F>& LPre,
@@ -28,15 +28,15 @@ void RLN
     const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,MR,  STAR> L10Trans_MR_STAR(g);
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
+    DistMatrix<F,MR,STAR,ELEMENT,D> L10Trans_MR_STAR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> L11_STAR_STAR(g);
+    DistMatrix<F,STAR,MC,ELEMENT,D> X1Trans_STAR_MC(g);
+    DistMatrix<F,VC,STAR,ELEMENT,D> X1_VC_STAR(g);
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -15,7 +15,7 @@ namespace trsm {
 //   X := X tril(L)^-H,
 //   X := X trilu(L)^-T, or
 //   X := X trilu(L)^-H
-template<typename F>
+template<Device D,typename F>
 void RLT
 ( Orientation orientation,
   UnitOrNonUnit diag,
@@ -32,16 +32,16 @@ void RLT
     const Int bsize = Blocksize();
     const Grid& g = LPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> LProx( LPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
-    DistMatrix<F,VR,  STAR> L21_VR_STAR(g);
-    DistMatrix<F,STAR,MR  > L21Trans_STAR_MR(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> L11_STAR_STAR(g);
+    DistMatrix<F,VR,STAR,ELEMENT,D> L21_VR_STAR(g);
+    DistMatrix<F,STAR,MR,ELEMENT,D> L21Trans_STAR_MR(g);
+    DistMatrix<F,VC,STAR,ELEMENT,D> X1_VC_STAR(g);
+    DistMatrix<F,STAR,MC,ELEMENT,D> X1Trans_STAR_MC(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
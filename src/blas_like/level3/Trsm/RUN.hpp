@@ -13,7 +13,7 @@ namespace trsm {
 // Right Upper Normal (Non)Unit Trsm
 //   X := X triu(U)^-1, and
 //   X := X triuu(U)^-1
-template<typename F>
+template<Device D,typename F>
 void RUN
 ( UnitOrNonUnit diag, 
   const AbstractDistMatrix<F>& UPre,
@@ -25,15 +25,15 @@ void RUN
     const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
-    DistMatrix<F,STAR,MR  > U12_STAR_MR(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);    
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> U11_STAR_STAR(g); 
+    DistMatrix<F,STAR,MR,ELEMENT,D> U12_STAR_MR(g);
+    DistMatrix<F,VC,STAR,ELEMENT,D> X1_VC_STAR(g);    
+    DistMatrix<F,STAR,MC,ELEMENT,D> X1Trans_STAR_MC(g);
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -15,7 +15,7 @@ namespace trsm {
 //   X := X triu(U)^-H,
 //   X := X triuu(U)^-T, or
 //   X := X triuu(U)^-H
-template<typename F>
+template<Device D,typename F>
 void RUT
 ( Orientation orientation,
   UnitOrNonUnit diag,
@@ -32,16 +32,16 @@ void RUT
     const Int bsize = Blocksize();
     const Grid& g = UPre.Grid();
 
-    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
-    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    DistMatrixReadProxy<F,F,MC,MR,ELEMENT,D> UProx( UPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,ELEMENT,D> XProx( XPre );
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
-    DistMatrix<F,VR,  STAR> U01_VR_STAR(g);
-    DistMatrix<F,STAR,MR  > U01Trans_STAR_MR(g);
-    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
-    DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
-    DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    DistMatrix<F,VR,STAR,ELEMENT,D> U01_VR_STAR(g);
+    DistMatrix<F,STAR,MR,ELEMENT,D> U01Trans_STAR_MR(g);
+    DistMatrix<F,STAR,STAR,ELEMENT,D> U11_STAR_STAR(g);
+    DistMatrix<F,VC,STAR,ELEMENT,D> X1_VC_STAR(g);
+    DistMatrix<F,STAR,MC,ELEMENT,D> X1Trans_STAR_MC(g);
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
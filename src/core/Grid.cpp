@@ -9,6 +9,12 @@
 */
 #include <El-lite.hpp>
 
+namespace {
+
+std::atomic<std::uint64_t> numGridsConstructed(0);
+
+} // namespace <anonymous>
+
 namespace El {
 
 Grid* Grid::defaultGrid = 0;
@@ -72,6 +78,14 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+std::uint64_t Grid::Id() const EL_NO_EXCEPT { return id_; }
+
+std::uint64_t Grid::NextRandomStream() const EL_NO_EXCEPT
+{ return randomStream_.fetch_add(1); }
+
+void Grid::SetRandomStream( std::uint64_t stream ) const EL_NO_EXCEPT
+{ randomStream_ = stream; }
+
 Grid::Grid( mpi::Comm comm, GridOrder order )
 : haveViewers_(false), order_(order)
 {
@@ -119,6 +133,11 @@ void Grid::SetUpGrid()
     owningRank_ = mpi::Rank( owningGroup_ );
     viewingRank_ = mpi::Rank( viewingComm_ );
     inGrid_ = ( owningRank_ != mpi::UNDEFINED );
+    id_ = ::numGridsConstructed.fetch_add(1);
+
+    // Agree upon a block of random streams once, so that drawing a random
+    // matrix over this grid never requires communication
+    randomStream_ = FirstDistRandomStream( viewingComm_ );
 
     const int width = size_ / height_;
     gcd_ = El::GCD( height_, width );
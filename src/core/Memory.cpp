@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cstdlib>
+
+namespace {
+
+unsigned int defaultCPUMemoryMode = 0;
+#ifdef HYDROGEN_HAVE_CUDA
+unsigned int defaultGPUMemoryMode = 0;
+#endif // HYDROGEN_HAVE_CUDA
+
+// Size classes run from 2^minBinLog to 2^(numBins-1) bytes
+const size_t minBinLog = 8;
+const size_t numBins = 8*sizeof(size_t);
+
+std::atomic<size_t> maxCachedBytes(size_t(1) << 30);
+
+std::atomic<size_t> numHits(0);
+std::atomic<size_t> numMisses(0);
+std::atomic<size_t> numBytesInUse(0);
+std::atomic<size_t> numBytesCached(0);
+std::atomic<size_t> highWaterBytes(0);
+
+size_t BinIndex( size_t numBytes )
+{
+    size_t bin = minBinLog;
+    while( (size_t(1) << bin) < numBytes )
+        ++bin;
+    return bin;
+}
+
+void UpdateHighWater()
+{
+    const size_t footprint = numBytesInUse + numBytesCached;
+    size_t highWater = highWaterBytes.load(std::memory_order_relaxed);
+    while( footprint > highWater &&
+           !highWaterBytes.compare_exchange_weak(highWater,footprint) ) { }
+}
+
+// Set once the calling thread's cache has been torn down, so that buffers
+// freed later in thread (or static) destruction bypass it
+thread_local bool cacheDestroyed = false;
+
+// Each thread keeps its own free lists so that no locking is required on
+// the allocation path; only the global counters are shared.
+struct ThreadCache
+{
+    std::vector<void*> bins[numBins];
+
+    void Release()
+    {
+        for( size_t bin=minBinLog; bin<numBins; ++bin )
+        {
+            const size_t binBytes = size_t(1) << bin;
+            for( void* ptr : bins[bin] )
+                std::free( ptr );
+            numBytesCached -= bins[bin].size()*binBytes;
+            El::SwapClear( bins[bin] );
+        }
+    }
+
+    ~ThreadCache()
+    {
+        Release();
+        cacheDestroyed = true;
+    }
+};
+
+ThreadCache& LocalCache()
+{
+    static thread_local ThreadCache cache;
+    return cache;
+}
+
+} // namespace <anonymous>
+
+namespace El {
+
+template<>
+unsigned int DefaultMemoryMode<Device::CPU>()
+{ return ::defaultCPUMemoryMode; }
+
+template<>
+void SetDefaultMemoryMode<Device::CPU>( unsigned int mode )
+{
+    if( mode > 2 )
+        LogicError("Invalid CPU memory mode: ",mode);
+    ::defaultCPUMemoryMode = mode;
+}
+
+#ifdef HYDROGEN_HAVE_CUDA
+template<>
+unsigned int DefaultMemoryMode<Device::GPU>()
+{ return ::defaultGPUMemoryMode; }
+
+template<>
+void SetDefaultMemoryMode<Device::GPU>( unsigned int mode )
+{
+    if( mode > 1 )
+        LogicError("Invalid GPU memory mode: ",mode);
+    ::defaultGPUMemoryMode = mode;
+}
+#endif // HYDROGEN_HAVE_CUDA
+
+void* HostMemoryPoolAllocate( size_t numBytes )
+{
+    const size_t bin = BinIndex( numBytes );
+    const size_t binBytes = size_t(1) << bin;
+
+    void* ptr = nullptr;
+    if( !cacheDestroyed && !LocalCache().bins[bin].empty() )
+    {
+        auto& freeList = LocalCache().bins[bin];
+        ptr = freeList.back();
+        freeList.pop_back();
+        numBytesCached -= binBytes;
+        ++numHits;
+    }
+    else
+    {
+        ptr = std::malloc( binBytes );
+        if( ptr == nullptr )
+        {
+            // Give the cached blocks back and try once more before failing
+            HostMemoryPoolRelease();
+            ptr = std::malloc( binBytes );
+            if( ptr == nullptr )
+                throw std::bad_alloc();
+        }
+        ++numMisses;
+    }
+    numBytesInUse += binBytes;
+    UpdateHighWater();
+    return ptr;
+}
+
+void HostMemoryPoolFree( void* ptr, size_t numBytes )
+{
+    if( ptr == nullptr )
+        return;
+    const size_t bin = BinIndex( numBytes );
+    const size_t binBytes = size_t(1) << bin;
+    numBytesInUse -= binBytes;
+
+    if( !cacheDestroyed && numBytesCached + binBytes <= maxCachedBytes )
+    {
+        LocalCache().bins[bin].push_back( ptr );
+        numBytesCached += binBytes;
+    }
+    else
+    {
+        std::free( ptr );
+    }
+}
+
+void HostMemoryPoolRelease()
+{
+    if( !cacheDestroyed )
+        LocalCache().Release();
+}
+
+void SetHostMemoryPoolMaxCachedBytes( size_t maxCachedBytes )
+{ ::maxCachedBytes = maxCachedBytes; }
+
+size_t HostMemoryPoolMaxCachedBytes()
+{ return ::maxCachedBytes; }
+
+HostMemoryPoolStatistics GetHostMemoryPoolStatistics()
+{
+    HostMemoryPoolStatistics stats;
+    stats.numHits = ::numHits;
+    stats.numMisses = ::numMisses;
+    stats.numBytesInUse = ::numBytesInUse;
+    stats.numBytesCached = ::numBytesCached;
+    stats.highWaterBytes = ::highWaterBytes;
+    return stats;
+}
+
+void ResetHostMemoryPoolStatistics()
+{
+    ::numHits = 0;
+    ::numMisses = 0;
+    ::highWaterBytes = ::numBytesInUse + ::numBytesCached;
+}
+
+void PrintHostMemoryPoolStatistics( ostream& os )
+{
+    const auto stats = GetHostMemoryPoolStatistics();
+    os << "Host memory pool statistics:\n"
+       << "  Hits:             " << stats.numHits << "\n"
+       << "  Misses:           " << stats.numMisses << "\n"
+       << "  Bytes in use:     " << stats.numBytesInUse << "\n"
+       << "  Bytes cached:     " << stats.numBytesCached << "\n"
+       << "  High-water bytes: " << stats.highWaterBytes << "\n"
+       << "  Max cached bytes: " << HostMemoryPoolMaxCachedBytes() << "\n"
+       << endl;
+}
+
+} // namespace El
@@ -0,0 +1,554 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+using El::Clock;
+
+struct RegionNode
+{
+    const char* name;
+    int parent;
+    std::vector<int> children;
+
+    El::Int numCalls=0;
+    double inclusiveTime=0, childTime=0;
+    double numBytes=0, numFlops=0;
+
+    RegionNode( const char* regionName, int parentNode )
+    : name(regionName), parent(parentNode) { }
+};
+
+struct OpenRegion
+{
+    int node;
+    Clock::time_point start;
+};
+
+struct TraceEvent
+{
+    const char* name;
+    double start, duration;
+};
+
+// The root of the region tree absorbs any work recorded outside of a region
+std::vector<RegionNode> regionTree( 1, RegionNode("[root]",-1) );
+std::vector<OpenRegion> openRegions;
+
+bool tracing = false;
+std::vector<TraceEvent> traceEvents;
+Clock::time_point traceEpoch;
+
+struct CommRecord
+{
+    std::string label;
+    El::CommCounts counts;
+};
+
+// The sites are keyed by the addresses of their names, which are merged by
+// value when queried
+typedef std::pair<const char*,const char*> SiteKey;
+
+std::map<MPI_Comm,CommRecord> commCounts;
+std::vector<CommRecord> retiredCommCounts;
+std::map<SiteKey,El::CommCounts> siteCounts;
+bool dumpCommCounts = false;
+
+bool OnMasterThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+int CurrentNode()
+{ return openRegions.empty() ? 0 : openRegions.back().node; }
+
+int FindOrAddChild( int parent, const char* name )
+{
+    for( int child : regionTree[parent].children )
+    {
+        const char* childName = regionTree[child].name;
+        if( childName == name || std::strcmp( childName, name ) == 0 )
+            return child;
+    }
+    const int child = regionTree.size();
+    regionTree.emplace_back( name, parent );
+    regionTree[parent].children.push_back( child );
+    return child;
+}
+
+double Seconds( Clock::duration timeSpan )
+{ return std::chrono::duration_cast<El::duration<double>>(timeSpan).count(); }
+
+// The names of the regions between the root and the given node
+std::string RegionPath( int node )
+{
+    std::string path = regionTree[node].name;
+    for( int ancestor=regionTree[node].parent; ancestor>0;
+         ancestor=regionTree[ancestor].parent )
+        path = std::string(regionTree[ancestor].name) + "/" + path;
+    return path;
+}
+
+// The nodes below the root in depth-first order
+void DepthFirst( int node, std::vector<int>& order )
+{
+    if( node > 0 )
+        order.push_back( node );
+    for( int child : regionTree[node].children )
+        DepthFirst( child, order );
+}
+
+std::string EscapeJSON( const char* name )
+{
+    std::string escaped;
+    for( const char* c=name; *c!='\0'; ++c )
+    {
+        if( *c == '"' || *c == '\\' )
+            escaped += '\\';
+        escaped += *c;
+    }
+    return escaped;
+}
+
+// Gathers the strings of each process onto the root of the communicator
+std::vector<std::string>
+GatherStrings( const std::string& local, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    const int commRank = El::mpi::Rank( comm );
+    const int localSize = local.size();
+    std::vector<int> sizes(commSize), offsets(commSize);
+    El::mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<El::byte> gathered( El::Max(totalSize,1) );
+    El::mpi::Gather
+    ( reinterpret_cast<const El::byte*>(local.data()), localSize,
+      gathered.data(), sizes.data(), offsets.data(), 0, comm );
+
+    std::vector<std::string> strings;
+    if( commRank == 0 )
+        for( int q=0; q<commSize; ++q )
+            strings.emplace_back
+            ( reinterpret_cast<const char*>(&gathered[offsets[q]]),
+              sizes[q] );
+    return strings;
+}
+
+// Accumulates the tab-separated statistics of each key gathered from every
+// process and prints their minimum, average and maximum, ordering the keys
+// by their first appearance. Keys which a process never recorded
+// contribute zeros.
+void PrintReducedStatistics
+( const std::vector<std::string>& gathered,
+  const std::vector<const char*>& statNames, std::ostream& msg )
+{
+    const int commSize = gathered.size();
+    const int numStats = statNames.size();
+    std::vector<std::string> keys;
+    std::map<std::string,std::vector<double>> stats;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream lines( gathered[q] );
+        std::string line;
+        while( std::getline( lines, line ) )
+        {
+            std::istringstream fields( line );
+            std::string key;
+            std::getline( fields, key, '\t' );
+            auto& keyStats = stats[key];
+            if( keyStats.empty() )
+            {
+                keys.push_back( key );
+                keyStats.resize( numStats*commSize, 0 );
+            }
+            for( int k=0; k<numStats; ++k )
+                fields >> keyStats[k*commSize+q];
+        }
+    }
+
+    for( const auto& key : keys )
+    {
+        msg << key << "\n";
+        const auto& keyStats = stats[key];
+        for( int k=0; k<numStats; ++k )
+        {
+            const double* values = &keyStats[k*commSize];
+            double minValue = values[0], maxValue = values[0], sum = 0;
+            for( int q=0; q<commSize; ++q )
+            {
+                minValue = El::Min( minValue, values[q] );
+                maxValue = El::Max( maxValue, values[q] );
+                sum += values[q];
+            }
+            msg << "  " << std::left << std::setw(14) << statNames[k]
+                << std::right << std::setw(14) << minValue
+                << std::setw(14) << sum/commSize
+                << std::setw(14) << maxValue << "\n";
+        }
+    }
+}
+
+// Identifies a communicator by its size and its first two members in
+// COMM_WORLD, which every member agrees upon
+std::string CommLabel( El::mpi::Comm comm )
+{
+    if( comm == El::mpi::COMM_NULL )
+        return "[requests]";
+    const int commSize = El::mpi::Size( comm );
+    const int numShown = El::Min( commSize, 2 );
+    int ranks[2] = { 0, 1 }, worldRanks[2];
+    El::mpi::Translate
+    ( comm, numShown, ranks, El::mpi::COMM_WORLD, worldRanks );
+    std::ostringstream label;
+    label << "world ranks " << worldRanks[0];
+    if( commSize > 1 )
+        label << "," << worldRanks[1];
+    if( commSize > 2 )
+        label << ",...";
+    label << " (" << commSize << " processes)";
+    return label.str();
+}
+
+void WriteCounts( std::ostream& os, const El::CommCounts& counts )
+{
+    os << counts.numCalls << '\t' << counts.bytesSent << '\t'
+       << counts.bytesReceived << '\t' << counts.time << '\n';
+}
+
+// Suspends the profiler and the communication counters so that their own
+// communication is not recorded
+class SuspendProfiling
+{
+public:
+    SuspendProfiling()
+    : enabled_(El::profiler::enabled),
+      countingComm_(El::profiler::countingComm)
+    {
+        El::profiler::enabled = false;
+        El::profiler::countingComm = false;
+    }
+    ~SuspendProfiling()
+    {
+        El::profiler::enabled = enabled_;
+        El::profiler::countingComm = countingComm_;
+    }
+private:
+    bool enabled_, countingComm_;
+};
+
+} // anonymous namespace
+
+namespace El {
+
+namespace profiler {
+bool enabled = false;
+bool countingComm = false;
+} // namespace profiler
+
+void EnableProfiling( bool trace )
+{
+    if( trace && !::tracing )
+        ::traceEpoch = Clock::now();
+    ::tracing = trace;
+    profiler::enabled = true;
+}
+
+void DisableProfiling() { profiler::enabled = false; }
+
+void ResetProfile()
+{
+    ::regionTree.assign( 1, RegionNode("[root]",-1) );
+    ::openRegions.clear();
+    ::traceEvents.clear();
+    ::traceEpoch = Clock::now();
+}
+
+void PushProfileRegion( const char* name )
+{
+    if( !OnMasterThread() )
+        return;
+    OpenRegion region;
+    region.node = FindOrAddChild( CurrentNode(), name );
+    region.start = Clock::now();
+    ::openRegions.push_back( region );
+}
+
+void PopProfileRegion()
+{
+    // Regions may have been discarded by ResetProfile while open
+    if( !OnMasterThread() || ::openRegions.empty() )
+        return;
+    const OpenRegion region = ::openRegions.back();
+    ::openRegions.pop_back();
+    const auto stop = Clock::now();
+    const double time = Seconds( stop - region.start );
+
+    RegionNode& node = ::regionTree[region.node];
+    ++node.numCalls;
+    node.inclusiveTime += time;
+    ::regionTree[node.parent].childTime += time;
+    if( ::tracing )
+    {
+        TraceEvent event;
+        event.name = node.name;
+        event.start = Seconds( region.start - ::traceEpoch );
+        event.duration = time;
+        ::traceEvents.push_back( event );
+    }
+}
+
+void ProfileBytes( double numBytes )
+{
+    if( profiler::enabled && OnMasterThread() )
+        ::regionTree[CurrentNode()].numBytes += numBytes;
+}
+
+void ProfileFlops( double numFlops )
+{
+    if( profiler::enabled && OnMasterThread() )
+        ::regionTree[CurrentNode()].numFlops += numFlops;
+}
+
+const char* CurrentProfileRegion()
+{
+    if( !OnMasterThread() || ::openRegions.empty() )
+        return nullptr;
+    return ::regionTree[::openRegions.back().node].name;
+}
+
+void PrintProfile( ostream& os )
+{
+    vector<int> order;
+    DepthFirst( 0, order );
+
+    ostringstream msg;
+    msg << std::left << std::setw(48) << "region"
+        << std::right << std::setw(10) << "calls"
+        << std::setw(14) << "inclusive(s)" << std::setw(14) << "exclusive(s)"
+        << std::setw(14) << "bytes" << std::setw(14) << "flops" << "\n";
+    for( int node : order )
+    {
+        const RegionNode& region = ::regionTree[node];
+        Int depth = 0;
+        for( int ancestor=region.parent; ancestor>0;
+             ancestor=::regionTree[ancestor].parent )
+            ++depth;
+        msg << std::left
+            << std::setw(48) << (string(2*depth,' ')+region.name)
+            << std::right << std::setw(10) << region.numCalls
+            << std::setw(14) << region.inclusiveTime
+            << std::setw(14) << region.inclusiveTime-region.childTime
+            << std::setw(14) << region.numBytes
+            << std::setw(14) << region.numFlops << "\n";
+    }
+    os << msg.str();
+}
+
+void PrintReducedProfile( mpi::Comm comm, ostream& os )
+{
+    SuspendProfiling suspend;
+    const int commSize = mpi::Size( comm );
+
+    // Each process serializes its regions by their path
+    vector<int> order;
+    DepthFirst( 0, order );
+    ostringstream local;
+    local << std::setprecision(17);
+    for( int node : order )
+    {
+        const RegionNode& region = ::regionTree[node];
+        local << RegionPath(node) << '\t' << region.numCalls << '\t'
+              << region.inclusiveTime << '\t'
+              << region.inclusiveTime-region.childTime << '\t'
+              << region.numBytes << '\t' << region.numFlops << '\n';
+    }
+    const vector<string> gathered = GatherStrings( local.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    ostringstream msg;
+    msg << "Profile reduced over " << commSize << " processes "
+        << "(min/avg/max)\n";
+    PrintReducedStatistics
+    ( gathered,
+      { "calls", "inclusive(s)", "exclusive(s)", "bytes", "flops" }, msg );
+    os << msg.str();
+}
+
+void WriteProfileTrace( const string& filename, mpi::Comm comm )
+{
+    SuspendProfiling suspend;
+    const int commRank = mpi::Rank( comm );
+
+    // Chrome traces are in microseconds. The clocks of the processes are
+    // not synchronized, so each trace is relative to when that process
+    // began tracing.
+    ostringstream local;
+    local << std::fixed << std::setprecision(3);
+    for( const auto& event : ::traceEvents )
+        local << "{\"name\":\"" << EscapeJSON(event.name) << "\","
+              << "\"ph\":\"X\",\"pid\":" << commRank << ",\"tid\":0,"
+              << "\"ts\":" << 1e6*event.start << ","
+              << "\"dur\":" << 1e6*event.duration << "},\n";
+    const vector<string> gathered = GatherStrings( local.str(), comm );
+    if( commRank != 0 )
+        return;
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "{\"traceEvents\":[\n";
+    for( const auto& events : gathered )
+        file << events;
+    // Terminate the event list with an empty metadata event so that the
+    // trailing comma is valid
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"
+         << "\"args\":{\"name\":\"rank 0\"}}\n]}\n";
+}
+
+CommCounts& CommCounts::operator+=( const CommCounts& counts )
+{
+    numCalls += counts.numCalls;
+    bytesSent += counts.bytesSent;
+    bytesReceived += counts.bytesReceived;
+    time += counts.time;
+    return *this;
+}
+
+void EnableCommCounters( bool dumpAtFinalize )
+{
+    ::dumpCommCounts = dumpAtFinalize;
+    profiler::countingComm = true;
+}
+
+void DisableCommCounters() { profiler::countingComm = false; }
+
+void ResetCommCounters()
+{
+    ::commCounts.clear();
+    ::retiredCommCounts.clear();
+    ::siteCounts.clear();
+}
+
+void RecordCommCall
+( const char* name, const char* site, mpi::Comm comm,
+  double bytesSent, double bytesReceived, double time )
+{
+    if( !profiler::countingComm || !OnMasterThread() )
+        return;
+    CommCounts counts;
+    counts.numCalls = 1;
+    counts.bytesSent = bytesSent;
+    counts.bytesReceived = bytesReceived;
+    counts.time = time;
+
+    auto commIt = ::commCounts.find( comm.comm );
+    if( commIt == ::commCounts.end() )
+    {
+        // Labeling the communicator requires (uncounted) queries of it
+        SuspendProfiling suspend;
+        CommRecord record;
+        record.label = CommLabel( comm );
+        commIt = ::commCounts.emplace( comm.comm, record ).first;
+    }
+    commIt->second.counts += counts;
+    ::siteCounts[SiteKey(name,site)] += counts;
+}
+
+void RetireCommCounters( mpi::Comm comm )
+{
+    auto it = ::commCounts.find( comm.comm );
+    if( it == ::commCounts.end() )
+        return;
+    ::retiredCommCounts.push_back( std::move(it->second) );
+    ::commCounts.erase( it );
+}
+
+CommCounts GetCommCounts( mpi::Comm comm )
+{
+    auto it = ::commCounts.find( comm.comm );
+    return it == ::commCounts.end() ? CommCounts() : it->second.counts;
+}
+
+std::map<string,CommCounts> CommCountsByComm()
+{
+    std::map<string,CommCounts> counts;
+    for( const auto& entry : ::commCounts )
+        counts[entry.second.label] += entry.second.counts;
+    for( const auto& record : ::retiredCommCounts )
+        counts[record.label] += record.counts;
+    return counts;
+}
+
+std::map<string,CommCounts> CommCountsBySite()
+{
+    std::map<string,CommCounts> counts;
+    for( const auto& entry : ::siteCounts )
+    {
+        string site = entry.first.first;
+        if( entry.first.second != nullptr )
+            site += BuildString(" in ",entry.first.second);
+        counts[site] += entry.second;
+    }
+    return counts;
+}
+
+void PrintCommCounters( mpi::Comm comm, ostream& os )
+{
+    SuspendProfiling suspend;
+    const int commSize = mpi::Size( comm );
+
+    ostringstream local;
+    local << std::setprecision(17);
+    for( const auto& entry : CommCountsByComm() )
+    {
+        local << "comm " << entry.first << '\t';
+        WriteCounts( local, entry.second );
+    }
+    for( const auto& entry : CommCountsBySite() )
+    {
+        local << entry.first << '\t';
+        WriteCounts( local, entry.second );
+    }
+    const vector<string> gathered = GatherStrings( local.str(), comm );
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    ostringstream msg;
+    msg << "Communication counters reduced over " << commSize
+        << " processes (min/avg/max)\n";
+    PrintReducedStatistics
+    ( gathered, { "calls", "bytes sent", "bytes recv", "time(s)" }, msg );
+    os << msg.str();
+}
+
+void FinalizeCommCounters()
+{
+    if( profiler::countingComm && ::dumpCommCounts )
+        PrintCommCounters();
+    profiler::countingComm = false;
+    ResetCommCounters();
+}
+
+} // namespace El
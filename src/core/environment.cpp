@@ -218,6 +218,10 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        // The counters are dumped while the grids and MPI remain valid
+        FinalizeCommCounters();
+
+        FreeGemmCaches();
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -238,6 +242,8 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        HostMemoryPoolRelease();
     }
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -31,6 +31,48 @@ inline cublasOperation_t CharTocuBLASOp(char c)
     }
 }
 
+inline cublasSideMode_t CharTocuBLASSide(char c)
+{
+    switch (c)
+    {
+    case 'L':
+        return CUBLAS_SIDE_LEFT;
+    case 'R':
+        return CUBLAS_SIDE_RIGHT;
+    default:
+        RuntimeError("cuBLAS: Unknown side mode.");
+        return CUBLAS_SIDE_LEFT;
+    }
+}
+
+inline cublasFillMode_t CharTocuBLASFill(char c)
+{
+    switch (c)
+    {
+    case 'L':
+        return CUBLAS_FILL_MODE_LOWER;
+    case 'U':
+        return CUBLAS_FILL_MODE_UPPER;
+    default:
+        RuntimeError("cuBLAS: Unknown fill mode.");
+        return CUBLAS_FILL_MODE_LOWER;
+    }
+}
+
+inline cublasDiagType_t CharTocuBLASDiag(char c)
+{
+    switch (c)
+    {
+    case 'N':
+        return CUBLAS_DIAG_NON_UNIT;
+    case 'U':
+        return CUBLAS_DIAG_UNIT;
+    default:
+        RuntimeError("cuBLAS: Unknown diagonal type.");
+        return CUBLAS_DIAG_NON_UNIT;
+    }
+}
+
 } // namespace <anon>
 
 //
@@ -91,6 +133,20 @@ inline cublasOperation_t CharTocuBLASOp(char c)
             m, n, k, &alpha, A, ALDim, B, BLDim, &beta, C, CLDim));     \
     }
 
+#define ADD_TRSM_IMPL(ScalarType, TypeChar)                             \
+    void Trsm(                                                          \
+        char side, char uplo, char trans, char diag, int m, int n,      \
+        ScalarType const& alpha,                                        \
+        ScalarType const* A, int ALDim,                                 \
+        ScalarType* B, int BLDim )                                      \
+    {                                                                   \
+        EL_CHECK_CUBLAS(cublas ## TypeChar ## trsm(                     \
+            GPUManager::cuBLASHandle(),                                 \
+            CharTocuBLASSide(side), CharTocuBLASFill(uplo),             \
+            CharTocuBLASOp(trans), CharTocuBLASDiag(diag),              \
+            m, n, &alpha, A, ALDim, B, BLDim));                         \
+    }
+
 //
 // BLAS-like Extension
 //
@@ -124,6 +180,8 @@ ADD_GEMV_IMPL(double, D)
 // BLAS 3
 ADD_GEMM_IMPL(float, S)
 ADD_GEMM_IMPL(double, D)
+ADD_TRSM_IMPL(float, S)
+ADD_TRSM_IMPL(double, D)
 
 // BLAS-like extension
 ADD_GEAM_IMPL(float, S)
@@ -30,6 +30,14 @@ typedef unsigned char* UCP;
 #define EL_CHECK_MPI(mpi_call) CheckMpi( mpi_call )
 #endif // #ifdef HYDROGEN_HAVE_CUDA
 
+// Profiles the enclosing routine as a region and records it in the
+// communication counters. The numbers of bytes which this process sends
+// and receives are only evaluated when either is enabled.
+#define EL_MPI_PROFILE(name,comm,sentBytes,recvBytes)                   \
+    ProfiledCall mpiProfiledCall( name, comm );                         \
+    if( mpiProfiledCall.Active() )                                      \
+        mpiProfiledCall.SetBytes( sentBytes, recvBytes )
+
 namespace {
 
 inline void
@@ -46,6 +54,60 @@ CheckMpi( int error ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// The profiler region and communication counters of a wrapper call. The
+// call site is captured before the wrapper's own region is opened.
+class ProfiledCall
+{
+public:
+    ProfiledCall( const char* name, El::mpi::Comm comm )
+    : name_(name), comm_(comm), counting_(El::CommCountersEnabled()),
+      site_(counting_ ? El::CurrentProfileRegion() : nullptr),
+      region_(name)
+    {
+        if( counting_ )
+            start_ = El::Clock::now();
+    }
+
+    ~ProfiledCall()
+    {
+        if( counting_ )
+        {
+            const El::duration<double> time = El::Clock::now() - start_;
+            El::RecordCommCall
+            ( name_, site_, comm_, bytesSent_, bytesReceived_, time.count() );
+        }
+    }
+
+    bool Active() const
+    { return counting_ || El::ProfilingEnabled(); }
+
+    void SetBytes( double bytesSent, double bytesReceived )
+    {
+        bytesSent_ = bytesSent;
+        bytesReceived_ = bytesReceived;
+        El::ProfileBytes( bytesSent+bytesReceived );
+    }
+
+private:
+    const char* name_;
+    El::mpi::Comm comm_;
+    bool counting_;
+    const char* site_;
+    El::ProfileRegion region_;
+    El::Clock::time_point start_;
+    double bytesSent_=0, bytesReceived_=0;
+};
+
+// The total of the given count for each process in the communicator
+int TotalCount( const int* counts, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    int total = 0;
+    for( int q=0; q<commSize; ++q )
+        total += counts[q];
+    return total;
+}
+
 template<typename T>
 MPI_Op NativeOp( const El::mpi::Op& op )
 {
@@ -193,6 +255,8 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    // The handle may be reused by a later communicator
+    RetireCommCounters( comm );
     EL_CHECK_MPI( MPI_Comm_free( &comm.comm ) );
 }
 
@@ -441,6 +505,7 @@ template<typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Wait", COMM_NULL, 0, 0 );
     EL_CHECK_MPI( MPI_Wait( &request.backend, &status ) );
 }
 
@@ -460,6 +525,7 @@ void WaitAll( int numRequests, Request<T>* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::WaitAll", COMM_NULL, 0, 0 );
 #ifndef EL_MPI_REQUEST_IS_NOT_POINTER
     // Both MPICH and OpenMPI define MPI_Request to be a pointer to a structure,
     // which implies that the following code is legal. AFAIK, there are not
@@ -488,6 +554,7 @@ template<typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Wait", COMM_NULL, 0, 0 );
     EL_CHECK_MPI( MPI_Wait( &request.backend, &status ) );
     if( request.receivingPacked )
     {
@@ -505,6 +572,7 @@ void WaitAll( int numRequests, Request<T>* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::WaitAll", COMM_NULL, 0, 0 );
 #ifndef EL_MPI_REQUEST_IS_NOT_POINTER
     // Both MPICH and OpenMPI define MPI_Request to be a pointer to a structure,
     // which implies that the following code is legal. AFAIK, there are not
@@ -566,6 +634,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Send", comm, count*sizeof(*buf), 0 );
     EL_CHECK_MPI
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -578,6 +647,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Send", comm, count*sizeof(*buf), 0 );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Send
@@ -597,6 +667,7 @@ template<typename T,
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Send", comm, count*sizeof(*buf), 0 );
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     EL_CHECK_MPI
@@ -623,6 +694,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::ISend", comm, count*sizeof(*buf), 0 );
     EL_CHECK_MPI
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -636,6 +708,7 @@ void TaggedISend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::ISend", comm, count*sizeof(*buf), 0 );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Isend
@@ -657,6 +730,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::ISend", comm, count*sizeof(*buf), 0 );
     Serialize( count, buf, request.buffer );
     EL_CHECK_MPI
     ( MPI_Isend
@@ -810,6 +884,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Recv", comm, 0, count*sizeof(*buf) );
     Status status;
     EL_CHECK_MPI
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -821,6 +896,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Recv", comm, 0, count*sizeof(*buf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
@@ -838,6 +914,7 @@ template<typename T,
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::Recv", comm, 0, count*sizeof(*buf) );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -870,6 +947,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::IRecv", comm, 0, count*sizeof(*buf) );
     EL_CHECK_MPI
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
@@ -883,6 +961,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::IRecv", comm, 0, count*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Irecv
@@ -904,6 +983,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::IRecv", comm, 0, count*sizeof(*buf) );
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
@@ -929,6 +1009,148 @@ T IRecv( int from, Comm comm, Request<T>& request )
 EL_NO_RELEASE_EXCEPT
 { return TaggedIRecv<T>( from, ANY_TAG, comm, request ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void SendInit
+( const Real* buf, int count, int to, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::SendInit", comm, 0, 0 );
+    request.persistentComm = comm.comm;
+    request.persistentBytesSent = count*sizeof(*buf);
+    request.persistentBytesReceived = 0;
+    EL_CHECK_MPI
+    ( MPI_Send_init
+      ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 0, comm.comm,
+        &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void SendInit
+( const Complex<Real>* buf, int count, int to, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::SendInit", comm, 0, 0 );
+    request.persistentComm = comm.comm;
+    request.persistentBytesSent = count*sizeof(*buf);
+    request.persistentBytesReceived = 0;
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI
+    ( MPI_Send_init
+      ( const_cast<Complex<Real>*>(buf), 2*count, TypeMap<Real>(), to, 0,
+        comm.comm, &request.backend ) );
+#else
+    EL_CHECK_MPI
+    ( MPI_Send_init
+      ( const_cast<Complex<Real>*>(buf), count, TypeMap<Complex<Real>>(), to,
+        0, comm.comm, &request.backend ) );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void SendInit
+( const T* buf, int count, int to, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    LogicError("Persistent requests require a packed datatype");
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void RecvInit
+( Real* buf, int count, int from, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::RecvInit", comm, 0, 0 );
+    request.persistentComm = comm.comm;
+    request.persistentBytesSent = 0;
+    request.persistentBytesReceived = count*sizeof(*buf);
+    EL_CHECK_MPI
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Real>(), from, 0, comm.comm, &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void RecvInit
+( Complex<Real>* buf, int count, int from, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::RecvInit", comm, 0, 0 );
+    request.persistentComm = comm.comm;
+    request.persistentBytesSent = 0;
+    request.persistentBytesReceived = count*sizeof(*buf);
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI
+    ( MPI_Recv_init
+      ( buf, 2*count, TypeMap<Real>(), from, 0, comm.comm,
+        &request.backend ) );
+#else
+    EL_CHECK_MPI
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Complex<Real>>(), from, 0, comm.comm,
+        &request.backend ) );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void RecvInit
+( T* buf, int count, int from, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    LogicError("Persistent requests require a packed datatype");
+}
+
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Start", request.persistentComm, request.persistentBytesSent,
+      request.persistentBytesReceived );
+    EL_CHECK_MPI( MPI_Start( &request.backend ) );
+}
+
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // The requests are counted against their communicator if they share one
+    // and as anonymous requests otherwise
+    Comm comm = ( numRequests > 0 ? requests[0].persistentComm : COMM_NULL );
+    double bytesSent=0, bytesReceived=0;
+    for( Int j=0; j<numRequests; ++j )
+    {
+        if( requests[j].persistentComm != comm.comm )
+            comm = COMM_NULL;
+        bytesSent += requests[j].persistentBytesSent;
+        bytesReceived += requests[j].persistentBytesReceived;
+    }
+    EL_MPI_PROFILE( "mpi::StartAll", comm, bytesSent, bytesReceived );
+    for( Int j=0; j<numRequests; ++j )
+        EL_CHECK_MPI( MPI_Start( &requests[j].backend ) );
+}
+
+template<typename T>
+void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_CHECK_MPI( MPI_Request_free( &request.backend ) );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSendRecv
@@ -937,6 +1159,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::SendRecv", comm, sc*sizeof(*sbuf), rc*sizeof(*sbuf) );
     Status status;
     EL_CHECK_MPI
     ( MPI_Sendrecv
@@ -953,6 +1176,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::SendRecv", comm, sc*sizeof(*sbuf), rc*sizeof(*sbuf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
@@ -978,6 +1202,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE( "mpi::SendRecv", comm, sc*sizeof(*sbuf), rc*sizeof(*sbuf) );
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -1018,6 +1243,10 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::SendRecv", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
     Status status;
     EL_CHECK_MPI
     ( MPI_Sendrecv_replace
@@ -1033,6 +1262,10 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::SendRecv", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
@@ -1055,6 +1288,10 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::SendRecv", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1079,6 +1316,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::Broadcast", comm,
+      (Rank(comm) == root ? count : 0)*sizeof(*buf),
+      (Rank(comm) == root ? 0 : count)*sizeof(*buf) );
     EL_CHECK_MPI( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
@@ -1090,6 +1331,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::Broadcast", comm,
+      (Rank(comm) == root ? count : 0)*sizeof(*buf),
+      (Rank(comm) == root ? 0 : count)*sizeof(*buf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
@@ -1106,6 +1351,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::Broadcast", comm,
+      (Rank(comm) == root ? count : 0)*sizeof(*buf),
+      (Rank(comm) == root ? 0 : count)*sizeof(*buf) );
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     EL_CHECK_MPI(
@@ -1124,6 +1373,10 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IBroadcast", comm,
+      (Rank(comm) == root ? count : 0)*sizeof(*buf),
+      (Rank(comm) == root ? 0 : count)*sizeof(*buf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     EL_CHECK_MPI
     ( MPI_Ibcast
@@ -1140,6 +1393,10 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IBroadcast", comm,
+      (Rank(comm) == root ? count : 0)*sizeof(*buf),
+      (Rank(comm) == root ? 0 : count)*sizeof(*buf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
@@ -1163,14 +1420,21 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IBroadcast", comm,
+      (Rank(comm) == root ? count : 0)*sizeof(*buf),
+      (Rank(comm) == root ? 0 : count)*sizeof(*buf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    if( mpi::Rank(comm) == root )
+        Serialize( count, buf, request.buffer );
+    else
+        ReserveSerialized( count, buf, request.buffer );
     EL_CHECK_MPI
     ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1189,6 +1453,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Gather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*sbuf) );
     EL_CHECK_MPI
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1203,6 +1471,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Gather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Gather
@@ -1227,6 +1499,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Gather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1253,6 +1529,10 @@ void IGather
   Request<Real>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IGather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*sbuf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     EL_CHECK_MPI
     ( MPI_Igather
@@ -1273,6 +1553,10 @@ void IGather
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IGather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*sbuf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
@@ -1302,7 +1586,13 @@ void IGather
   Request<T>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IGather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*sbuf) );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // The request buffer holds the packed receive data (on the root)
+    // followed by the packed send data so that both outlive this call
     if( mpi::Rank(comm) == root )
     {
         const int commSize = mpi::Size(comm);
@@ -1311,10 +1601,17 @@ void IGather
         request.unpackedRecvBuf = rbuf;
         ReserveSerialized( rc*commSize, rbuf, request.buffer );
     }
+    else
+        request.buffer.clear();
+    const size_t recvBytes = request.buffer.size();
+    std::vector<byte> packedSend;
+    Serialize( sc, sbuf, packedSend );
+    request.buffer.insert
+    ( request.buffer.end(), packedSend.begin(), packedSend.end() );
     EL_CHECK_MPI
     ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
+      ( request.buffer.data()+recvBytes, sc, TypeMap<T>(),
+        request.buffer.data(),           rc, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1330,6 +1627,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Gather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? TotalCount(rcs,comm) : 0)*sizeof(*sbuf) );
     EL_CHECK_MPI
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1352,6 +1653,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Gather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? TotalCount(rcs,comm) : 0)*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1396,6 +1701,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Gather", comm,
+      sc*sizeof(*sbuf),
+      (Rank(comm) == root ? TotalCount(rcs,comm) : 0)*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1430,6 +1739,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllGather", comm,
+      sc*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     EL_CHECK_MPI
     ( MPI_Allgather
@@ -1454,6 +1767,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllGather", comm,
+      sc*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     EL_CHECK_MPI
     ( MPI_Allgather
@@ -1488,6 +1805,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllGather", comm,
+      sc*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1502,6 +1823,116 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllGather", comm,
+      sc*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_USE_BYTE_ALLGATHERS
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
+        sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
+        reinterpret_cast<UCP>(rbuf),
+        sizeof(Real)*rc, MPI_UNSIGNED_CHAR,
+        comm.comm, &request.backend ) );
+ #else
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllGather", comm,
+      sc*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_USE_BYTE_ALLGATHERS
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
+        2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
+        reinterpret_cast<UCP>(rbuf),
+        2*sizeof(Real)*rc, MPI_UNSIGNED_CHAR,
+        comm.comm, &request.backend ) );
+ #elif defined(EL_AVOID_COMPLEX_MPI)
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #else
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllGather", comm,
+      sc*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int commSize = mpi::Size(comm);
+    const int totalRecv = rc*commSize;
+
+    // The request buffer holds the packed receive data followed by the
+    // packed send data so that both outlive this call
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    const size_t recvBytes = request.buffer.size();
+    std::vector<byte> packedSend;
+    Serialize( sc, sbuf, packedSend );
+    request.buffer.insert
+    ( request.buffer.end(), packedSend.begin(), packedSend.end() );
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( request.buffer.data()+recvBytes, sc, TypeMap<T>(),
+        request.buffer.data(),           rc, TypeMap<T>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
@@ -1510,6 +1941,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllGather", comm,
+      sc*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1547,6 +1982,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllGather", comm,
+      sc*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1599,6 +2038,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllGather", comm,
+      sc*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1627,6 +2070,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Scatter", comm,
+      (Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
     EL_CHECK_MPI
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1641,6 +2088,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Scatter", comm,
+      (Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Scatter
@@ -1665,6 +2116,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Scatter", comm,
+      (Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1687,6 +2142,10 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Scatter", comm,
+      (Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*buf),
+      rc*sizeof(*buf) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1710,6 +2169,10 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Scatter", comm,
+      (Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*buf),
+      rc*sizeof(*buf) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1748,6 +2211,10 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Scatter", comm,
+      (Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*buf),
+      rc*sizeof(*buf) );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1774,6 +2241,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllToAll", comm,
+      sc*Size(comm)*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
     EL_CHECK_MPI
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1788,6 +2259,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllToAll", comm,
+      sc*Size(comm)*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Alltoall
@@ -1814,6 +2289,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllToAll", comm,
+      sc*Size(comm)*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1836,6 +2315,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllToAll", comm,
+      TotalCount(scs,comm)*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
     EL_CHECK_MPI
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1857,6 +2340,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllToAll", comm,
+      TotalCount(scs,comm)*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1898,6 +2385,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllToAll", comm,
+      TotalCount(scs,comm)*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1937,86 +2428,314 @@ EL_NO_RELEASE_EXCEPT
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void Reduce
-( const Real* sbuf, Real* rbuf, int count, Op op, int root, Comm comm )
-EL_NO_RELEASE_EXCEPT
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
 {
     EL_DEBUG_CSE
-    if( count == 0 )
-        return;
-
-    MPI_Op opC = NativeOp<Real>( op );
+    EL_MPI_PROFILE
+    ( "mpi::IAllToAll", comm,
+      sc*Size(comm)*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     EL_CHECK_MPI
-    ( MPI_Reduce
-      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
-        opC, root, comm.comm ) );
+    ( MPI_Ialltoall
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void Reduce
-( const Complex<Real>* sbuf,
-        Complex<Real>* rbuf, int count, Op op, int root, Comm comm )
-EL_NO_RELEASE_EXCEPT
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
-    if( count == 0 )
-        return;
-
-#ifdef EL_AVOID_COMPLEX_MPI
-    if( op == SUM )
-    {
-        MPI_Op opC = NativeOp<Real>( op );
-        EL_CHECK_MPI
-        ( MPI_Reduce
-          ( const_cast<Complex<Real>*>(sbuf),
-            rbuf, 2*count, TypeMap<Real>(), opC,
-            root, comm.comm ) );
-    }
-    else
-    {
-        MPI_Op opC = NativeOp<Complex<Real>>( op );
-        EL_CHECK_MPI
-        ( MPI_Reduce
-          ( const_cast<Complex<Real>*>(sbuf),
-            rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
-    }
-#else
-    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    EL_MPI_PROFILE
+    ( "mpi::IAllToAll", comm,
+      sc*Size(comm)*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
-    ( MPI_Reduce
+    ( MPI_Ialltoall
       ( const_cast<Complex<Real>*>(sbuf),
-        rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
+        2*sc, TypeMap<Real>(),
+        rbuf,
+        2*rc, TypeMap<Real>(), comm.comm, &request.backend ) );
+ #else
+    EL_CHECK_MPI
+    ( MPI_Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf),
+        sc, TypeMap<Complex<Real>>(),
+        rbuf,
+        rc, TypeMap<Complex<Real>>(), comm.comm, &request.backend ) );
+ #endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
 #endif
 }
 
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
-void Reduce
-( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm )
-EL_NO_RELEASE_EXCEPT
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
 {
     EL_DEBUG_CSE
-    if( count == 0 )
-        return;
-
-    MPI_Op opC = NativeOp<T>( op );
-
-    const int commRank = mpi::Rank(comm);
-    std::vector<byte> packedSend, packedRecv;
-    Serialize( count, sbuf, packedSend );
+    EL_MPI_PROFILE
+    ( "mpi::IAllToAll", comm,
+      sc*Size(comm)*sizeof(*sbuf),
+      rc*Size(comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int commSize = mpi::Size( comm );
+    const int totalSend = sc*commSize;
+    const int totalRecv = rc*commSize;
 
-    if( commRank == root )
-        ReserveSerialized( count, rbuf, packedRecv );
+    // The request buffer holds the packed receive data followed by the
+    // packed send data so that both outlive this call
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    const size_t recvBytes = request.buffer.size();
+    std::vector<byte> packedSend;
+    Serialize( totalSend, sbuf, packedSend );
+    request.buffer.insert
+    ( request.buffer.end(), packedSend.begin(), packedSend.end() );
     EL_CHECK_MPI
-    ( MPI_Reduce
-      ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
-        opC, root, comm.comm ) );
-    if( commRank == root )
-        Deserialize( count, packedRecv, rbuf );
-}
-
+    ( MPI_Ialltoall
+      ( request.buffer.data()+recvBytes, sc, TypeMap<T>(),
+        request.buffer.data(),           rc, TypeMap<T>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllToAll", comm,
+      TotalCount(scs,comm)*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_CHECK_MPI
+    ( MPI_Ialltoallv
+      ( const_cast<Real*>(sbuf),
+        const_cast<int*>(scs),
+        const_cast<int*>(sds),
+        TypeMap<Real>(),
+        rbuf,
+        const_cast<int*>(rcs),
+        const_cast<int*>(rds),
+        TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllToAll", comm,
+      TotalCount(scs,comm)*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_AVOID_COMPLEX_MPI
+    // The doubled counts are kept in the request since they must remain
+    // valid until the exchange completes
+    const int p = mpi::Size( comm );
+    request.counts.resize( 4*p );
+    int* scsDoubled = &request.counts[0];
+    int* sdsDoubled = &request.counts[p];
+    int* rcsDoubled = &request.counts[2*p];
+    int* rdsDoubled = &request.counts[3*p];
+    for( int i=0; i<p; ++i )
+    {
+        scsDoubled[i] = 2*scs[i];
+        sdsDoubled[i] = 2*sds[i];
+        rcsDoubled[i] = 2*rcs[i];
+        rdsDoubled[i] = 2*rds[i];
+    }
+    EL_CHECK_MPI
+    ( MPI_Ialltoallv
+      ( const_cast<Complex<Real>*>(sbuf),
+              scsDoubled, sdsDoubled, TypeMap<Real>(),
+        rbuf, rcsDoubled, rdsDoubled, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+ #else
+    EL_CHECK_MPI
+    ( MPI_Ialltoallv
+      ( const_cast<Complex<Real>*>(sbuf),
+        const_cast<int*>(scs),
+        const_cast<int*>(sds),
+        TypeMap<Complex<Real>>(),
+        rbuf,
+        const_cast<int*>(rcs),
+        const_cast<int*>(rds),
+        TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllToAll", comm,
+      TotalCount(scs,comm)*sizeof(*sbuf),
+      TotalCount(rcs,comm)*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int commSize = mpi::Size( comm );
+    const int totalSend = scs[commSize-1]+sds[commSize-1];
+    const int totalRecv = rcs[commSize-1]+rds[commSize-1];
+
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    const size_t recvBytes = request.buffer.size();
+    std::vector<byte> packedSend;
+    Serialize( totalSend, sbuf, packedSend );
+    request.buffer.insert
+    ( request.buffer.end(), packedSend.begin(), packedSend.end() );
+    EL_CHECK_MPI
+    ( MPI_Ialltoallv
+      ( request.buffer.data()+recvBytes,
+        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
+        request.buffer.data(),
+        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<T>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void Reduce
+( const Real* sbuf, Real* rbuf, int count, Op op, int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Reduce", comm,
+      count*sizeof(*sbuf),
+      (Rank(comm) == root ? count : 0)*sizeof(*sbuf) );
+    if( count == 0 )
+        return;
+
+    MPI_Op opC = NativeOp<Real>( op );
+    EL_CHECK_MPI
+    ( MPI_Reduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
+        opC, root, comm.comm ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void Reduce
+( const Complex<Real>* sbuf,
+        Complex<Real>* rbuf, int count, Op op, int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Reduce", comm,
+      count*sizeof(*sbuf),
+      (Rank(comm) == root ? count : 0)*sizeof(*sbuf) );
+    if( count == 0 )
+        return;
+
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        EL_CHECK_MPI
+        ( MPI_Reduce
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, 2*count, TypeMap<Real>(), opC,
+            root, comm.comm ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        EL_CHECK_MPI
+        ( MPI_Reduce
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    EL_CHECK_MPI
+    ( MPI_Reduce
+      ( const_cast<Complex<Real>*>(sbuf),
+        rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void Reduce
+( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Reduce", comm,
+      count*sizeof(*sbuf),
+      (Rank(comm) == root ? count : 0)*sizeof(*sbuf) );
+    if( count == 0 )
+        return;
+
+    MPI_Op opC = NativeOp<T>( op );
+
+    const int commRank = mpi::Rank(comm);
+    std::vector<byte> packedSend, packedRecv;
+    Serialize( count, sbuf, packedSend );
+
+    if( commRank == root )
+        ReserveSerialized( count, rbuf, packedRecv );
+    EL_CHECK_MPI
+    ( MPI_Reduce
+      ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
+        opC, root, comm.comm ) );
+    if( commRank == root )
+        Deserialize( count, packedRecv, rbuf );
+}
+
 template<typename T>
 void Reduce( const T* sbuf, T* rbuf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
@@ -2048,6 +2767,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::Reduce", comm,
+      count*sizeof(*buf),
+      (Rank(comm) == root ? count : 0)*sizeof(*buf) );
 
     MPI_Op opC = NativeOp<Real>( op );
 
@@ -2073,6 +2796,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::Reduce", comm,
+      count*sizeof(*buf),
+      (Rank(comm) == root ? count : 0)*sizeof(*buf) );
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2133,6 +2860,10 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::Reduce", comm,
+      count*sizeof(*buf),
+      (Rank(comm) == root ? count : 0)*sizeof(*buf) );
     if( count == 0 )
         return;
 
@@ -2165,6 +2896,10 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllReduce", comm,
+      count*sizeof(*sbuf),
+      count*sizeof(*sbuf) );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2182,6 +2917,10 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllReduce", comm,
+      count*sizeof(*sbuf),
+      count*sizeof(*sbuf) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2219,6 +2958,10 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllReduce", comm,
+      count*sizeof(*sbuf),
+      count*sizeof(*sbuf) );
     if( count == 0 )
         return;
 
@@ -2257,6 +3000,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::AllReduce", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
 
     MPI_Op opC = NativeOp<Real>( op );
     EL_CHECK_MPI
@@ -2272,6 +3019,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( count == 0 || Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::AllReduce", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
@@ -2305,6 +3056,10 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::AllReduce", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
     if( count == 0 )
         return;
 
@@ -2325,12 +3080,231 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllReduce", comm,
+      count*sizeof(*sbuf),
+      count*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllReduce", comm,
+      count*sizeof(*sbuf),
+      count*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        EL_CHECK_MPI
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        EL_CHECK_MPI
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+            &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf),
+        rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllReduce", comm,
+      count*sizeof(*sbuf),
+      count*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 )
+    {
+        // A reused request must not unpack into a stale buffer upon Wait
+        request.backend = MPI_REQUEST_NULL;
+        request.receivingPacked = false;
+        request.recvCount = 0;
+        request.unpackedRecvBuf = nullptr;
+        return;
+    }
+    MPI_Op opC = NativeOp<T>( op );
+
+    // The request buffer holds the packed receive data followed by the
+    // packed send data so that both outlive this call
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( count, rbuf, request.buffer );
+    const size_t recvBytes = request.buffer.size();
+    std::vector<byte> packedSend;
+    Serialize( count, sbuf, packedSend );
+    request.buffer.insert
+    ( request.buffer.end(), packedSend.begin(), packedSend.end() );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( request.buffer.data()+recvBytes, request.buffer.data(), count,
+        TypeMap<T>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllReduce", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 || Size(comm) == 1 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllReduce", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 || Size(comm) == 1 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        EL_CHECK_MPI
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        EL_CHECK_MPI
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
+            opC, comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IAllReduce", comm,
+      count*sizeof(*buf),
+      count*sizeof(*buf) );
+    IAllReduce( const_cast<const T*>(buf), buf, count, op, comm, request );
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      rc*Size(comm)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2357,6 +3331,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      rc*Size(comm)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
     if( rc == 0 )
         return;
 
@@ -2391,6 +3369,10 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      rc*Size(comm)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2440,6 +3422,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( rc == 0 || Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      rc*Size(comm)*sizeof(*buf),
+      rc*sizeof(*buf) );
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2467,6 +3453,10 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( rc == 0 || Size(comm) == 1 )
         return;
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      rc*Size(comm)*sizeof(*buf),
+      rc*sizeof(*buf) );
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2500,6 +3490,10 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      rc*Size(comm)*sizeof(*buf),
+      rc*sizeof(*buf) );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2531,6 +3525,129 @@ void ReduceScatter( T* buf, int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { ReduceScatter( buf, rc, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IReduceScatter", comm,
+      rc*Size(comm)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    EL_CHECK_MPI
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Real*>(sbuf), rbuf, rc, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IReduceScatter", comm,
+      rc*Size(comm)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        EL_CHECK_MPI
+        ( MPI_Ireduce_scatter_block
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*rc, TypeMap<Real>(),
+            opC, comm.comm, &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        EL_CHECK_MPI
+        ( MPI_Ireduce_scatter_block
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, rc,
+            TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    EL_CHECK_MPI
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, rc, TypeMap<Complex<Real>>(),
+        opC, comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::IReduceScatter", comm,
+      rc*Size(comm)*sizeof(*sbuf),
+      rc*sizeof(*sbuf) );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( rc == 0 )
+    {
+        // A reused request must not unpack into a stale buffer upon Wait
+        request.backend = MPI_REQUEST_NULL;
+        request.receivingPacked = false;
+        request.recvCount = 0;
+        request.unpackedRecvBuf = nullptr;
+        return;
+    }
+    const int commSize = mpi::Size(comm);
+    MPI_Op opC = NativeOp<T>( op );
+
+    // The request buffer holds the packed receive data followed by the
+    // packed send data so that both outlive this call
+    request.receivingPacked = true;
+    request.recvCount = rc;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc, rbuf, request.buffer );
+    const size_t recvBytes = request.buffer.size();
+    std::vector<byte> packedSend;
+    Serialize( rc*commSize, sbuf, packedSend );
+    request.buffer.insert
+    ( request.buffer.end(), packedSend.begin(), packedSend.end() );
+    EL_CHECK_MPI
+    ( MPI_Ireduce_scatter_block
+      ( request.buffer.data()+recvBytes, request.buffer.data(), rc,
+        TypeMap<T>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request )
+{ IReduceScatter( sbuf, rbuf, rc, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter
@@ -2538,6 +3655,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      TotalCount(rcs,comm)*sizeof(*sbuf),
+      rcs[Rank(comm)]*sizeof(*sbuf) );
     MPI_Op opC = NativeOp<Real>( op );
     EL_CHECK_MPI
     ( MPI_Reduce_scatter
@@ -2553,6 +3674,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      TotalCount(rcs,comm)*sizeof(*sbuf),
+      rcs[Rank(comm)]*sizeof(*sbuf) );
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2594,6 +3719,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ( "mpi::ReduceScatter", comm,
+      TotalCount(rcs,comm)*sizeof(*sbuf),
+      rcs[Rank(comm)]*sizeof(*sbuf) );
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2634,6 +3763,133 @@ void VerifySendsAndRecvs
              " but recv'd ",actualRecvCounts[q]," from process ",q);
 }
 
+void CreateContiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_CHECK_MPI( MPI_Type_contiguous( count, oldType, &newType ) );
+    EL_CHECK_MPI( MPI_Type_commit( &newType ) );
+}
+
+void CreateVector
+( int count, int blockLength, int stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_CHECK_MPI
+    ( MPI_Type_vector( count, blockLength, stride, oldType, &newType ) );
+    EL_CHECK_MPI( MPI_Type_commit( &newType ) );
+}
+
+void CreateHVector
+( int count, int blockLength, Aint stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_CHECK_MPI
+    ( MPI_Type_create_hvector
+      ( count, blockLength, stride, oldType, &newType ) );
+    EL_CHECK_MPI( MPI_Type_commit( &newType ) );
+}
+
+namespace {
+
+void CheckFileError( int error, const char* routine )
+{
+    if( error != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int lengthOfErrorString;
+        MPI_Error_string( error, errorString, &lengthOfErrorString );
+        RuntimeError(routine," failed: ",std::string(errorString));
+    }
+}
+
+} // anonymous namespace
+
+void FileOpen
+( Comm comm, const std::string& filename, int mode, File& file )
+{
+    EL_DEBUG_CSE
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), mode,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+}
+
+void FileClose( File& file )
+{
+    EL_DEBUG_CSE
+    CheckFileError( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+Offset FileGetSize( File file )
+{
+    EL_DEBUG_CSE
+    Offset size;
+    CheckFileError( MPI_File_get_size( file, &size ), "MPI_File_get_size" );
+    return size;
+}
+
+void FileSetSize( File file, Offset size )
+{
+    EL_DEBUG_CSE
+    CheckFileError( MPI_File_set_size( file, size ), "MPI_File_set_size" );
+}
+
+void FileSetView
+( File file, Offset disp, Datatype entryType, Datatype fileType )
+{
+    EL_DEBUG_CSE
+    CheckFileError
+    ( MPI_File_set_view
+      ( file, disp, entryType, fileType, const_cast<char*>("native"),
+        MPI_INFO_NULL ),
+      "MPI_File_set_view" );
+}
+
+void FileReadAtAll
+( File file, Offset offset, void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    CheckFileError
+    ( MPI_File_read_at_all( file, offset, buf, count, type, &status ),
+      "MPI_File_read_at_all" );
+}
+
+void FileWriteAt
+( File file, Offset offset, const void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    CheckFileError
+    ( MPI_File_write_at
+      ( file, offset, const_cast<void*>(buf), count, type, &status ),
+      "MPI_File_write_at" );
+}
+
+void FileReadAll( File file, void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    CheckFileError
+    ( MPI_File_read_all( file, buf, count, type, &status ),
+      "MPI_File_read_all" );
+}
+
+void FileWriteAll( File file, const void* buf, int count, Datatype type )
+{
+    EL_DEBUG_CSE
+    Status status;
+    CheckFileError
+    ( MPI_File_write_all
+      ( file, const_cast<void*>(buf), count, type, &status ),
+      "MPI_File_write_all" );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
@@ -2916,6 +4172,16 @@ EL_NO_RELEASE_EXCEPT
   ( int from, int tag, Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template T IRecv<T>( int from, Comm comm, Request<T>& request ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void SendInit \
+  ( const T* buf, int count, int to, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void RecvInit \
+  ( T* buf, int count, int from, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
+  template void StartAll( int numRequests, Request<T>* requests ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template void TaggedSendRecv \
   ( const T* sbuf, int sc, int to,   int stag, \
           T* rbuf, int rc, int from, int rtag, Comm comm ) \
@@ -2954,6 +4220,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2978,6 +4247,13 @@ EL_NO_RELEASE_EXCEPT
     const vector<int>& sendOffs, \
     Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllToAll \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
+  template void IAllToAll \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, Comm comm, \
+    Request<T>& request ); \
   template void Reduce \
   ( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
@@ -3005,6 +4281,15 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -3017,6 +4302,11 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* buf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void ReduceScatter \
   ( const T* sbuf, T* rbuf, const int* rcs, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
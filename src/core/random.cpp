@@ -13,6 +13,13 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The key of the counter-based generator, which is shared by all processes,
+// the number of local random matrices generated by this process, and the
+// number of grids which this process has taken part in constructing
+std::uint64_t counterSeed = 0;
+std::atomic<std::uint64_t> localRandomStream(0);
+std::uint64_t gridRandomId = 0;
+
 #ifdef HYDROGEN_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -31,6 +38,12 @@ void InitializeRandom( bool deterministic )
 
     srand( seed );
 
+    // The counter-based key must agree between the processes
+    long sharedSecs = secs;
+    if( !deterministic )
+        mpi::Broadcast( sharedSecs, 0, mpi::COMM_WORLD );
+    SetCounterSeed( std::uint64_t(sharedSecs) );
+
 #ifdef HYDROGEN_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
@@ -49,6 +62,39 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+std::uint64_t CounterSeed() { return ::counterSeed; }
+
+void SetCounterSeed( std::uint64_t seed )
+{
+    ::counterSeed = seed;
+    ::localRandomStream = 0;
+}
+
+std::uint64_t NextLocalRandomStream()
+{
+    // Local streams set the top bit, which distributed streams never do,
+    // and then carry the rank
+    const std::uint64_t rank = mpi::Rank( mpi::COMM_WORLD );
+    return (std::uint64_t(1)<<63) | ((rank & 0x7FFFFF)<<40) |
+           (::localRandomStream.fetch_add(1) & ((std::uint64_t(1)<<40)-1));
+}
+
+std::uint64_t FirstDistRandomStream( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // The processes agree upon the largest of their grid counters, so that a
+    // process which belongs to two grids never reuses a stream, and upon the
+    // smallest world rank, which tells apart disjoint communicators that
+    // happen to have constructed the same number of grids
+    const unsigned long long rank = mpi::Rank( mpi::COMM_WORLD );
+    unsigned long long buf[2] = { ::gridRandomId, 0x7FFFFF - rank };
+    mpi::AllReduce( buf, 2, mpi::MAX, comm );
+    const std::uint64_t gridId = buf[0];
+    const std::uint64_t minRank = 0x7FFFFF - buf[1];
+    ::gridRandomId = gridId + 1;
+    return ((minRank & 0x7FFFFF)<<40) | ((gridId & 0xFFF)<<28);
+}
+
 #ifdef HYDROGEN_HAVE_MPC
 namespace mpfr {
 
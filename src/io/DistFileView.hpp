@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_DISTFILEVIEW_HPP
+#define EL_IO_DISTFILEVIEW_HPP
+
+namespace El {
+namespace io {
+
+// Whether the local entries of A can be read or written directly by each
+// process through MPI-IO rather than funneled through a single process.
+// This requires entries with a fixed binary layout which are stored on the
+// CPU under an elemental distribution.
+template<typename T>
+bool SupportsParallelIO( const AbstractDistMatrix<T>& A )
+{
+    return IsPacked<T>::value &&
+           A.Wrap() == ELEMENT &&
+           A.GetLocalDevice() == Device::CPU;
+}
+
+// The file view of the local entries of an elemental [U,V] distribution of
+// a matrix stored in column-major order starting at byte 'offset' of a
+// file. Entry (i,j) of the local matrix is global entry
+// (colShift+i*colStride,rowShift+j*rowStride), so the local entries form a
+// strided vector of strided columns.
+//
+// Inactive processes select no entries but must still take part in the
+// collective reads and writes.
+template<typename T>
+class DistFileView
+{
+public:
+    DistFileView
+    ( const AbstractDistMatrix<T>& A, mpi::Offset offset, bool active )
+    : offset_(offset)
+    {
+        EL_DEBUG_CSE
+        const Int height = A.Height();
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        active_ = active && localHeight > 0 && localWidth > 0;
+
+        mpi::CreateContiguous( sizeof(T), MPI_BYTE, entryType_ );
+        if( active_ )
+        {
+            mpi::Datatype colType;
+            mpi::CreateVector
+            ( localHeight, 1, A.ColStride(), entryType_, colType );
+            mpi::CreateHVector
+            ( localWidth, 1, mpi::Aint(A.RowStride())*height*sizeof(T),
+              colType, fileType_ );
+            mpi::Free( colType );
+            mpi::CreateVector
+            ( localWidth, localHeight, A.LDim(), entryType_, memoryType_ );
+            offset_ +=
+              (mpi::Offset(A.RowShift())*height+A.ColShift())*sizeof(T);
+        }
+    }
+
+    ~DistFileView()
+    {
+        if( active_ )
+        {
+            mpi::Free( fileType_ );
+            mpi::Free( memoryType_ );
+        }
+        mpi::Free( entryType_ );
+    }
+
+    // Collectively read the local entries into the buffer of A
+    void Read( mpi::File file, T* buffer ) const
+    {
+        EL_DEBUG_CSE
+        if( active_ )
+        {
+            mpi::FileSetView( file, offset_, entryType_, fileType_ );
+            mpi::FileReadAll( file, buffer, 1, memoryType_ );
+        }
+        else
+        {
+            mpi::FileSetView( file, offset_, entryType_, entryType_ );
+            mpi::FileReadAll( file, buffer, 0, entryType_ );
+        }
+    }
+
+    // Collectively write the local entries from the buffer of A
+    void Write( mpi::File file, const T* buffer ) const
+    {
+        EL_DEBUG_CSE
+        if( active_ )
+        {
+            mpi::FileSetView( file, offset_, entryType_, fileType_ );
+            mpi::FileWriteAll( file, buffer, 1, memoryType_ );
+        }
+        else
+        {
+            mpi::FileSetView( file, offset_, entryType_, entryType_ );
+            mpi::FileWriteAll( file, buffer, 0, entryType_ );
+        }
+    }
+
+private:
+    bool active_;
+    mpi::Offset offset_;
+    mpi::Datatype entryType_, fileType_, memoryType_;
+};
+
+} // namespace io
+} // namespace El
+
+#endif // ifndef EL_IO_DISTFILEVIEW_HPP
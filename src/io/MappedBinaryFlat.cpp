@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef EL_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace El {
+
+template<typename T>
+MappedBinaryFlat<T>::MappedBinaryFlat
+( const string& filename, Int height, Int width, const MappedFileCtrl& ctrl )
+: writable_(ctrl.writable)
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 )
+        LogicError("Invalid matrix dimensions: ",height," x ",width);
+    numBytes_ = std::size_t(height)*width*sizeof(T);
+#ifdef EL_HAVE_MMAP
+    const int fd =
+      open( filename.c_str(), writable_ ? O_RDWR | O_CREAT : O_RDONLY, 0644 );
+    if( fd == -1 )
+        RuntimeError("Could not open ",filename);
+
+    if( writable_ )
+    {
+        if( ftruncate( fd, off_t(numBytes_) ) != 0 )
+        {
+            close( fd );
+            RuntimeError
+            ("Could not resize ",filename," to ",numBytes_," bytes");
+        }
+    }
+    else
+    {
+        struct stat fileStat;
+        if( fstat( fd, &fileStat ) != 0 )
+        {
+            close( fd );
+            RuntimeError("Could not determine the size of ",filename);
+        }
+        if( std::size_t(fileStat.st_size) != numBytes_ )
+        {
+            close( fd );
+            RuntimeError
+            ("Expected file to be ",numBytes_," bytes but found ",
+             fileStat.st_size);
+        }
+    }
+
+    // Empty regions cannot be mapped
+    if( numBytes_ > 0 )
+    {
+        const int protection = writable_ ? PROT_READ | PROT_WRITE : PROT_READ;
+        int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+        if( ctrl.populate )
+            flags |= MAP_POPULATE;
+#endif
+        data_ = mmap( nullptr, numBytes_, protection, flags, fd, 0 );
+        if( data_ == MAP_FAILED )
+        {
+            data_ = nullptr;
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+        // The hints are advisory, so their failure is not an error
+        if( ctrl.sequential )
+            madvise( data_, numBytes_, MADV_SEQUENTIAL );
+        if( ctrl.willNeed )
+            madvise( data_, numBytes_, MADV_WILLNEED );
+    }
+    // The mapping remains valid after the descriptor is closed
+    close( fd );
+#else
+    RuntimeError("Memory-mapped files are not supported on this platform");
+#endif
+
+    T* buffer = static_cast<T*>(data_);
+    if( writable_ )
+        A_.Attach( height, width, buffer, Max(height,1) );
+    else
+        A_.LockedAttach( height, width, buffer, Max(height,1) );
+}
+
+template<typename T>
+MappedBinaryFlat<T>::~MappedBinaryFlat()
+{
+    A_.Empty();
+#ifdef EL_HAVE_MMAP
+    if( data_ != nullptr )
+        munmap( data_, numBytes_ );
+#endif
+}
+
+template<typename T>
+const Matrix<T>& MappedBinaryFlat<T>::LockedMatrix() const EL_NO_EXCEPT
+{ return A_; }
+
+template<typename T>
+Matrix<T>& MappedBinaryFlat<T>::Matrix()
+{
+    EL_DEBUG_CSE
+    if( !writable_ )
+        LogicError("Cannot modify a read-only mapping");
+    return A_;
+}
+
+template<typename T>
+void MappedBinaryFlat<T>::Flush()
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( writable_ && data_ != nullptr && msync( data_, numBytes_, MS_SYNC ) )
+        RuntimeError("Could not flush the mapped file");
+#endif
+}
+
+// None of the EL_ENABLE_* types are instantiated, since BigInt and BigFloat
+// hold pointers rather than their values (see the static_assert in io.hpp)
+#define PROTO(T) template class MappedBinaryFlat<T>;
+
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./DistFileView.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
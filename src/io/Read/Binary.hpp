@@ -40,11 +40,48 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Every process collectively reads its own entries through MPI-IO. Each of
+// the redundant copies is read directly from the file.
+template<typename T>
+inline void
+ParallelBinary( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
+
+    Int dims[2];
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    mpi::FileReadAtAll( file, 0, dims, int(metaBytes), MPI_BYTE );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const mpi::Offset numBytes = mpi::FileGetSize( file );
+    const mpi::Offset dataBytes = mpi::Offset(height)*width*sizeof(T);
+    const mpi::Offset numBytesExp = metaBytes + dataBytes;
+    if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+
+    A.Resize( height, width );
+    io::DistFileView<T> view( A, metaBytes, A.Participating() );
+    view.Read( file, A.Buffer() );
+    mpi::FileClose( file );
+}
+
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
+    if( io::SupportsParallelIO( A ) )
+    {
+        ParallelBinary( A, filename );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
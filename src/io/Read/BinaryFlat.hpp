@@ -35,12 +35,43 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Every process collectively reads its own entries through MPI-IO
+template<typename T>
+inline void
+ParallelBinaryFlat
+( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
+{
+    EL_DEBUG_CSE
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
+
+    const mpi::Offset numBytes = mpi::FileGetSize( file );
+    const mpi::Offset numBytesExp = mpi::Offset(height)*width*sizeof(T);
+    if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+
+    A.Resize( height, width );
+    io::DistFileView<T> view( A, 0, A.Participating() );
+    view.Read( file, A.Buffer() );
+    mpi::FileClose( file );
+}
+
 template<typename T>
 inline void
 BinaryFlat
 ( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
 {
     EL_DEBUG_CSE
+    if( io::SupportsParallelIO( A ) )
+    {
+        ParallelBinaryFlat( A, height, width, filename );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
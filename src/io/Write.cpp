@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./DistFileView.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
@@ -73,7 +74,11 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY && io::SupportsParallelIO( A ) )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT && io::SupportsParallelIO( A ) )
+        write::BinaryFlat( A, basename );
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
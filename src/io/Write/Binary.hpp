@@ -35,6 +35,35 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process collectively writes its own entries through MPI-IO, with
+// only the first of the redundant copies being written
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen
+    ( comm, filename, mpi::MODE_WRONLY | mpi::MODE_CREATE, file );
+
+    // Truncate any previous contents of the file
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset dataBytes = mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, metaBytes+dataBytes );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        mpi::FileWriteAt( file, 0, dims, int(metaBytes), MPI_BYTE );
+    }
+
+    io::DistFileView<T> view
+    ( A, metaBytes, A.Participating() && A.RedundantRank() == 0 );
+    view.Write( file, A.LockedBuffer() );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
@@ -30,6 +30,28 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process collectively writes its own entries through MPI-IO, with
+// only the first of the redundant copies being written
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::File file;
+    mpi::FileOpen
+    ( A.Grid().ViewingComm(), filename,
+      mpi::MODE_WRONLY | mpi::MODE_CREATE, file );
+
+    // Truncate any previous contents of the file
+    mpi::FileSetSize( file, mpi::Offset(A.Height())*A.Width()*sizeof(T) );
+
+    io::DistFileView<T> view
+    ( A, 0, A.Participating() && A.RedundantRank() == 0 );
+    view.Write( file, A.LockedBuffer() );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
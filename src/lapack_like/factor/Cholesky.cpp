@@ -31,10 +31,11 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A )
       if( A.Height() != A.Width() )
           LogicError("A must be square");
     )
+    EL_PROFILE_REGION("Cholesky");
     if( uplo == LOWER )
-        cholesky::LowerVariant3Blocked( A );
+        cholesky::LowerVariant3Tiled( A );
     else
-        cholesky::UpperVariant3Blocked( A );
+        cholesky::UpperVariant3Tiled( A );
 }
 
 template<typename F>
@@ -96,6 +97,7 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky");
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
@@ -103,9 +105,9 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     else
     {
         if( uplo == LOWER )
-            cholesky::LowerVariant3Blocked( A );
+            cholesky::LowerVariant3Lookahead( A );
         else
-            cholesky::UpperVariant3Blocked( A );
+            cholesky::UpperVariant3Lookahead( A );
     }
 }
 
@@ -203,6 +205,9 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
         qr::ExplicitTriang( A );
 }
 
+// NOTE: The pivoted variants, CholeskyMod, and HPSDCholesky are not
+//       instantiated until Permutation, Ger, and the spectral routines which
+//       they rely upon are built
 #define PROTO_BASE(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
@@ -213,41 +218,16 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
   template void ReverseCholesky \
   ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
-  template void Cholesky( UpperOrLower uplo, Matrix<F>& A, Permutation& p ); \
-  template void Cholesky \
-  ( UpperOrLower uplo, \
-    AbstractDistMatrix<F>& A, \
-    DistPermutation& p ); \
-  template void CholeskyMod \
-  ( UpperOrLower uplo, Matrix<F>& T, Base<F> alpha, Matrix<F>& V ); \
-  template void CholeskyMod \
-  ( UpperOrLower uplo, \
-    AbstractDistMatrix<F>& T, \
-    Base<F> alpha, \
-    AbstractDistMatrix<F>& V ); \
-  template void cholesky::SolveAfter \
-  ( UpperOrLower uplo, Orientation orientation, \
-    const Matrix<F>& A, \
-          Matrix<F>& B ); \
-  template void cholesky::SolveAfter \
-  ( UpperOrLower uplo, Orientation orientation, \
-    const AbstractDistMatrix<F>& A, \
-          AbstractDistMatrix<F>& B ); \
   template void cholesky::SolveAfter \
   ( UpperOrLower uplo, Orientation orientation, \
     const Matrix<F>& A, \
-    const Permutation& p, \
           Matrix<F>& B ); \
   template void cholesky::SolveAfter \
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
-    const DistPermutation& p, \
-          AbstractDistMatrix<F>& B ); 
+          AbstractDistMatrix<F>& B );
 
-#define PROTO(F) \
-  PROTO_BASE(F) \
-  template void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A ); \
-  template void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
+#define PROTO(F) PROTO_BASE(F)
 
 #define PROTO_DOUBLEDOUBLE PROTO_BASE(DoubleDouble)
 #define PROTO_QUADDOUBLE PROTO_BASE(QuadDouble)
@@ -67,6 +67,94 @@ void LowerVariant3Blocked( Matrix<F>& A )
     }
 }
 
+// Right-looking Cholesky over a square tiling of A whose factorization,
+// triangular solves, and trailing updates of each tile are issued as OpenMP
+// tasks. Since each task only waits on the tiles it reads, the factorization
+// of a diagonal tile can proceed as soon as its own updates have completed,
+// rather than after the entire trailing matrix of the previous step.
+template<typename F>
+void LowerVariant3Tiled( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+#ifdef EL_HYBRID
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n <= bsize || omp_get_max_threads() == 1 )
+    {
+        LowerVariant3Blocked( A );
+        return;
+    }
+    const Int numTiles = (n+bsize-1) / bsize;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    // The leading entry of each tile stands in for the tile as a whole
+    // within the task dependencies
+    auto tile = [&]( Int i, Int j ) { return &ABuf[(i+j*ALDim)*bsize]; };
+    auto size = [&]( Int i ) { return Min(bsize,n-i*bsize); };
+
+    // Exceptions cannot propagate out of a task
+    bool failed = false;
+
+    #pragma omp parallel
+    #pragma omp single
+    for( Int k=0; k<numTiles; ++k )
+    {
+        F* Akk = tile(k,k);
+        const Int nbk = size(k);
+        #pragma omp task depend(inout:Akk[0])
+        {
+            Matrix<F> A11;
+            A11.Attach( nbk, nbk, Akk, ALDim );
+            try { LowerVariant3Unblocked( A11 ); }
+            catch( NonHPDMatrixException& )
+            {
+                #pragma omp atomic write
+                failed = true;
+            }
+        }
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+            F* Aik = tile(i,k);
+            const Int nbi = size(i);
+            #pragma omp task depend(in:Akk[0]) depend(inout:Aik[0])
+            blas::Trsm
+            ( 'R', 'L', 'C', 'N', nbi, nbk,
+              F(1), Akk, ALDim, Aik, ALDim );
+        }
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+            F* Ajk = tile(j,k);
+            F* Ajj = tile(j,j);
+            const Int nbj = size(j);
+            #pragma omp task depend(in:Ajk[0]) depend(inout:Ajj[0])
+            blas::Herk
+            ( 'L', 'N', nbj, nbk,
+              -Real(1), Ajk, ALDim, Real(1), Ajj, ALDim );
+            for( Int i=j+1; i<numTiles; ++i )
+            {
+                F* Aik = tile(i,k);
+                F* Aij = tile(i,j);
+                const Int nbi = size(i);
+                #pragma omp task depend(in:Aik[0],Ajk[0]) depend(inout:Aij[0])
+                blas::Gemm
+                ( 'N', 'C', nbi, nbj, nbk,
+                  F(-1), Aik, ALDim, Ajk, ALDim, F(1), Aij, ALDim );
+            }
+        }
+    }
+    if( failed )
+        throw NonHPDMatrixException("A was not numerically HPD");
+#else
+    LowerVariant3Blocked( A );
+#endif // ifdef EL_HYBRID
+}
+
 template<typename F>
 void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
@@ -125,6 +213,127 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A variant of LowerVariant3Blocked which overlaps the gather of each panel
+// with the trailing update from the previous one (a lookahead of depth one):
+// the columns of the next panel are updated first so that its AllGather can
+// be started before the remainder of the trailing matrix is updated.
+template<typename F>
+void LowerVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int rowStride = A.RowStride();
+    mpi::Comm rowComm = A.RowComm();
+
+    // Every panel is packed into portions sized for the widest one
+    const Int portionSize = A.LocalHeight()*MaxLength(bsize,rowStride);
+    simple_buffer<F,Device::CPU> sendBuf, recvBuf;
+    sendBuf.allocate( portionSize );
+    recvBuf.allocate( rowStride*portionSize );
+    mpi::Request<F> request;
+
+    auto startPanel = [&]( Int k )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto APan = A( IR(k,n), IR(k,k+nb) );
+        copy::util::InterleaveMatrix<F,Device::CPU>
+        ( APan.LocalHeight(), APan.LocalWidth(),
+          APan.LockedBuffer(), 1, APan.LDim(),
+          sendBuf.data(), 1, APan.LocalHeight() );
+        mpi::IAllGather
+        ( sendBuf.data(), portionSize,
+          recvBuf.data(), portionSize, rowComm, request );
+    };
+
+    DistMatrix<F,MC,  STAR> APan_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
+
+    if( n > 0 )
+        startPanel( 0 );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-(k+nb));
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto APan = A( IR(k,n), ind1 );
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        // APan[MC,* ] <- APan[MC,MR]
+        APan_MC_STAR.AlignWith( APan );
+        APan_MC_STAR.Resize( n-k, nb );
+        mpi::Wait( request );
+        copy::util::RowStridedUnpack<F,Device::CPU>
+        ( APan.LocalHeight(), nb, APan.RowAlign(), rowStride,
+          recvBuf.data(), portionSize,
+          APan_MC_STAR.Buffer(), APan_MC_STAR.LDim() );
+        auto A11_MC_STAR = APan_MC_STAR( IR(0,nb), ALL );
+        auto A21_MC_STAR = APan_MC_STAR( IR(nb,END), ALL );
+
+        A11_STAR_STAR = A11_MC_STAR;
+        Cholesky( LOWER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        // Each process in a row redundantly solves against its rows of the
+        // panel, which avoids gathering them again after the solve
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
+        A21 = A21_MC_STAR;
+        if( nbNext == 0 )
+            break;
+
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = A21_MC_STAR;
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21_VC_STAR;
+        A21Adj_STAR_MR.AlignWith( A22 );
+        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+
+        const Range<Int> indNext( k+nb, k+nb+nbNext ),
+                         indRest( k+nb+nbNext, n );
+        auto L21Next_MC_STAR = A21_MC_STAR( IR(0,nbNext), ALL );
+        auto L21Rest_MC_STAR = A21_MC_STAR( IR(nbNext,END), ALL );
+        auto L21NextAdj_STAR_MR = A21Adj_STAR_MR( ALL, IR(0,nbNext) );
+        auto L21RestAdj_STAR_MR = A21Adj_STAR_MR( ALL, IR(nbNext,END) );
+        auto ANext11 = A( indNext, indNext );
+        auto ANext21 = A( indRest, indNext );
+        auto ARest = A( indRest, indRest );
+
+        // ANext[MC,MR] -= L21[MC,* ] L21Next^H[* ,MR]
+        LocalTrrk
+        ( LOWER, F(-1), L21Next_MC_STAR, L21NextAdj_STAR_MR, F(1), ANext11 );
+        LocalGemm
+        ( NORMAL, NORMAL,
+          F(-1), L21Rest_MC_STAR, L21NextAdj_STAR_MR, F(1), ANext21 );
+        startPanel( k+nb );
+
+        // ARest[MC,MR] -= L21Rest[MC,* ] L21Rest^H[* ,MR]
+        LocalTrrk
+        ( LOWER, F(-1), L21Rest_MC_STAR, L21RestAdj_STAR_MR, F(1), ARest );
+    }
+#else
+    LowerVariant3Blocked( APre );
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -72,6 +72,90 @@ void UpperVariant3Blocked( Matrix<F>& A )
     }
 }
 
+// The upper-triangular analogue of LowerVariant3Tiled
+template<typename F>
+void UpperVariant3Tiled( Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+#ifdef EL_HYBRID
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n <= bsize || omp_get_max_threads() == 1 )
+    {
+        UpperVariant3Blocked( A );
+        return;
+    }
+    const Int numTiles = (n+bsize-1) / bsize;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    // The leading entry of each tile stands in for the tile as a whole
+    // within the task dependencies
+    auto tile = [&]( Int i, Int j ) { return &ABuf[(i+j*ALDim)*bsize]; };
+    auto size = [&]( Int i ) { return Min(bsize,n-i*bsize); };
+
+    // Exceptions cannot propagate out of a task
+    bool failed = false;
+
+    #pragma omp parallel
+    #pragma omp single
+    for( Int k=0; k<numTiles; ++k )
+    {
+        F* Akk = tile(k,k);
+        const Int nbk = size(k);
+        #pragma omp task depend(inout:Akk[0])
+        {
+            Matrix<F> A11;
+            A11.Attach( nbk, nbk, Akk, ALDim );
+            try { UpperVariant3Unblocked( A11 ); }
+            catch( NonHPDMatrixException& )
+            {
+                #pragma omp atomic write
+                failed = true;
+            }
+        }
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+            F* Akj = tile(k,j);
+            const Int nbj = size(j);
+            #pragma omp task depend(in:Akk[0]) depend(inout:Akj[0])
+            blas::Trsm
+            ( 'L', 'U', 'C', 'N', nbk, nbj,
+              F(1), Akk, ALDim, Akj, ALDim );
+        }
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+            F* Akj = tile(k,j);
+            F* Ajj = tile(j,j);
+            const Int nbj = size(j);
+            for( Int i=k+1; i<j; ++i )
+            {
+                F* Aki = tile(k,i);
+                F* Aij = tile(i,j);
+                const Int nbi = size(i);
+                #pragma omp task depend(in:Aki[0],Akj[0]) depend(inout:Aij[0])
+                blas::Gemm
+                ( 'C', 'N', nbi, nbj, nbk,
+                  F(-1), Aki, ALDim, Akj, ALDim, F(1), Aij, ALDim );
+            }
+            #pragma omp task depend(in:Akj[0]) depend(inout:Ajj[0])
+            blas::Herk
+            ( 'U', 'C', nbj, nbk,
+              -Real(1), Akj, ALDim, Real(1), Ajj, ALDim );
+        }
+    }
+    if( failed )
+        throw NonHPDMatrixException("A was not numerically HPD");
+#else
+    UpperVariant3Blocked( A );
+#endif // ifdef EL_HYBRID
+}
+
 template<typename F>
 void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
@@ -122,6 +206,124 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// The upper-triangular analogue of LowerVariant3Lookahead, which gathers
+// each block row of the panel within the process columns
+template<typename F>
+void UpperVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int colStride = A.ColStride();
+    mpi::Comm colComm = A.ColComm();
+
+    // Every panel is packed into portions sized for the tallest one
+    const Int portionSize = MaxLength(bsize,colStride)*A.LocalWidth();
+    simple_buffer<F,Device::CPU> sendBuf, recvBuf;
+    sendBuf.allocate( portionSize );
+    recvBuf.allocate( colStride*portionSize );
+    mpi::Request<F> request;
+
+    auto startPanel = [&]( Int k )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto APan = A( IR(k,k+nb), IR(k,n) );
+        copy::util::InterleaveMatrix<F,Device::CPU>
+        ( APan.LocalHeight(), APan.LocalWidth(),
+          APan.LockedBuffer(), 1, APan.LDim(),
+          sendBuf.data(), 1, APan.LocalHeight() );
+        mpi::IAllGather
+        ( sendBuf.data(), portionSize,
+          recvBuf.data(), portionSize, colComm, request );
+    };
+
+    DistMatrix<F,STAR,MR  > APan_STAR_MR(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,MC  > A12_STAR_MC(g);
+
+    if( n > 0 )
+        startPanel( 0 );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-(k+nb));
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto APan = A( ind1, IR(k,n) );
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        // APan[* ,MR] <- APan[MC,MR]
+        APan_STAR_MR.AlignWith( APan );
+        APan_STAR_MR.Resize( nb, n-k );
+        mpi::Wait( request );
+        copy::util::ColStridedUnpack<F,Device::CPU>
+        ( nb, APan.LocalWidth(), APan.ColAlign(), colStride,
+          recvBuf.data(), portionSize,
+          APan_STAR_MR.Buffer(), APan_STAR_MR.LDim() );
+        auto A11_STAR_MR = APan_STAR_MR( ALL, IR(0,nb) );
+        auto A12_STAR_MR = APan_STAR_MR( ALL, IR(nb,END) );
+
+        A11_STAR_STAR = A11_STAR_MR;
+        Cholesky( UPPER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        // Each process in a column redundantly solves against its columns
+        // of the panel, which avoids gathering them again after the solve
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_MR );
+        A12 = A12_STAR_MR;
+        if( nbNext == 0 )
+            break;
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12_STAR_MR;
+        A12_STAR_MC.AlignWith( A22 );
+        A12_STAR_MC = A12_STAR_VR;
+
+        const Range<Int> indNext( k+nb, k+nb+nbNext ),
+                         indRest( k+nb+nbNext, n );
+        auto U12Next_STAR_MC = A12_STAR_MC( ALL, IR(0,nbNext) );
+        auto U12Next_STAR_MR = A12_STAR_MR( ALL, IR(0,nbNext) );
+        auto U12Rest_STAR_MC = A12_STAR_MC( ALL, IR(nbNext,END) );
+        auto U12Rest_STAR_MR = A12_STAR_MR( ALL, IR(nbNext,END) );
+        auto ANext11 = A( indNext, indNext );
+        auto ANext12 = A( indNext, indRest );
+        auto ARest = A( indRest, indRest );
+
+        // ANext[MC,MR] -= U12Next^H[MC,* ] U12[* ,MR]
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), U12Next_STAR_MC, U12Next_STAR_MR, F(1), ANext11 );
+        LocalGemm
+        ( ADJOINT, NORMAL,
+          F(-1), U12Next_STAR_MC, U12Rest_STAR_MR, F(1), ANext12 );
+        startPanel( k+nb );
+
+        // ARest[MC,MR] -= U12Rest^H[MC,* ] U12Rest[* ,MR]
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), U12Rest_STAR_MC, U12Rest_STAR_MR, F(1), ARest );
+    }
+#else
+    UpperVariant3Blocked( APre );
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+}
+
 } // namespace cholesky
 } // namespace El
 
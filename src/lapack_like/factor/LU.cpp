@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -151,14 +152,13 @@ void LU
     lu::Full( A, P, Q );
 }
 
+namespace lu {
+
+// Blocked, right-looking LU with either partial or tournament pivoting
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void RowPivoted( DistMatrix<F>& A, DistPermutation& P, bool tournament )
 {
     EL_DEBUG_CSE
-
-    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
-    auto& A = AProx.Get();
-
     const Grid& g = A.Grid();
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
     DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
@@ -199,7 +199,10 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( tournament )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -220,6 +223,117 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+// The largest magnitude within the upper trapezoid of A
+template<typename F>
+Base<F> UpperMaxNorm( const Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Real maxAbs = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<=Min(j,m-1); ++i )
+            maxAbs = Max( maxAbs, Abs(A(i,j)) );
+    return maxAbs;
+}
+
+template<typename F>
+Base<F> UpperMaxNorm( const DistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Matrix<F>& ALoc = A.LockedMatrix();
+    Real localMaxAbs = 0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int numUpperRows = Min( A.LocalRowOffset(j+1), localHeight );
+        for( Int iLoc=0; iLoc<numUpperRows; ++iLoc )
+            localMaxAbs = Max( localMaxAbs, Abs(ALoc(iLoc,jLoc)) );
+    }
+    return mpi::AllReduce( localMaxAbs, mpi::MAX, A.DistComm() );
+}
+
+template<typename Real>
+Real GrowthFactor( Real maxAbsA, Real maxAbsU )
+{ return maxAbsA == Real(0) ? Real(0) : maxAbsU / maxAbsA; }
+
+} // namespace lu
+
+template<typename F>
+void LU( AbstractDistMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    LU( A, P, LUCtrl() );
+}
+
+template<typename F>
+LUInfo<Base<F>>
+LU( Matrix<F>& A, Permutation& P, const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    LUInfo<Base<F>> info;
+    const Base<F> maxAbsA = ( ctrl.growth ? MaxNorm(A) : Base<F>(0) );
+    switch( ctrl.pivotType )
+    {
+    case LU_PARTIAL:
+    case LU_TOURNAMENT:
+        LU( A, P );
+        break;
+    case LU_WITHOUT_PIVOTING:
+        P.MakeIdentity( A.Height() );
+        LU( A );
+        break;
+    case LU_FULL:
+        LogicError("Full pivoting requires a column permutation");
+        break;
+    default:
+        LogicError("Unsupported LU pivot type");
+    }
+    if( ctrl.growth )
+        info.growthFactor = lu::GrowthFactor( maxAbsA, lu::UpperMaxNorm(A) );
+    return info;
+}
+
+template<typename F>
+LUInfo<Base<F>>
+LU( AbstractDistMatrix<F>& APre, DistPermutation& P, const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    LUInfo<Base<F>> info;
+    const Base<F> maxAbsA = ( ctrl.growth ? MaxNorm(A) : Base<F>(0) );
+    switch( ctrl.pivotType )
+    {
+    case LU_PARTIAL:
+        lu::RowPivoted( A, P, false );
+        break;
+    case LU_TOURNAMENT:
+        lu::RowPivoted( A, P, true );
+        break;
+    case LU_WITHOUT_PIVOTING:
+        P.SetGrid( A.Grid() );
+        P.MakeIdentity( A.Height() );
+        LU( A );
+        break;
+    case LU_FULL:
+        LogicError("Full pivoting requires a column permutation");
+        break;
+    default:
+        LogicError("Unsupported LU pivot type");
+    }
+    if( ctrl.growth )
+        info.growthFactor = lu::GrowthFactor( maxAbsA, lu::UpperMaxNorm(A) );
+    return info;
+}
+
 template<typename F>
 void LU
 ( AbstractDistMatrix<F>& A,
@@ -230,6 +344,8 @@ void LU
     lu::Full( A, P, Q );
 }
 
+// NOTE: The fully-pivoted factorizations and LUMod are not instantiated until
+//       Geru and Trsv, which they rely upon, are built
 #define PROTO(F) \
   template void LU( Matrix<F>& A ); \
   template void LU( AbstractDistMatrix<F>& A ); \
@@ -240,28 +356,14 @@ void LU
   template void LU \
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
-  template void LU \
+  template LUInfo<Base<F>> LU \
   ( Matrix<F>& A, \
     Permutation& P, \
-    Permutation& Q ); \
-  template void LU \
+    const LUCtrl& ctrl ); \
+  template LUInfo<Base<F>> LU \
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P, \
-    DistPermutation& Q ); \
-  template void LUMod \
-  (       Matrix<F>& A, \
-          Permutation& P, \
-    const Matrix<F>& U, \
-    const Matrix<F>& V, \
-    bool conjugate, \
-    Base<F> tau ); \
-  template void LUMod \
-  (       AbstractDistMatrix<F>& A, \
-          DistPermutation& P, \
-    const AbstractDistMatrix<F>& U, \
-    const AbstractDistMatrix<F>& V, \
-    bool conjugate, \
-    Base<F> tau ); \
+    const LUCtrl& ctrl ); \
   template void lu::Panel \
   ( Matrix<F>& APan, \
     Permutation& P, \
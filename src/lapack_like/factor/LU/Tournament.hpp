@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+// Reorder the candidate rows of W (and their indices) so that the first
+// Min(height(W),n) of them are the pivot rows which partial pivoting would
+// choose, leaving the candidates themselves unmodified
+template<typename F>
+void TournamentSelect( Matrix<F>& W, vector<Int>& indices )
+{
+    EL_DEBUG_CSE
+    const Int m = W.Height();
+    const Int n = W.Width();
+    const Int numPiv = Min(m,n);
+    Matrix<F> Z( W );
+    F* ZBuf = Z.Buffer();
+    F* WBuf = W.Buffer();
+    const Int ZLDim = Z.LDim();
+    const Int WLDim = W.LDim();
+    for( Int k=0; k<numPiv; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &ZBuf[k+k*ZLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &ZBuf[k], ZLDim, &ZBuf[iPiv], ZLDim );
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            std::swap( indices[k], indices[iPiv] );
+        }
+
+        // A zero pivot leaves the order of the remaining candidates
+        // arbitrary, and singularity is detected by the final factorization
+        const F alpha = ZBuf[k+k*ZLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( m-(k+1), F(1)/alpha, &ZBuf[(k+1)+k*ZLDim], 1 );
+        blas::Geru
+        ( m-(k+1), n-(k+1),
+          F(-1), &ZBuf[(k+1)+k*ZLDim], 1, &ZBuf[k+(k+1)*ZLDim], ZLDim,
+                 &ZBuf[(k+1)+(k+1)*ZLDim], ZLDim );
+    }
+}
+
+// A drop-in replacement for the distributed lu::Panel which selects all of
+// the pivot rows of the panel [A; B] before factoring it. Every process in a
+// column of the grid chooses candidates from its rows with a local
+// partially-pivoted factorization, and the candidates are then merged pairwise
+// up a binomial tree, so that only O(log p) messages are required rather than
+// an AllReduce per column. The winning rows are broadcast along with their
+// indices, after which the panel is factored without further pivoting.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("lu::TournamentPanel");
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = B.ColRank();
+    const int colStride = B.ColStride();
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Height() != n )
+          LogicError("A must be square");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // The rows of A precede those of B within the panel, and the first
+    // process in the column enters them into the tournament
+    const Int numLocal = BLocHeight + ( colRank == 0 ? n : 0 );
+    Matrix<F> W( numLocal, n );
+    vector<Int> indices( numLocal );
+    Int offsetB = 0;
+    if( colRank == 0 )
+    {
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                W(i,j) = ABuf[i+j*ALDim];
+        for( Int i=0; i<n; ++i )
+            indices[i] = i;
+        offsetB = n;
+    }
+    for( Int j=0; j<n; ++j )
+        for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+            W(offsetB+iLoc,j) = BBuf[iLoc+j*BLDim];
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+        indices[offsetB+iLoc] = n + B.GlobalRow(iLoc);
+    TournamentSelect( W, indices );
+
+    // Each message holds up to n candidate rows, with their count stored
+    // ahead of their indices
+    vector<F> candidates( n*n );
+    vector<Int> candidateInds( n+1 );
+    auto packCandidates = [&]()
+    {
+        const Int numCand = Min(W.Height(),n);
+        candidateInds[0] = numCand;
+        for( Int i=0; i<numCand; ++i )
+            candidateInds[i+1] = indices[i];
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<numCand; ++i )
+                candidates[i+j*n] = W(i,j);
+    };
+
+    for( int step=1; step<colStride; step*=2 )
+    {
+        if( colRank % (2*step) != 0 )
+        {
+            packCandidates();
+            mpi::Send( candidateInds.data(), n+1, colRank-step, colComm );
+            mpi::Send( candidates.data(), n*n, colRank-step, colComm );
+            break;
+        }
+        else if( colRank+step < colStride )
+        {
+            mpi::Recv( candidateInds.data(), n+1, colRank+step, colComm );
+            mpi::Recv( candidates.data(), n*n, colRank+step, colComm );
+
+            // Stack our winners on top of those of our partner
+            const Int numOurs = Min(W.Height(),n);
+            const Int numTheirs = candidateInds[0];
+            Matrix<F> WMerged( numOurs+numTheirs, n );
+            vector<Int> indicesMerged( numOurs+numTheirs );
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<numOurs; ++i )
+                    WMerged(i,j) = W(i,j);
+                for( Int i=0; i<numTheirs; ++i )
+                    WMerged(numOurs+i,j) = candidates[i+j*n];
+            }
+            for( Int i=0; i<numOurs; ++i )
+                indicesMerged[i] = indices[i];
+            for( Int i=0; i<numTheirs; ++i )
+                indicesMerged[numOurs+i] = candidateInds[i+1];
+            TournamentSelect( WMerged, indicesMerged );
+            W = WMerged;
+            indices = indicesMerged;
+        }
+    }
+    if( colRank == 0 )
+        packCandidates();
+    mpi::Broadcast( candidateInds.data(), n+1, 0, colComm );
+    mpi::Broadcast( candidates.data(), n*n, 0, colComm );
+
+    // Swap each winner into place while tracking the positions of those
+    // which remain, since a winner within A may be displaced by an earlier
+    // swap. Only rows of A are ever displaced, so their contents are known
+    // to every process.
+    vector<Int> positions( n );
+    for( Int k=0; k<n; ++k )
+        positions[k] = candidateInds[k+1];
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = positions[k];
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv == k )
+            continue;
+
+        if( iPiv < n )
+        {
+            blas::Swap( n, &ABuf[k], ALDim, &ABuf[iPiv], ALDim );
+        }
+        else
+        {
+            const Int relIndex = iPiv - n;
+            if( B.IsLocalRow(relIndex) )
+            {
+                const Int iLoc = B.LocalRow(relIndex);
+                for( Int j=0; j<n; ++j )
+                    BBuf[iLoc+j*BLDim] = ABuf[k+j*ALDim];
+            }
+            for( Int j=0; j<n; ++j )
+                ABuf[k+j*ALDim] = candidates[k+j*n];
+        }
+        for( Int l=k+1; l<n; ++l )
+            if( positions[l] == k )
+                positions[l] = iPiv;
+    }
+
+    // Factor the panel with the chosen pivots
+    lu::Unb( A.Matrix() );
+    LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A, B );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
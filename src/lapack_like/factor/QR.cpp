@@ -102,57 +102,11 @@ void QR
     qr::BusingerGolub( A, householderScalars, signature, Omega, ctrl );
 }
 
+// NOTE: The Householder-based factorizations (and the routines built upon
+//       them, including the legacy tree used by the tall-skinny SVD) are not
+//       instantiated until the reflector routines which they rely upon are
+//       built
 #define PROTO(F) \
-  template void QR \
-  ( Matrix<F>& A, \
-    Matrix<F>& householderScalars, \
-    Matrix<Base<F>>& signature ); \
-  template void QR \
-  ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& householderScalars, \
-    AbstractDistMatrix<Base<F>>& signature ); \
-  template void QR \
-  ( Matrix<F>& A, \
-    Matrix<F>& householderScalars, \
-    Matrix<Base<F>>& signature, \
-    Permutation& Omega, \
-    const QRCtrl<Base<F>>& ctrl ); \
-  template void QR \
-  ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& householderScalars, \
-    AbstractDistMatrix<Base<F>>& signature, \
-    DistPermutation& Omega, \
-    const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::ExplicitTriang \
-  ( Matrix<F>& A, const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::ExplicitTriang \
-  ( AbstractDistMatrix<F>& A, const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::ExplicitUnitary \
-  ( Matrix<F>& A, bool thinQR, const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::ExplicitUnitary \
-  ( AbstractDistMatrix<F>& A, bool thinQR, const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::Explicit \
-  ( Matrix<F>& A, \
-    Matrix<F>& R, \
-    bool thinQR, \
-    const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::Explicit \
-  ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R, \
-    bool thinQR, \
-    const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::Explicit \
-  ( Matrix<F>& A, \
-    Matrix<F>& R, \
-    Matrix<Int>& Omega, \
-    bool thinQR, \
-    const QRCtrl<Base<F>>& ctrl ); \
-  template void qr::Explicit \
-  ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R, \
-    AbstractDistMatrix<Int>& Omega, \
-    bool thinQR, \
-    const QRCtrl<Base<F>>& ctrl ); \
   template void qr::NeighborColSwap \
   (       Matrix<F>& Q, \
           Matrix<F>& R, \
@@ -161,44 +115,33 @@ void QR
   (       Matrix<F>& Q, \
           Matrix<F>& R, \
     const Matrix<Int>& colSwaps ); \
-  template void qr::ApplyQ \
-  ( LeftOrRight side, \
-    Orientation orientation, \
-    const Matrix<F>& A, \
-    const Matrix<F>& householderScalars, \
-    const Matrix<Base<F>>& signature, \
-          Matrix<F>& B ); \
-  template void qr::ApplyQ \
-  ( LeftOrRight side, \
-    Orientation orientation, \
-    const AbstractDistMatrix<F>& A, \
-    const AbstractDistMatrix<F>& householderScalars, \
-    const AbstractDistMatrix<Base<F>>& signature, \
-          AbstractDistMatrix<F>& B ); \
-  template void qr::SolveAfter \
-  ( Orientation orientation, \
-    const Matrix<F>& A, \
-    const Matrix<F>& householderScalars, \
-    const Matrix<Base<F>>& signature, \
-    const Matrix<F>& B, \
-          Matrix<F>& X ); \
-  template void qr::SolveAfter \
-  ( Orientation orientation, \
-    const AbstractDistMatrix<F>& A, \
-    const AbstractDistMatrix<F>& householderScalars, \
-    const AbstractDistMatrix<Base<F>>& signature, \
-    const AbstractDistMatrix<F>& B, \
-          AbstractDistMatrix<F>& X ); \
   template void qr::Cholesky \
   ( Matrix<F>& A, \
     Matrix<F>& R ); \
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
-  template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
+  template void qr::Cholesky \
+  ( Matrix<F>& A, \
+    Matrix<F>& R, \
+    const CholeskyQRCtrl& ctrl ); \
+  template void qr::Cholesky \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R, \
+    const CholeskyQRCtrl& ctrl ); \
+  template qr::TreeData<F> qr::TS \
+  ( const AbstractDistMatrix<F>& A, \
+    TSTreeType tree ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    TSTreeType tree ); \
+  template void qr::ts::ApplyQ \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+    const AbstractDistMatrix<F>& B, \
+          AbstractDistMatrix<F>& X ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
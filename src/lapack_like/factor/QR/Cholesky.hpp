@@ -12,43 +12,138 @@
 namespace El {
 namespace qr {
 
-// NOTE: This version is designed for tall-skinny matrices and is much less
-//       numerically stable than Householder-based QR factorizations
+// NOTE: This version is designed for tall-skinny matrices and, with a single
+//       pass, is much less numerically stable than Householder-based QR
+//       factorizations; see CholeskyQRCtrl for the multi-pass variants
 //
 // Computes the QR factorization of full-rank tall-skinny matrix A and
 // overwrites A with Q
 //
 
+namespace cholesky_qr {
+
+// The shift of Fukaya et al.'s shifted CholeskyQR3, with ||A||_2^2 bounded by
+// the trace of the Gram matrix G = A^H A
 template<typename F>
-void Cholesky( Matrix<F>& A, Matrix<F>& R )
+Base<F> Shift( const Matrix<F>& G, Int m )
+{
+    typedef Base<F> Real;
+    const Int n = G.Height();
+    Real frobNormSquared = 0;
+    for( Int j=0; j<n; ++j )
+        frobNormSquared += RealPart(G(j,j));
+    const Real eps = limits::Epsilon<Real>();
+    return Real(11)*(Real(m)*n + Real(n)*(n+1))*eps*frobNormSquared;
+}
+
+// R := RPass R, for upper-triangular RPass and R
+template<typename F>
+void Accumulate( const Matrix<F>& RPass, Matrix<F>& R )
+{
+    const Int n = R.Height();
+    blas::Trmm
+    ( 'L', 'U', 'N', 'N', n, n,
+      F(1), RPass.LockedBuffer(), RPass.LDim(), R.Buffer(), R.LDim() );
+}
+
+} // namespace cholesky_qr
+
+template<typename F>
+void Cholesky( Matrix<F>& A, Matrix<F>& R, const CholeskyQRCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    if( A.Height() < A.Width() )
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
         LogicError("A^H A will be singular");
-    Herk( UPPER, ADJOINT, Base<F>(1), A, R );
-    El::Cholesky( UPPER, R );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+    if( ctrl.numPasses < 1 )
+        LogicError("Cholesky QR requires at least one pass");
+
+    Matrix<F> G;
+    for( Int pass=0; pass<ctrl.numPasses; ++pass )
+    {
+        Zeros( G, n, n );
+        Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), G );
+        if( pass == 0 && ctrl.shift )
+            ShiftDiagonal( G, F(cholesky_qr::Shift(G,m)) );
+        El::Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), G, A );
+        if( pass == 0 )
+            R = G;
+        else
+            cholesky_qr::Accumulate( G, R );
+    }
+    MakeTrapezoidal( UPPER, R );
 }
 
 template<typename F>
-void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+void Cholesky
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& RPre,
+  const CholeskyQRCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("qr::Cholesky");
     const Int m = APre.Height();
     const Int n = APre.Width();
     if( m < n )
         LogicError("A^H A will be singular");
+    if( ctrl.numPasses < 1 )
+        LogicError("Cholesky QR requires at least one pass");
 
     DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
     DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
     auto& A = AProx.Get();
     auto& R = RProx.Get();
+    auto& ALoc = A.Matrix();
+    auto& RLoc = R.Matrix();
+    R.Resize( n, n );
 
-    Zeros( R, n, n );
-    Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
-    El::AllReduce( R, A.ColComm() );
-    El::Cholesky( UPPER, R.Matrix() );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+    // Only the upper triangle of each Gram matrix is summed
+    Matrix<F> G;
+    vector<F> triangle( (n*(n+1))/2 );
+    for( Int pass=0; pass<ctrl.numPasses; ++pass )
+    {
+        Zeros( G, n, n );
+        Herk( UPPER, ADJOINT, Base<F>(1), ALoc, Base<F>(0), G );
+        Int offset = 0;
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<=j; ++i )
+                triangle[offset++] = G(i,j);
+        mpi::AllReduce( triangle.data(), offset, A.ColComm() );
+        offset = 0;
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<=j; ++i )
+                G(i,j) = triangle[offset++];
+
+        if( pass == 0 && ctrl.shift )
+            ShiftDiagonal( G, F(cholesky_qr::Shift(G,m)) );
+        El::Cholesky( UPPER, G );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), G, ALoc );
+        if( pass == 0 )
+            RLoc = G;
+        else
+            cholesky_qr::Accumulate( G, RLoc );
+    }
+    MakeTrapezoidal( UPPER, RLoc );
+}
+
+template<typename F>
+void Cholesky( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    CholeskyQRCtrl ctrl;
+    ctrl.numPasses = 1;
+    Cholesky( A, R, ctrl );
+}
+
+template<typename F>
+void Cholesky( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+{
+    EL_DEBUG_CSE
+    CholeskyQRCtrl ctrl;
+    ctrl.numPasses = 1;
+    Cholesky( A, R, ctrl );
 }
 
 } // namespace qr
@@ -13,6 +13,489 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// Unblocked Householder QR of a local matrix, stored in the same format as
+// qr::Householder. It is built directly upon the reflector kernels of the
+// LAPACK interface and is meant for the local and tree factorizations of
+// TSQR, where the matrices are either short or very narrow.
+template<typename F>
+void LocalQR
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    vector<F> work( n );
+    for( Int k=0; k<minDim; ++k )
+    {
+        // Find tau and u such that
+        //  / I - tau | 1 | | 1, u^H | \ | alpha11 | = | beta |
+        //  \         | u |            / |     a21 | = |    0 |
+        F* aB1 = &ABuf[k+k*ALDim];
+        const F tau = lapack::Reflector( m-k, aB1[0], &aB1[1], 1 );
+        householderScalars(k) = tau;
+
+        // Temporarily set aB1 = [1; u] in order to apply the reflector to AB2
+        const F alpha = aB1[0];
+        aB1[0] = F(1);
+        lapack::ApplyReflector
+        ( true, m-k, n-(k+1), aB1, 1, tau,
+          &ABuf[k+(k+1)*ALDim], ALDim, work.data() );
+        aB1[0] = alpha;
+    }
+
+    // Form the signature and rescale R to have a non-negative diagonal
+    for( Int k=0; k<minDim; ++k )
+    {
+        signature(k) =
+          ( RealPart(ABuf[k+k*ALDim]) >= Real(0) ? Real(1) : Real(-1) );
+        if( signature(k) < Real(0) )
+            for( Int j=k; j<n; ++j )
+                ABuf[k+j*ALDim] = -ABuf[k+j*ALDim];
+    }
+}
+
+// B := Q B or B := Q^H B, where Q is the unitary matrix implicitly defined by
+// a factorization from LocalQR
+template<typename F>
+void LocalApplyQ
+( Orientation orientation,
+  const Matrix<F>& QR,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = QR.Height();
+    const Int k = B.Width();
+    const Int minDim = householderScalars.Height();
+    EL_DEBUG_ONLY(
+      if( B.Height() != m )
+          LogicError("B must be the same height as the factored matrix");
+    )
+    const F* QRBuf = QR.LockedBuffer();
+    const Int QRLDim = QR.LDim();
+    F* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+
+    vector<F> v( m ), work( k );
+    auto applyReflector = [&]( Int j, const F& tau )
+    {
+        v[0] = F(1);
+        for( Int i=j+1; i<m; ++i )
+            v[i-j] = QRBuf[i+j*QRLDim];
+        lapack::ApplyReflector
+        ( true, m-j, k, v.data(), 1, tau, &BBuf[j], BLDim, work.data() );
+    };
+    auto applySignature = [&]()
+    {
+        for( Int j=0; j<minDim; ++j )
+            if( signature(j) < Real(0) )
+                blas::Scal( k, F(-1), &BBuf[j], BLDim );
+    };
+
+    if( orientation == NORMAL )
+    {
+        applySignature();
+        for( Int j=minDim-1; j>=0; --j )
+            applyReflector( j, householderScalars(j) );
+    }
+    else
+    {
+        for( Int j=0; j<minDim; ++j )
+            applyReflector( j, Conj(householderScalars(j)) );
+        applySignature();
+    }
+}
+
+// Extract the n x n upper-triangular factor from the factorization of an
+// m x n matrix, padding it with zero rows when m < n
+template<typename F>
+void PaddedR( const Matrix<F>& QR, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    const Int m = QR.Height();
+    const Int n = QR.Width();
+    R.Resize( n, n, Max(n,1) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            R(i,j) = ( i <= j && i < m ? QR(i,j) : F(0) );
+}
+
+// Append a stage to the tree and return the storage for the stacked factors
+// which it will reduce
+template<typename F>
+Matrix<F>& PushStage( Int height, Int width, TreeData<F>& treeData )
+{
+    const Int numStages = treeData.QRList.size();
+    treeData.QRList.resize( numStages+1 );
+    treeData.householderScalarsList.resize( numStages+1 );
+    treeData.signatureList.resize( numStages+1 );
+    Matrix<F>& QR = treeData.QRList.back();
+    QR.Resize( height, width, Max(height,1) );
+    return QR;
+}
+
+// Factor the stacked factors of the newest stage and overwrite the running
+// triangular factor with the result
+template<typename F>
+void FactorStage( TreeData<F>& treeData )
+{
+    LocalQR
+    ( treeData.QRList.back(),
+      treeData.householderScalarsList.back(),
+      treeData.signatureList.back() );
+    PaddedR( treeData.QRList.back(), treeData.R );
+}
+
+template<typename F>
+void ApplyStage
+( Orientation orientation,
+  const TreeData<F>& treeData,
+  Int stage,
+  Matrix<F>& Z )
+{
+    LocalApplyQ
+    ( orientation,
+      treeData.QRList[stage],
+      treeData.householderScalarsList[stage],
+      treeData.signatureList[stage],
+      Z );
+}
+
+// The butterfly tree supports an arbitrary number of processes, p, by first
+// folding the factors of the last p-2^k processes onto the first p-2^k, and
+// then pairing off the remaining 2^k processes over k stages. Both members of
+// each pair factor their two stacked triangles (redundantly), so that the
+// final R is known to every member without a broadcast and, when applying
+// the implicit Q, every process can descend the tree without communicating.
+inline void ButterflyShape
+( mpi::Comm comm, int& rank, int& powerOfTwo, int& numFolded )
+{
+    const int p = mpi::Size( comm );
+    rank = mpi::Rank( comm );
+    powerOfTwo = 1 << FlooredLog2( p );
+    numFolded = p - powerOfTwo;
+}
+
+template<typename F>
+void ButterflyReduce( mpi::Comm comm, TreeData<F>& treeData )
+{
+    EL_DEBUG_CSE
+    int rank, powerOfTwo, numFolded;
+    ButterflyShape( comm, rank, powerOfTwo, numFolded );
+    Matrix<F>& R = treeData.R;
+    const Int n = R.Width();
+    auto stackPair = [&]( const Matrix<F>& RTop, const Matrix<F>& RBot )
+    {
+        auto& QR = PushStage( 2*n, n, treeData );
+        auto QRTop = QR( IR(0,n),   ALL );
+        auto QRBot = QR( IR(n,2*n), ALL );
+        QRTop = RTop;
+        QRBot = RBot;
+        FactorStage( treeData );
+    };
+
+    if( rank >= powerOfTwo )
+    {
+        mpi::Send( R.LockedBuffer(), n*n, rank-powerOfTwo, comm );
+        mpi::Recv( R.Buffer(), n*n, rank-powerOfTwo, comm );
+        return;
+    }
+
+    Matrix<F> RPartner( n, n, Max(n,1) );
+    if( rank < numFolded )
+    {
+        mpi::Recv( RPartner.Buffer(), n*n, rank+powerOfTwo, comm );
+        stackPair( R, RPartner );
+    }
+    for( int bit=1; bit<powerOfTwo; bit*=2 )
+    {
+        const int partner = rank ^ bit;
+        mpi::SendRecv
+        ( R.LockedBuffer(), n*n, partner,
+          RPartner.Buffer(), n*n, partner, comm );
+        if( rank < partner )
+            stackPair( R, RPartner );
+        else
+            stackPair( RPartner, R );
+    }
+    if( rank < numFolded )
+        mpi::Send( R.LockedBuffer(), n*n, rank+powerOfTwo, comm );
+}
+
+// The flat tree gathers every local factor to the root, which factors the
+// stack in one step and broadcasts R. It takes a constant number of
+// collectives, at the price of an O(p n^3) factorization on the root.
+template<typename F>
+void FlatReduce( mpi::Comm comm, TreeData<F>& treeData )
+{
+    EL_DEBUG_CSE
+    const int p = mpi::Size( comm );
+    const int rank = mpi::Rank( comm );
+    Matrix<F>& R = treeData.R;
+    const Int n = R.Width();
+
+    vector<F> gathered;
+    if( rank == 0 )
+        gathered.resize( p*n*n );
+    mpi::Gather( R.LockedBuffer(), n*n, gathered.data(), n*n, 0, comm );
+    if( rank == 0 )
+    {
+        auto& QR = PushStage( p*n, n, treeData );
+        for( Int q=0; q<p; ++q )
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<n; ++i )
+                    QR(q*n+i,j) = gathered[i+j*n+q*n*n];
+        FactorStage( treeData );
+    }
+    mpi::Broadcast( R.Buffer(), n*n, 0, comm );
+}
+
+// Y := (Q^H B)[top], where Y enters as this process's n x k contribution from
+// its local factorization and leaves as the complete result
+template<typename F>
+void ReduceAdjoint( mpi::Comm comm, const TreeData<F>& treeData, Matrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height();
+    const Int k = Y.Width();
+    if( treeData.tree == TS_FLAT )
+    {
+        const int p = mpi::Size( comm );
+        const int rank = mpi::Rank( comm );
+        vector<F> gathered;
+        if( rank == 0 )
+            gathered.resize( p*n*k );
+        mpi::Gather( Y.LockedBuffer(), n*k, gathered.data(), n*k, 0, comm );
+        if( rank == 0 )
+        {
+            Matrix<F> Z( p*n, k );
+            for( Int q=0; q<p; ++q )
+                for( Int j=0; j<k; ++j )
+                    for( Int i=0; i<n; ++i )
+                        Z(q*n+i,j) = gathered[i+j*n+q*n*k];
+            ApplyStage( ADJOINT, treeData, 0, Z );
+            Y = Z( IR(0,n), ALL );
+        }
+        mpi::Broadcast( Y.Buffer(), n*k, 0, comm );
+        return;
+    }
+
+    int rank, powerOfTwo, numFolded;
+    ButterflyShape( comm, rank, powerOfTwo, numFolded );
+    if( rank >= powerOfTwo )
+    {
+        mpi::Send( Y.LockedBuffer(), n*k, rank-powerOfTwo, comm );
+        mpi::Recv( Y.Buffer(), n*k, rank-powerOfTwo, comm );
+        return;
+    }
+
+    Int stage = 0;
+    Matrix<F> YPartner( n, k, Max(n,1) ), Z( 2*n, k );
+    auto ZTop = Z( IR(0,n),   ALL );
+    auto ZBot = Z( IR(n,2*n), ALL );
+    auto reducePair = [&]( const Matrix<F>& YTop, const Matrix<F>& YBot )
+    {
+        ZTop = YTop;
+        ZBot = YBot;
+        ApplyStage( ADJOINT, treeData, stage++, Z );
+        Y = ZTop;
+    };
+    if( rank < numFolded )
+    {
+        mpi::Recv( YPartner.Buffer(), n*k, rank+powerOfTwo, comm );
+        reducePair( Y, YPartner );
+    }
+    for( int bit=1; bit<powerOfTwo; bit*=2 )
+    {
+        const int partner = rank ^ bit;
+        mpi::SendRecv
+        ( Y.LockedBuffer(), n*k, partner,
+          YPartner.Buffer(), n*k, partner, comm );
+        if( rank < partner )
+            reducePair( Y, YPartner );
+        else
+            reducePair( YPartner, Y );
+    }
+    if( rank < numFolded )
+        mpi::Send( Y.LockedBuffer(), n*k, rank+powerOfTwo, comm );
+}
+
+// Y := the n x k block of Q_tree Y belonging to this process, where Q_tree
+// is the thin unitary matrix of the reduction tree and Y enters replicated
+template<typename F>
+void ScatterNormal( mpi::Comm comm, const TreeData<F>& treeData, Matrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height();
+    const Int k = Y.Width();
+    if( treeData.tree == TS_FLAT )
+    {
+        const int p = mpi::Size( comm );
+        const int rank = mpi::Rank( comm );
+        vector<F> blocks;
+        if( rank == 0 )
+        {
+            Matrix<F> Z;
+            Zeros( Z, p*n, k );
+            auto ZTop = Z( IR(0,n), ALL );
+            ZTop = Y;
+            ApplyStage( NORMAL, treeData, 0, Z );
+            blocks.resize( p*n*k );
+            for( Int q=0; q<p; ++q )
+                for( Int j=0; j<k; ++j )
+                    for( Int i=0; i<n; ++i )
+                        blocks[i+j*n+q*n*k] = Z(q*n+i,j);
+        }
+        mpi::Scatter( blocks.data(), n*k, Y.Buffer(), n*k, 0, comm );
+        return;
+    }
+
+    int rank, powerOfTwo, numFolded;
+    ButterflyShape( comm, rank, powerOfTwo, numFolded );
+    if( rank >= powerOfTwo )
+    {
+        mpi::Recv( Y.Buffer(), n*k, rank-powerOfTwo, comm );
+        return;
+    }
+
+    // Descend the butterfly in the reverse order of the reduction
+    Int stage = treeData.QRList.size();
+    Matrix<F> Z( 2*n, k );
+    auto ZTop = Z( IR(0,n),   ALL );
+    auto ZBot = Z( IR(n,2*n), ALL );
+    auto expand = [&]()
+    {
+        ZTop = Y;
+        Zero( ZBot );
+        ApplyStage( NORMAL, treeData, --stage, Z );
+    };
+    for( int bit=powerOfTwo/2; bit>=1; bit/=2 )
+    {
+        const int partner = rank ^ bit;
+        expand();
+        Y = ( rank < partner ? ZTop : ZBot );
+    }
+    if( rank < numFolded )
+    {
+        expand();
+        mpi::Send( ZBot.LockedBuffer(), n*k, rank+powerOfTwo, comm );
+        Y = ZTop;
+    }
+}
+
+} // namespace ts
+
+// Factor the tall-skinny matrix A, which is redistributed to [VC,* ] if
+// necessary, as the implicit product of the local factorizations of its
+// rows and a reduction tree over the factors. Unlike the legacy tree below,
+// any number of processes and any distribution of the rows is supported.
+template<typename F>
+TreeData<F> TS( const AbstractDistMatrix<F>& APre, TSTreeType tree )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("qr::TS");
+    DistMatrixReadProxy<F,F,VC,STAR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    TreeData<F> treeData;
+    treeData.tree = tree;
+    treeData.QR0 = A.LockedMatrix();
+    ts::LocalQR
+    ( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
+    ts::PaddedR( treeData.QR0, treeData.R );
+    if( tree == TS_FLAT )
+        ts::FlatReduce( A.ColComm(), treeData );
+    else
+        ts::ButterflyReduce( A.ColComm(), treeData );
+    return treeData;
+}
+
+namespace ts {
+
+// Apply the thin Q of a tall-skinny factorization of the m x n matrix A
+// without forming it. With orientation NORMAL, B is n x k and X := Q B is
+// m x k and distributed like the rows of A; otherwise, B is m x k and
+// X := Q^H B is n x k and replicated over the grid.
+template<typename F>
+void ApplyQ
+( Orientation orientation,
+  const AbstractDistMatrix<F>& APre,
+  const TreeData<F>& treeData,
+  const AbstractDistMatrix<F>& BPre,
+        AbstractDistMatrix<F>& XPre )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("qr::ts::ApplyQ");
+    DistMatrixReadProxy<F,F,VC,STAR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = BPre.Width();
+    const Int minDimLoc = treeData.householderScalars0.Height();
+
+    if( orientation == NORMAL )
+    {
+        if( BPre.Height() != n )
+            LogicError("B must have as many rows as A has columns");
+        DistMatrixReadProxy<F,F,STAR,STAR> BProx( BPre );
+        auto& B = BProx.GetLocked();
+        Matrix<F> Y( n, k, Max(n,1) );
+        Y = B.LockedMatrix();
+        ScatterNormal( A.ColComm(), treeData, Y );
+
+        DistMatrixWriteProxy<F,F,VC,STAR> XProx( XPre );
+        auto& X = XProx.Get();
+        X.AlignWith( A );
+        Zeros( X, m, k );
+        auto XLocT = X.Matrix()( IR(0,minDimLoc), ALL );
+        XLocT = Y( IR(0,minDimLoc), ALL );
+        LocalApplyQ
+        ( NORMAL, treeData.QR0, treeData.householderScalars0,
+          treeData.signature0, X.Matrix() );
+    }
+    else
+    {
+        if( BPre.Height() != m )
+            LogicError("B must be the same height as A");
+        ElementalProxyCtrl ctrl;
+        ctrl.colConstrain = true;
+        ctrl.colAlign = A.ColAlign();
+        DistMatrixReadProxy<F,F,VC,STAR> BProx( BPre, ctrl );
+        auto& B = BProx.GetLocked();
+        Matrix<F> BLoc( B.LockedMatrix() );
+        LocalApplyQ
+        ( ADJOINT, treeData.QR0, treeData.householderScalars0,
+          treeData.signature0, BLoc );
+        Matrix<F> Y;
+        Zeros( Y, n, k );
+        auto YT = Y( IR(0,minDimLoc), ALL );
+        YT = BLoc( IR(0,minDimLoc), ALL );
+        ReduceAdjoint( A.ColComm(), treeData, Y );
+
+        DistMatrixWriteProxy<F,F,STAR,STAR> XProx( XPre );
+        auto& X = XProx.Get();
+        X.Resize( n, k );
+        X.Matrix() = Y;
+    }
+}
+
+// The legacy binary tree, which requires a power-of-two number of processes
+// and leaves the final stacked pair unfactored for the benefit of the
+// tall-skinny SVD. Since ts::ApplyQ hides qr::ApplyQ within this namespace,
+// the local Householder applications below must be qualified.
+// ---------------------------------------------------------------------------
+
 template<typename F>
 void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -229,7 +712,7 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
                 Zero( ZBot );
 
                 // TODO: Exploit sparsity?
-                ApplyQ
+                qr::ApplyQ
                 ( LEFT, NORMAL,
                   treeData.QRList[stage],
                   treeData.householderScalarsList[stage],
@@ -250,97 +733,46 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
 
     // Apply the initial Q
     Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
+    auto& ALoc = static_cast<Matrix<F>&>(A.Matrix());
+    auto ATop = ALoc( IR(0,n), IR(0,n) );
     ATop = ZHalf;
 
     // TODO: Exploit sparsity
-    ApplyQ
+    qr::ApplyQ
     ( LEFT, NORMAL,
       treeData.QR0, treeData.householderScalars0, treeData.signature0,
-      A.Matrix() );
+      ALoc );
 }
 
 template<typename F>
-inline DistMatrix<F,STAR,STAR>
+DistMatrix<F,STAR,STAR>
 FormR( const AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
 {
-    if( A.RowDist() != STAR )
-        LogicError("Invalid row distribution for TSQR");
-    const Grid& g = A.Grid();
-    DistMatrix<F,CIRC,CIRC> RRoot(g);
-    if( A.ColRank() == 0 )
-    {
-        const Int n = A.Width();
-        auto R = RootQR(A,treeData);
-        auto RTop = R( IR(0,n), IR(0,n) );
-        CopyFromRoot( RTop, RRoot );
-        MakeTrapezoidal( UPPER, RRoot );
-    }
-    else
-        CopyFromNonRoot( RRoot );
-    DistMatrix<F,STAR,STAR> R(g);
-    R = RRoot;
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> R(A.Grid());
+    R.Resize( A.Width(), A.Width() );
+    R.Matrix() = treeData.R;
     return R;
 }
 
-// NOTE: This is destructive
+// Overwrite A with the thin Q of its tall-skinny factorization
 template<typename F>
-inline void
-FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
+void FormQ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
 {
-    if( A.RowDist() != STAR )
-        LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    if( p == 1 )
-    {
-        A.Matrix() = treeData.QR0;
-        ExpandPackedReflectors
-        ( LOWER, VERTICAL, CONJUGATED, 0,
-          A.Matrix(), RootHouseholderScalars(A,treeData) );
-        DiagonalScale( RIGHT, NORMAL, RootSignature(A,treeData), A.Matrix() );
-    }
-    else
-    {
-        if( A.ColRank() == 0 )
-        {
-            ExpandPackedReflectors
-            ( LOWER, VERTICAL, CONJUGATED, 0,
-              RootQR(A,treeData), RootHouseholderScalars(A,treeData) );
-            DiagonalScale
-            ( RIGHT, NORMAL, RootSignature(A,treeData), RootQR(A,treeData) );
-        }
-        Scatter( A, treeData );
-    }
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> I(A.Grid());
+    Identity( I, A.Width(), A.Width() );
+    ApplyQ( NORMAL, A, treeData, I, A );
 }
 
 } // namespace ts
 
 template<typename F>
-TreeData<F> TS( const AbstractDistMatrix<F>& A )
-{
-    if( A.RowDist() != STAR )
-        LogicError("Invalid row distribution for TSQR");
-    TreeData<F> treeData;
-    treeData.QR0 = A.LockedMatrix();
-    QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
-
-    const Int p = mpi::Size( A.ColComm() );
-    if( p != 1 )
-    {
-        ts::Reduce( A, treeData );
-        if( A.ColRank() == 0 )
-            QR
-            ( ts::RootQR(A,treeData),
-              ts::RootHouseholderScalars(A,treeData),
-              ts::RootSignature(A,treeData) );
-    }
-    return treeData;
-}
-
-template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+void ExplicitTS
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R, TSTreeType tree )
 {
-    auto treeData = TS( A );
+    EL_DEBUG_CSE
+    auto treeData = TS( A, tree );
     Copy( ts::FormR( A, treeData ), R );
     ts::FormQ( A, treeData );
 }
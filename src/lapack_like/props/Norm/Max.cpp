@@ -67,7 +67,9 @@ Base<Ring> MaxNorm( const AbstractDistMatrix<Ring>& A )
     Base<Ring> norm=0;
     if( A.Participating() )
     {
-        Base<Ring> localMaxAbs = MaxNorm( A.LockedMatrix() );
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+            ALocProxy{A.LockedMatrix()};
+        Base<Ring> localMaxAbs = MaxNorm( ALocProxy.GetLocked() );
         norm = mpi::AllReduce( localMaxAbs, mpi::MAX, A.DistComm() );
     }
     mpi::Broadcast( norm, A.Root(), A.CrossComm() );
@@ -88,7 +90,9 @@ HermitianMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     {
         const Int localWidth = A.LocalWidth();
         const Int localHeight = A.LocalHeight();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+            ALocProxy{A.LockedMatrix()};
+        const Matrix<Ring>& ALoc = ALocProxy.GetLocked();
 
         Real localMaxAbs = 0;
         if( uplo == UPPER )
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace counter_random {
+
+typedef std::array<std::uint32_t,4> Bits;
+
+// The k'th sample from [0,1) held in the given bits. Single-precision
+// samples use the top 24 bits of word k, while double-precision samples
+// use the top 53 bits of words 2k and 2k+1.
+template<typename Real>
+Real UnitUniform( const Bits& bits, int k );
+
+template<>
+inline float UnitUniform<float>( const Bits& bits, int k )
+{ return (bits[k]>>8)*(1.f/16777216.f); }
+
+template<>
+inline double UnitUniform<double>( const Bits& bits, int k )
+{
+    const std::uint64_t word =
+      (std::uint64_t(bits[2*k])<<32) | std::uint64_t(bits[2*k+1]);
+    return (word>>11)*(1./9007199254740992.);
+}
+
+// Uniform samples over the ball of the given radius around the center
+template<typename Real>
+Real SampleBall( const Bits& bits, const Real& center, const Real& radius )
+{ return center + radius*(2*UnitUniform<Real>(bits,0)-1); }
+
+template<typename Real>
+Complex<Real>
+SampleBall
+( const Bits& bits, const Complex<Real>& center, const Real& radius )
+{
+    // Match the polar sampling of El::SampleBall
+    const Real r = radius*UnitUniform<Real>(bits,0);
+    const Real angle = 2*Pi<Real>()*UnitUniform<Real>(bits,1);
+    return center + Complex<Real>(r*Cos(angle),r*Sin(angle));
+}
+
+// A pair of independent standard normal samples via Box-Muller. The first
+// uniform sample is reflected into (0,1] so that its logarithm is finite.
+template<typename Real>
+void StandardNormalPair( const Bits& bits, Real& z0, Real& z1 )
+{
+    const Real u0 = 1 - UnitUniform<Real>(bits,0);
+    const Real u1 = UnitUniform<Real>(bits,1);
+    const Real rho = Sqrt(-2*Log(u0));
+    const Real theta = 2*Pi<Real>()*u1;
+    z0 = rho*Cos(theta);
+    z1 = rho*Sin(theta);
+}
+
+template<typename Real>
+Real SampleNormal( const Bits& bits, const Real& mean, const Real& stddev )
+{
+    Real z0, z1;
+    StandardNormalPair( bits, z0, z1 );
+    return mean + stddev*z0;
+}
+
+template<typename Real>
+Complex<Real>
+SampleNormal
+( const Bits& bits, const Complex<Real>& mean, const Real& stddev )
+{
+    // As in El::SampleNormal, each component has variance stddev^2/2
+    Real z0, z1;
+    StandardNormalPair( bits, z0, z1 );
+    const Real componentStd = stddev/Sqrt(Real(2));
+    return mean + Complex<Real>(componentStd*z0,componentStd*z1);
+}
+
+// Overwrites each entry of the column-major buffer with sample(bits), where
+// the bits are drawn from the given stream at the global indices
+// (rowInds[i],colInds[j]). Since every entry is independent of the others,
+// the columns are split over the threads.
+template<typename F,typename Sampler>
+void Fill
+( Int height, Int width, F* buffer, Int ldim,
+  std::uint64_t stream, const Int* rowInds, const Int* colInds,
+  const Sampler& sample )
+{
+    const std::uint64_t seed = CounterSeed();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+    {
+        F* EL_RESTRICT col = &buffer[j*ldim];
+        const Int jGlobal = colInds[j];
+        for( Int i=0; i<height; ++i )
+            col[i] = sample( CounterBits(seed,stream,rowInds[i],jGlobal) );
+    }
+}
+
+// Fills a local matrix from a fresh local stream. Returns false, without
+// modifying the matrix, if the counter-based generator does not apply, in
+// which case the caller should fall back to Generator().
+template<typename F,Device D,typename Sampler,
+         typename=EnableIf<IsBlasScalar<F>>>
+bool FillLocal( Matrix<F,D>& A, const Sampler& sample )
+{
+    EL_DEBUG_CSE
+    if( D != Device::CPU )
+        return false;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    vector<Int> rowInds(m), colInds(n);
+    for( Int i=0; i<m; ++i )
+        rowInds[i] = i;
+    for( Int j=0; j<n; ++j )
+        colInds[j] = j;
+    Fill
+    ( m, n, A.Buffer(), A.LDim(), NextLocalRandomStream(),
+      rowInds.data(), colInds.data(), sample );
+    return true;
+}
+
+template<typename F,Device D,typename Sampler,
+         typename=DisableIf<IsBlasScalar<F>>,typename=void>
+bool FillLocal( Matrix<F,D>& A, const Sampler& sample )
+{ return false; }
+
+// Fills a distributed matrix from the next stream of its grid. Each entry is
+// drawn from its global indices, so the redundant copies agree without any
+// communication and the result does not depend upon the distribution.
+// Returns false if the counter-based generator does not apply.
+template<typename F,typename Sampler,
+         typename=EnableIf<IsBlasScalar<F>>>
+bool FillDist( AbstractDistMatrix<F>& A, const Sampler& sample )
+{
+    EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        return false;
+
+    // Every viewing process advances the stream of the grid, whether or not
+    // it owns any entries
+    const std::uint64_t stream = A.Grid().NextRandomStream();
+    if( !A.Participating() )
+        return true;
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> rowInds(localHeight), colInds(localWidth);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rowInds[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colInds[jLoc] = A.GlobalCol(jLoc);
+    auto& ALoc = static_cast<Matrix<F,Device::CPU>&>(A.Matrix());
+    Fill
+    ( localHeight, localWidth, ALoc.Buffer(), ALoc.LDim(), stream,
+      rowInds.data(), colInds.data(), sample );
+    return true;
+}
+
+template<typename F,typename Sampler,
+         typename=DisableIf<IsBlasScalar<F>>,typename=void>
+bool FillDist( AbstractDistMatrix<F>& A, const Sampler& sample )
+{ return false; }
+
+} // namespace counter_random
+} // namespace El
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 
@@ -18,6 +20,11 @@ template<typename F,Device D,typename>
 void MakeGaussian( Matrix<F,D>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    auto counterSampleNormal = [=]( const counter_random::Bits& bits )
+    { return counter_random::SampleNormal( bits, mean, stddev ); };
+    if( counter_random::FillLocal( A, counterSampleNormal ) )
+        return;
+
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
@@ -51,6 +58,11 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    auto counterSampleNormal = [=]( const counter_random::Bits& bits )
+    { return counter_random::SampleNormal( bits, mean, stddev ); };
+    if( counter_random::FillDist( A, counterSampleNormal ) )
+        return;
+
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
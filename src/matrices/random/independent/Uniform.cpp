@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
@@ -37,6 +39,11 @@ template<typename T, Device D>
 void MakeUniform( Matrix<T,D>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    auto counterSampleBall = [=]( const counter_random::Bits& bits )
+    { return counter_random::SampleBall( bits, center, radius ); };
+    if( counter_random::FillLocal( A, counterSampleBall ) )
+        return;
+
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
@@ -53,6 +60,11 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    auto counterSampleBall = [=]( const counter_random::Bits& bits )
+    { return counter_random::SampleBall( bits, center, radius ); };
+    if( counter_random::FillDist( A, counterSampleBall ) )
+        return;
+
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -75,6 +75,93 @@ void TestColumnMaxNorms(Int m, Int n, const Grid& g, bool print)
   }
 }
 
+template <typename T>
+void TestScaledTwoNorms(Int m, Int n, const Grid& g)
+{
+  // The squares of these entries overflow, so the norms are only correct
+  // if the accumulation is scaled.
+  const T huge = Sqrt(limits::Max<T>());
+  const T tiny = limits::SafeMin<T>();
+  for (const T scale : {huge, tiny})
+  {
+    DistMatrix<T, MC, MR> A(g), AScaled(g);
+    Uniform(A, m, n);
+    AScaled = A;
+    AScaled *= scale;
+
+    DistMatrix<T, MR, STAR> colNorms(g), scaledColNorms(g);
+    DistMatrix<T, MC, STAR> rowNorms(g), scaledRowNorms(g);
+    ColumnTwoNorms(A, colNorms);
+    ColumnTwoNorms(AScaled, scaledColNorms);
+    RowTwoNorms(A, rowNorms);
+    RowTwoNorms(AScaled, scaledRowNorms);
+
+    const T tol = m * n * 10 * limits::Epsilon<T>();
+    for (Int j = 0; j < colNorms.LocalHeight(); ++j)
+    {
+      const T expected = colNorms.GetLocal(j, 0);
+      const T got = scaledColNorms.GetLocal(j, 0) / scale;
+      if (Abs(got - expected) > tol * expected)
+      {
+        Output("Scaled column norm ", j, " was ", got, " instead of ",
+               expected);
+        RuntimeError("got != expected");
+      }
+    }
+    for (Int i = 0; i < rowNorms.LocalHeight(); ++i)
+    {
+      const T expected = rowNorms.GetLocal(i, 0);
+      const T got = scaledRowNorms.GetLocal(i, 0) / scale;
+      if (Abs(got - expected) > tol * expected)
+      {
+        Output("Scaled row norm ", i, " was ", got, " instead of ",
+               expected);
+        RuntimeError("got != expected");
+      }
+    }
+  }
+}
+
+template <typename T, Dist U>
+void CheckNaNNorms
+(const string& name, const DistMatrix<T, U, STAR>& norms, Int iNaN)
+{
+  for (Int iLoc = 0; iLoc < norms.LocalHeight(); ++iLoc)
+  {
+    const T norm = norms.GetLocal(iLoc, 0);
+    const bool isNaN = (norm != norm);
+    if (isNaN != (norms.GlobalRow(iLoc) == iNaN))
+    {
+      Output(name, " ", norms.GlobalRow(iLoc), " was ", norm);
+      RuntimeError("NaN was not confined to ", name, " ", iNaN);
+    }
+  }
+}
+
+// A single NaN entry must make the max and two norms of its column and of
+// its row NaN, whichever process owns it and even when an infinity shares
+// its column, and leave the other norms non-NaN.
+template <typename T>
+void TestNormsWithNaN(Int m, Int n, const Grid& g)
+{
+  const Int iNaN = m / 2, jNaN = n / 2;
+  DistMatrix<T, MC, MR> A(g);
+  Uniform(A, m, n);
+  A.Set(0, jNaN, std::numeric_limits<T>::infinity());
+  A.Set(iNaN, jNaN, std::numeric_limits<T>::quiet_NaN());
+
+  DistMatrix<T, MR, STAR> colNorms(g);
+  DistMatrix<T, MC, STAR> rowNorms(g);
+  ColumnMaxNorms(A, colNorms);
+  RowMaxNorms(A, rowNorms);
+  CheckNaNNorms("column max norm", colNorms, jNaN);
+  CheckNaNNorms("row max norm", rowNorms, iNaN);
+  ColumnTwoNorms(A, colNorms);
+  RowTwoNorms(A, rowNorms);
+  CheckNaNNorms("column two-norm", colNorms, jNaN);
+  CheckNaNNorms("row two-norm", rowNorms, iNaN);
+}
+
 int main(int argc, char** argv)
 {
   Environment env(argc, argv);
@@ -107,6 +194,9 @@ int main(int argc, char** argv)
     TestColumnTwoNorms<BigFloat, ELEMENT>(m, n, g, print);
     TestColumnTwoNorms<BigFloat, BLOCK>(m, n, g, print);
 #endif
+    OutputFromRoot(comm, "Testing scaled ColumnTwoNorms/RowTwoNorms");
+    TestScaledTwoNorms<float>(m, n, g);
+    TestScaledTwoNorms<double>(m, n, g);
     OutputFromRoot(comm, "Testing ColumnMaxNorms");
     TestColumnMaxNorms<float, ELEMENT>(m, n, g, print);
     TestColumnMaxNorms<float, BLOCK>(m, n, g, print);
@@ -126,6 +216,9 @@ int main(int argc, char** argv)
     TestColumnMaxNorms<BigFloat, ELEMENT>(m, n, g, print);
     TestColumnMaxNorms<BigFloat, BLOCK>(m, n, g, print);
 #endif
+    OutputFromRoot(comm, "Testing NaN propagation of the norms");
+    TestNormsWithNaN<float>(m, n, g);
+    TestNormsWithNaN<double>(m, n, g);
   }
   catch (exception& e)
   {
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include <El.hpp>
+using namespace El;
+
+template <typename T>
+void CheckClose(const string& name, T got, T expected, Base<T> scale)
+{
+  const Base<T> tol = 100 * limits::Epsilon<Base<T>>() * (scale + 1);
+  if (Abs(got - expected) > tol)
+  {
+    Output(name, " gave ", got, " instead of ", expected);
+    RuntimeError(name, " did not match the unfused result");
+  }
+}
+
+template <typename T>
+void CheckClose
+(const string& name, const Matrix<T>& got, const Matrix<T>& expected)
+{
+  Matrix<T> E(got);
+  E -= expected;
+  CheckClose(name, FrobeniusNorm(E), Base<T>(0), FrobeniusNorm(expected));
+}
+
+template <typename T>
+void CheckClose
+(const string& name, const DistMatrix<T>& got, const DistMatrix<T>& expected)
+{
+  DistMatrix<T> E(got);
+  E -= expected;
+  CheckClose(name, FrobeniusNorm(E), Base<T>(0), FrobeniusNorm(expected));
+}
+
+// Compare fused expressions against the equivalent sequences of Hadamard,
+// Scale, and Axpy calls on sequential matrices
+template <typename T>
+void TestExpressions(Int m, Int n, bool print)
+{
+  Output("Testing sequential expressions with ", TypeName<T>());
+  Matrix<T> A, B, YOrig;
+  Uniform(A, m, n);
+  Uniform(B, m, n);
+  Uniform(YOrig, m, n);
+  const T alpha = T(2), beta = T(-3);
+
+  // Y := alpha A .* B + beta Y, with the target inside the expression
+  Matrix<T> Y(YOrig), Z(YOrig), W;
+  expr::Evaluate
+  (alpha*expr::Hadamard(expr::Lazy(A), expr::Lazy(B)) +
+   beta*expr::Lazy(Y), Y);
+  Hadamard(A, B, W);
+  Scale(beta, Z);
+  Axpy(alpha, W, Z);
+  if (print)
+  {
+    Print(Y, "fused");
+    Print(Z, "unfused");
+  }
+  CheckClose("alpha A .* B + beta Y", Y, Z);
+
+  // Y := alpha (A - B), where Y does not appear in the expression
+  expr::Evaluate(alpha*(expr::Lazy(A) - expr::Lazy(B)), Y);
+  Z = A;
+  Axpy(T(-1), B, Z);
+  Scale(alpha, Z);
+  CheckClose("alpha (A - B)", Y, Z);
+
+  // Reductions of an expression against reductions of its evaluation
+  CheckClose
+  ("Dot", expr::Dot(expr::Lazy(A), expr::Lazy(B)), Dot(A, B),
+   FrobeniusNorm(A) * FrobeniusNorm(B));
+  CheckClose
+  ("FrobeniusNorm",
+   expr::FrobeniusNorm(alpha*(expr::Lazy(A) - expr::Lazy(B))),
+   FrobeniusNorm(Z), FrobeniusNorm(Z));
+}
+
+// The same comparisons on the local portions of distributed matrices, with
+// the reductions summed over the distribution communicator
+template <typename T>
+void TestExpressions(Int m, Int n, const Grid& g, bool print)
+{
+  OutputFromRoot
+  (g.Comm(), "Testing distributed expressions with ", TypeName<T>());
+  DistMatrix<T> A(g), B(g), YOrig(g);
+  Uniform(A, m, n);
+  Uniform(B, m, n);
+  Uniform(YOrig, m, n);
+  const T alpha = T(2), beta = T(-3);
+
+  // Y shares the distribution and alignments of A and B
+  DistMatrix<T> Y(YOrig), Z(YOrig), W(g);
+  expr::Evaluate
+  (alpha*expr::Hadamard(expr::Lazy(A), expr::Lazy(B)) +
+   beta*expr::Lazy(Y), Y);
+  Hadamard(A, B, W);
+  Scale(beta, Z);
+  Axpy(alpha, W, Z);
+  if (print)
+  {
+    Print(Y, "fused");
+    Print(Z, "unfused");
+  }
+  CheckClose("alpha A .* B + beta Y", Y, Z);
+
+  Z = A;
+  Axpy(T(-1), B, Z);
+  Scale(alpha, Z);
+  expr::Evaluate(alpha*(expr::Lazy(A) - expr::Lazy(B)), Y);
+  CheckClose("alpha (A - B)", Y, Z);
+
+  CheckClose
+  ("Dot", expr::Dot(expr::Lazy(A), expr::Lazy(B), A.DistComm()), Dot(A, B),
+   FrobeniusNorm(A) * FrobeniusNorm(B));
+  CheckClose
+  ("FrobeniusNorm",
+   expr::FrobeniusNorm
+   (alpha*(expr::Lazy(A) - expr::Lazy(B)), A.DistComm()),
+   FrobeniusNorm(Z), FrobeniusNorm(Z));
+}
+
+int main(int argc, char** argv)
+{
+  Environment env(argc, argv);
+  mpi::Comm comm = mpi::COMM_WORLD;
+  try
+  {
+    const Int m = Input("--m", "height", 100);
+    const Int n = Input("--n", "width", 100);
+    const bool print = Input("--print", "print matrices?", false);
+    ProcessInput();
+    PrintInputReport();
+
+    const Grid g(comm);
+    OutputFromRoot(comm, "Testing lazy expressions");
+    if (mpi::Rank(comm) == 0)
+    {
+      TestExpressions<float>(m, n, print);
+      TestExpressions<Complex<float>>(m, n, print);
+      TestExpressions<double>(m, n, print);
+      TestExpressions<Complex<double>>(m, n, print);
+    }
+    TestExpressions<float>(m, n, g, print);
+    TestExpressions<Complex<float>>(m, n, g, print);
+    TestExpressions<double>(m, n, g, print);
+    TestExpressions<Complex<double>>(m, n, g, print);
+  }
+  catch (exception& e)
+  {
+    ReportException(e);
+  }
+}
@@ -7,6 +7,10 @@
   http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
 using namespace El;
 
 template<typename T, Device D>
@@ -141,6 +145,136 @@ void TestGemm
             (orientA, orientB, alpha, A, B, beta, COrig, C, print);
     PopIndent();
 
+    // Test the variant of Gemm that keeps C stationary and overlaps the
+    // panel communication with the local updates
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Pipelined Stationary C Algorithm:");
+    PushIndent();
+    mpi::Barrier(g.Comm());
+    timer.Start();
+    Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C_PIPELINED);
+    mpi::Barrier(g.Comm());
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+    OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if (print)
+        Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+    if (correctness)
+        TestAssociativity
+            (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+    PopIndent();
+
+    // Test the 2.5D variant, which multiplies slices of the inner dimension
+    // on separate layers of the grid and sums the results. The default
+    // depth, the largest c with c^3 <= p dividing p, is one for small grids,
+    // so the smallest nontrivial divisor of p is forced instead.
+    int depth = 1;
+    for (int c=2; c<=g.Size(); ++c)
+    {
+        if (g.Size() % c == 0)
+        {
+            depth = c;
+            break;
+        }
+    }
+    SetGemmReplicationDepth(depth);
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm with depth ",depth,":");
+    PushIndent();
+    mpi::Barrier(g.Comm());
+    timer.Start();
+    Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_25D);
+    SetGemmReplicationDepth(0);
+    mpi::Barrier(g.Comm());
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+    OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if (print)
+        Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+    if (correctness)
+        TestAssociativity
+            (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+    PopIndent();
+
+    if (D == Device::CPU)
+    {
+        // Test Cannon's algorithm, which shifts the operands around the
+        // (virtual) square subgrids of the process grid
+        C = COrig;
+        OutputFromRoot(g.Comm(),"Cannon Algorithm:");
+        PushIndent();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_CANNON);
+        mpi::Barrier(g.Comm());
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot
+            (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+    }
+
+    // Calibrate the default algorithm for this shape, check that the choice
+    // survives a round trip through a tuning table file, and run with it
+    OutputFromRoot(g.Comm(),"Calibrated Default Algorithm:");
+    PushIndent();
+    const GemmChoice choice = CalibrateGemm<T>(orientA, orientB, m, n, k, g);
+    const char* tmpDir = std::getenv("TMPDIR");
+    const string tableName =
+        BuildString
+        ((tmpDir != nullptr ? tmpDir : "/tmp"),
+         "/GemmTuningTable-",getpid(),".txt");
+    SaveGemmTuningTable(tableName, g.Comm());
+    ClearGemmTuningTable();
+    LoadGemmTuningTable(tableName, g.Comm());
+
+    // An entry with an out-of-range algorithm must be rejected everywhere
+    if (g.Rank() == 0)
+    {
+        std::ofstream badTable(tableName.c_str());
+        badTable << "N N 5 5 5 1 1 8 " << Int(GEMM_SUMMA_25D)+1 << " 64\n";
+    }
+    bool rejected = false;
+    try { LoadGemmTuningTable(tableName, g.Comm()); }
+    catch (std::runtime_error&) { rejected = true; }
+    if (g.Rank() == 0)
+        std::remove(tableName.c_str());
+    if (!rejected)
+        LogicError("Gemm tuning table accepted an invalid algorithm");
+    const GemmChoice loadedChoice =
+        SelectGemmAlgorithm<T>(orientA, orientB, m, n, k, g);
+    if (loadedChoice.alg != choice.alg ||
+        loadedChoice.blocksize != choice.blocksize)
+        LogicError("Gemm tuning table did not round trip");
+    OutputFromRoot
+        (g.Comm(),"Chose algorithm ",Int(choice.alg)," with blocksize ",
+         choice.blocksize);
+    C = COrig;
+    mpi::Barrier(g.Comm());
+    timer.Start();
+    Gemm(orientA, orientB, alpha, A, B, beta, C);
+    mpi::Barrier(g.Comm());
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+    OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if (correctness)
+        TestAssociativity
+            (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+    ClearGemmTuningTable();
+    PopIndent();
+
     if (orientA == NORMAL && orientB == NORMAL)
     {
         // Test the variant of Gemm for panel-panel dot products
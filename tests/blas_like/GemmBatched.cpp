@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckProduct
+( const string& name, Int i, const Matrix<T>& C, const Matrix<T>& CRef )
+{
+    Matrix<T> E( C );
+    E -= CRef;
+    const Base<T> tol =
+      100*limits::Epsilon<Base<T>>()*(FrobeniusNorm(CRef)+1);
+    if( FrobeniusNorm(E) > tol )
+        LogicError(name," product ",i," was incorrect");
+}
+
+template<typename T>
+void TestLocalBatches
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, Int batchSize )
+{
+    const T alpha = T(2), beta = T(-1);
+    const Int AHeight = ( orientA == NORMAL ? m : k );
+    const Int AWidth = ( orientA == NORMAL ? k : m );
+    const Int BHeight = ( orientB == NORMAL ? k : n );
+    const Int BWidth = ( orientB == NORMAL ? n : k );
+
+    // Store the batch as a single strided matrix of each operand
+    Matrix<T> A, B, C, CRef;
+    Uniform( A, AHeight, AWidth*batchSize );
+    Uniform( B, BHeight, BWidth*batchSize );
+    Uniform( C, m, n*batchSize );
+    CRef = C;
+    for( Int i=0; i<batchSize; ++i )
+    {
+        auto CRefBlock = CRef( ALL, IR(i*n,(i+1)*n) );
+        Gemm
+        ( orientA, orientB, alpha,
+          A( ALL, IR(i*AWidth,(i+1)*AWidth) ),
+          B( ALL, IR(i*BWidth,(i+1)*BWidth) ), beta, CRefBlock );
+    }
+
+    Matrix<T> CStrided( C );
+    GemmStridedBatched
+    ( orientA, orientB, m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(), AWidth*A.LDim(),
+             B.LockedBuffer(), B.LDim(), BWidth*B.LDim(),
+      beta,  CStrided.Buffer(), CStrided.LDim(), n*CStrided.LDim(),
+      batchSize );
+
+    vector<Matrix<T>> ABlocks(batchSize), BBlocks(batchSize),
+      CBlocks(batchSize);
+    for( Int i=0; i<batchSize; ++i )
+    {
+        ABlocks[i] = A( ALL, IR(i*AWidth,(i+1)*AWidth) );
+        BBlocks[i] = B( ALL, IR(i*BWidth,(i+1)*BWidth) );
+        CBlocks[i] = C( ALL, IR(i*n,(i+1)*n) );
+    }
+    GemmBatched( orientA, orientB, alpha, ABlocks, BBlocks, beta, CBlocks );
+
+    for( Int i=0; i<batchSize; ++i )
+    {
+        auto CRefBlock = CRef( ALL, IR(i*n,(i+1)*n) );
+        CheckProduct
+        ( "strided", i, CStrided( ALL, IR(i*n,(i+1)*n) ), CRefBlock );
+        CheckProduct( "matrix", i, CBlocks[i], CRefBlock );
+    }
+
+    // Batched matrix-vector products with the same left operands
+    Matrix<T> X, y, yRef;
+    Uniform( X, k, batchSize );
+    Uniform( y, m, batchSize );
+    yRef = y;
+    for( Int i=0; i<batchSize; ++i )
+    {
+        auto yRefCol = yRef( ALL, IR(i) );
+        Gemv( orientA, alpha, ABlocks[i], X( ALL, IR(i) ), beta, yRefCol );
+    }
+    GemvStridedBatched
+    ( orientA, AHeight, AWidth,
+      alpha, A.LockedBuffer(), A.LDim(), AWidth*A.LDim(),
+             X.LockedBuffer(), 1, X.LDim(),
+      beta,  y.Buffer(), 1, y.LDim(), batchSize );
+    for( Int i=0; i<batchSize; ++i )
+        CheckProduct( "Gemv", i, y( ALL, IR(i) ), yRef( ALL, IR(i) ) );
+}
+
+template<typename T>
+void TestDistBatches( const Grid& g, Int m, Int n, Int k, Int batchSize )
+{
+    const T alpha = T(3), beta = T(1);
+    vector<DistMatrix<T,STAR,STAR>> A, B, C;
+    vector<DistMatrix<T,CIRC,CIRC>> ACirc, BCirc, CCirc;
+    vector<Matrix<T>> CRef(batchSize);
+    for( Int i=0; i<batchSize; ++i )
+    {
+        A.emplace_back( g );
+        B.emplace_back( g );
+        C.emplace_back( g );
+        Uniform( A[i], m, k );
+        Uniform( B[i], k, n );
+        Uniform( C[i], m, n );
+        CRef[i] = C[i].Matrix();
+        Gemm
+        ( NORMAL, NORMAL, alpha, A[i].LockedMatrix(), B[i].LockedMatrix(),
+          beta, CRef[i] );
+
+        // Scatter the [CIRC,CIRC] products over the processes
+        const int root = i % g.Size();
+        ACirc.emplace_back( g, root );
+        BCirc.emplace_back( g, root );
+        CCirc.emplace_back( g, root );
+        ACirc[i] = A[i];
+        BCirc[i] = B[i];
+        CCirc[i] = C[i];
+    }
+
+    GemmBatched( NORMAL, NORMAL, alpha, A, B, beta, C );
+    GemmBatched( NORMAL, NORMAL, alpha, ACirc, BCirc, beta, CCirc );
+    for( Int i=0; i<batchSize; ++i )
+    {
+        CheckProduct( "[STAR,STAR]", i, C[i].LockedMatrix(), CRef[i] );
+        DistMatrix<T,STAR,STAR> CCopy( CCirc[i] );
+        CheckProduct( "[CIRC,CIRC]", i, CCopy.LockedMatrix(), CRef[i] );
+    }
+}
+
+// Products whose dimensions vary within the batch, in runs of consecutive
+// products of the same shape, including empty and rank-zero updates
+template<typename T>
+void TestMixedBatches
+( const Grid& g, Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, Int batchSize )
+{
+    const T alpha = T(-2), beta = T(3);
+    const Int shapes[][3] =
+      { { m, n, k }, { n, k, m }, { k, m, n }, { m, 0, k }, { m, n, 0 } };
+    const Int numShapes = sizeof(shapes)/sizeof(shapes[0]);
+
+    vector<Matrix<T>> A(batchSize), B(batchSize), C(batchSize),
+      CRef(batchSize);
+    vector<DistMatrix<T,STAR,STAR>> ADist, BDist, CDist;
+    for( Int i=0; i<batchSize; ++i )
+    {
+        const Int* shape = shapes[(i/2)%numShapes];
+        const Int mi = shape[0], ni = shape[1], ki = shape[2];
+        if( orientA == NORMAL )
+            Uniform( A[i], mi, ki );
+        else
+            Uniform( A[i], ki, mi );
+        if( orientB == NORMAL )
+            Uniform( B[i], ki, ni );
+        else
+            Uniform( B[i], ni, ki );
+        Uniform( C[i], mi, ni );
+        CRef[i] = C[i];
+        Gemm( orientA, orientB, alpha, A[i], B[i], beta, CRef[i] );
+
+        ADist.emplace_back( g );
+        BDist.emplace_back( g );
+        CDist.emplace_back( g );
+        ADist[i].Resize( A[i].Height(), A[i].Width() );
+        BDist[i].Resize( B[i].Height(), B[i].Width() );
+        CDist[i].Resize( mi, ni );
+        ADist[i].Matrix() = A[i];
+        BDist[i].Matrix() = B[i];
+        CDist[i].Matrix() = C[i];
+    }
+
+    GemmBatched( orientA, orientB, alpha, A, B, beta, C );
+    GemmBatched( orientA, orientB, alpha, ADist, BDist, beta, CDist );
+    for( Int i=0; i<batchSize; ++i )
+    {
+        CheckProduct( "mixed", i, C[i], CRef[i] );
+        CheckProduct
+        ( "mixed [STAR,STAR]", i, CDist[i].LockedMatrix(), CRef[i] );
+    }
+}
+
+template<typename T>
+void TestGemmBatched
+( const Grid& g, Int m, Int n, Int k, Int batchSize )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    const Orientation orients[] = { NORMAL, TRANSPOSE, ADJOINT };
+    for( auto orientA : orients )
+        for( auto orientB : orients )
+            TestLocalBatches<T>( orientA, orientB, m, n, k, batchSize );
+    OutputFromRoot(g.Comm(),"Local batches passed");
+    for( auto orientA : orients )
+        for( auto orientB : orients )
+            TestMixedBatches<T>( g, orientA, orientB, m, n, k, batchSize );
+    OutputFromRoot(g.Comm(),"Mixed-shape batches passed");
+    TestDistBatches<T>( g, m, n, k, batchSize );
+    OutputFromRoot(g.Comm(),"Distributed batches passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of each product",16);
+        const Int n = Input("--n","width of each product",24);
+        const Int k = Input("--k","inner dimension of each product",20);
+        const Int batchSize = Input("--batchSize","number of products",17);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestGemmBatched<float>( g, m, n, k, batchSize );
+        TestGemmBatched<double>( g, m, n, k, batchSize );
+        TestGemmBatched<Complex<double>>( g, m, n, k, batchSize );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
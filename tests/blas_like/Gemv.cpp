@@ -51,6 +51,57 @@ void TestGemv
     PopIndent();
 }
 
+template<typename T>
+void TestMultiGemv
+(Orientation orientA,
+ Int m,
+ Int numVecs,
+ T alpha,
+ T beta,
+ const Grid& g)
+{
+    OutputFromRoot(g.Comm(),"Testing multi-vector Gemv with ",TypeName<T>());
+    PushIndent();
+
+    // Use a non-standard distribution of A so that the plan keeps a copy
+    DistMatrix<T,MC,MR> A(g), X(g), Y(g), YRef(g);
+    DistMatrix<T,VC,STAR> A_VC_STAR(g);
+    Uniform(A, m, m);
+    Uniform(X, m, numVecs);
+    Uniform(Y, m, numVecs);
+    A_VC_STAR = A;
+    YRef = Y;
+    Gemm(orientA, NORMAL, alpha, A, X, beta, YRef);
+
+    for (Int blockSize : { Int(1), Int(7), numVecs+1 })
+    {
+        MultiGemvPlan<T> plan(A, blockSize), planCopy(A_VC_STAR, blockSize);
+        DistMatrix<T,MC,MR> Y_MC_MR(Y);
+        DistMatrix<T,STAR,VR> Y_STAR_VR(Y);
+
+        mpi::Barrier(g.Comm());
+        Timer timer;
+        timer.Start();
+        plan.Apply(orientA, alpha, X, beta, Y_MC_MR);
+        mpi::Barrier(g.Comm());
+        const double runTime = timer.Stop();
+        planCopy.Apply(orientA, alpha, X, beta, Y_STAR_VR);
+
+        const Base<T> tol =
+          m*limits::Epsilon<Base<T>>()*(FrobeniusNorm(YRef)+1);
+        Y_MC_MR -= YRef;
+        DistMatrix<T,MC,MR> E(Y_STAR_VR);
+        E -= YRef;
+        if (FrobeniusNorm(Y_MC_MR) > tol || FrobeniusNorm(E) > tol)
+            LogicError("Multi-vector Gemv with blocksize ",blockSize,
+                       " did not match Gemm");
+        OutputFromRoot
+        (g.Comm(),"Blocksize ",blockSize," passed in ",runTime," seconds");
+    }
+
+    PopIndent();
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -63,6 +114,7 @@ main(int argc, char* argv[])
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const char transA = Input("--transA","orientation of A: N/T/C",'N');
         const Int m = Input("--m","height of matrix",100);
+        const Int numVecs = Input("--numVecs","number of vectors",20);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
@@ -108,6 +160,11 @@ main(int argc, char* argv[])
           Complex<double>(3), Complex<double>(4),
           print, g);
 
+        TestMultiGemv<float>
+        (orientA, m, numVecs, float(3), float(4), g);
+        TestMultiGemv<Complex<double>>
+        (orientA, m, numVecs, Complex<double>(3), Complex<double>(4), g);
+
 #ifdef EL_HAVE_QD
         TestGemv<DoubleDouble>
         (orientA, m,
@@ -69,6 +69,9 @@ void TestAssociativity
     OutputFromRoot
     (g.Comm(),"|| E ||_F / || Y ||_F = ",
      EFrobNorm,"/",YFrobNorm,"=",EFrobNorm/YFrobNorm);
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    if( EFrobNorm > (A.Height()+A.Width())*eps*YFrobNorm )
+        LogicError("Relative error was unacceptably large");
 }
 
 template<typename T>
@@ -88,7 +91,9 @@ void TestSyrk
   Int colAlignC=0, Int rowAlignC=0,
   bool contigA=true, bool contigC=true )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    OutputFromRoot
+    (g.Comm(),"Testing ",UpperOrLowerToChar(uplo),
+     OrientationToChar(orientation)," with k=",k," and ",TypeName<T>());
     PushIndent();
 
     SetLocalTrrkBlocksize<T>( nbLocal );
@@ -172,10 +177,10 @@ main( int argc, char* argv[] )
         int gridHeight = Input("--gridHeight","height of process grid",0);
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const bool conjugate = Input("--conjugate","conjugate Syrk?",false);
-        const char uploChar = Input("--uplo","upper/lower storage: L/U",'L');
-        const char transChar = Input("--trans","orientation: N/C",'N');
         const Int m = Input("--m","height of result",100);
         const Int k = Input("--k","inner dimension",100);
+        const Int tsRatio =
+          Input("--tsRatio","inner dimension over m for tall-skinny run",20);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool print = Input("--print","print matrices?",false);
@@ -193,96 +198,108 @@ main( int argc, char* argv[] )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid g( comm, gridHeight, order );
-        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
-        const Orientation orientation = CharToOrientation( transChar );
         SetBlocksize( nb );
 
         ComplainIfDebug();
-        OutputFromRoot(comm,"Will test Syrk ",uploChar,transChar);
+        OutputFromRoot(comm,"Will test Syrk");
 
-        TestSyrk<float>
-        ( conjugate, uplo, orientation, m, k,
-          float(3), float(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
-        TestSyrk<Complex<float>>
-        ( conjugate, uplo, orientation, m, k,
-          Complex<float>(3), Complex<float>(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
+        // The transposed orientation is the one whose [VC,STAR] tall-skinny
+        // path reduces only a triangle of the Gram matrix
+        const Orientation transOrient = ( conjugate ? ADJOINT : TRANSPOSE );
+        for( const UpperOrLower uplo : {LOWER,UPPER} )
+        {
+            for( const Orientation orientation : {NORMAL,transOrient} )
+            {
+                // The second run is tall-skinny enough to take the direct
+                // reduction of the Gram matrix into its owners
+                for( const Int kTest : { k, tsRatio*m } )
+                {
+                    TestSyrk<float>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      float(3), float(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
+                    TestSyrk<Complex<float>>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Complex<float>(3), Complex<float>(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
 
-        TestSyrk<double>
-        ( conjugate, uplo, orientation, m, k,
-          double(3), double(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
-        TestSyrk<Complex<double>>
-        ( conjugate, uplo, orientation, m, k,
-          Complex<double>(3), Complex<double>(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
+                    TestSyrk<double>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      double(3), double(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
+                    TestSyrk<Complex<double>>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Complex<double>(3), Complex<double>(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
 
 #ifdef EL_HAVE_QD
-        TestSyrk<DoubleDouble>
-        ( conjugate, uplo, orientation, m, k,
-          DoubleDouble(3), DoubleDouble(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
-        TestSyrk<QuadDouble>
-        ( conjugate, uplo, orientation, m, k,
-          QuadDouble(3), QuadDouble(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
+                    TestSyrk<DoubleDouble>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      DoubleDouble(3), DoubleDouble(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
+                    TestSyrk<QuadDouble>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      QuadDouble(3), QuadDouble(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
 
-        TestSyrk<Complex<DoubleDouble>>
-        ( conjugate, uplo, orientation, m, k,
-          Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
-        TestSyrk<Complex<QuadDouble>>
-        ( conjugate, uplo, orientation, m, k,
-          Complex<QuadDouble>(3), Complex<QuadDouble>(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
+                    TestSyrk<Complex<DoubleDouble>>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
+                    TestSyrk<Complex<QuadDouble>>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Complex<QuadDouble>(3), Complex<QuadDouble>(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestSyrk<Quad>
-        ( conjugate, uplo, orientation, m, k,
-          Quad(3), Quad(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
-        TestSyrk<Complex<Quad>>
-        ( conjugate, uplo, orientation, m, k,
-          Complex<Quad>(3), Complex<Quad>(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
+                    TestSyrk<Quad>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Quad(3), Quad(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
+                    TestSyrk<Complex<Quad>>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Complex<Quad>(3), Complex<Quad>(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestSyrk<BigFloat>
-        ( conjugate, uplo, orientation, m, k,
-          BigFloat(3), BigFloat(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
-        TestSyrk<Complex<BigFloat>>
-        ( conjugate, uplo, orientation, m, k,
-          Complex<BigFloat>(3), Complex<BigFloat>(4),
-          g, print, correctness, nbLocal,
-          colAlignA, rowAlignA, colAlignC, rowAlignC,
-          contigA, contigC );
+                    TestSyrk<BigFloat>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      BigFloat(3), BigFloat(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
+                    TestSyrk<Complex<BigFloat>>
+                    ( conjugate, uplo, orientation, m, kTest,
+                      Complex<BigFloat>(3), Complex<BigFloat>(4),
+                      g, print, correctness, nbLocal,
+                      colAlignA, rowAlignA, colAlignC, rowAlignC,
+                      contigA, contigC );
 #endif
+                }
+            }
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -18,18 +18,23 @@ void TestTrsm
   Int m,
   Int n,
   F alpha,
+  TrsmAlgorithm alg,
   const Grid& g,
   bool print )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<F>(),", uplo ",
+     UpperOrLowerToChar(uplo)," and algorithm ",Int(alg));
     PushIndent();
 
     DistMatrix<F> A(g), X(g);
 
-    if( side == LEFT )
-        HermitianUniformSpectrum( A, m, 1, 10 );
-    else
-        HermitianUniformSpectrum( A, n, 1, 10 );
+    // Shrink the off-diagonal entries so that the triangle is diagonally
+    // dominant, and hence well-conditioned, for either type of diagonal
+    const Int size = ( side == LEFT ? m : n );
+    Uniform( A, size, size );
+    A *= F(1)/F(size);
+    ShiftDiagonal( A, F(1) );
     auto S( A );
     MakeTrapezoidal( uplo, S );
     if( diag == UNIT )
@@ -53,7 +58,14 @@ void TestTrsm
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    Trsm( side, uplo, orientation, diag, alpha, A, Y );
+    {
+        // A blocksize well below the height runs several lookahead steps, so
+        // that the update of the trailing right-hand sides is exercised
+        BlocksizeGuard guard
+        ( alg == TRSM_LARGE_LOOKAHEAD ? Min(Blocksize(),Int(16))
+                                      : Blocksize() );
+        Trsm( side, uplo, orientation, diag, alpha, A, Y, false, alg );
+    }
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops =
@@ -74,6 +86,10 @@ void TestTrsm
      "|| S ||_F = ",SFrob,"\n",Indent(),
      "|| X ||_F = ",XFrob,"\n",Indent(),
      "|| E ||_F = ",EFrob);
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    if( EFrob > Real(size)*eps*SFrob*XFrob )
+        LogicError("Trsm residual was too large");
 
     PopIndent();
 }
@@ -89,8 +105,6 @@ main( int argc, char* argv[] )
         int gridHeight = Input("--gridHeight","height of process grid",0);
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const char sideChar = Input("--side","side to solve from: L/R",'L');
-        const char uploChar = Input
-            ("--uplo","lower or upper triangular: L/U",'L');
         const char transChar = Input
             ("--trans","orientation of triangular matrix: N/T/C",'N');
         const char diagChar = Input("--diag","(non-)unit diagonal: N/U",'N');
@@ -106,86 +120,100 @@ main( int argc, char* argv[] )
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
         const Grid g( comm, gridHeight, order );
         const LeftOrRight side = CharToLeftOrRight( sideChar );
-        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         const Orientation orientation = CharToOrientation( transChar );
         const UnitOrNonUnit diag = CharToUnitOrNonUnit( diagChar );
         SetBlocksize( nb );
 
         ComplainIfDebug();
         OutputFromRoot
-        (comm,"Will test Trsm ",sideChar,uploChar,transChar,diagChar);
-
-        TestTrsm<float>
-        ( side, uplo, orientation, diag,
-          m, n,
-          float(3),
-          g, print );
-        TestTrsm<Complex<float>>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Complex<float>(3),
-          g, print );
-
-        TestTrsm<double>
-        ( side, uplo, orientation, diag,
-          m, n,
-          double(3),
-          g, print );
-        TestTrsm<Complex<double>>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Complex<double>(3),
-          g, print );
+        (comm,"Will test Trsm ",sideChar,"(L/U)",transChar,diagChar);
+
+        vector<TrsmAlgorithm> algs( 1, TRSM_DEFAULT );
+        if( side == LEFT )
+        {
+            algs.push_back( TRSM_LARGE );
+            algs.push_back( TRSM_MEDIUM );
+            algs.push_back( TRSM_SMALL );
+            if( orientation == NORMAL )
+                algs.push_back( TRSM_LARGE_LOOKAHEAD );
+        }
+        for( const UpperOrLower uplo : {LOWER,UPPER} )
+        {
+            for( const TrsmAlgorithm alg : algs )
+            {
+                TestTrsm<float>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  float(3),
+                  alg, g, print );
+                TestTrsm<Complex<float>>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Complex<float>(3),
+                  alg, g, print );
+
+                TestTrsm<double>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  double(3),
+                  alg, g, print );
+                TestTrsm<Complex<double>>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Complex<double>(3),
+                  alg, g, print );
 
 #ifdef EL_HAVE_QD
-        TestTrsm<DoubleDouble>
-        ( side, uplo, orientation, diag,
-          m, n,
-          DoubleDouble(3),
-          g, print );
-        TestTrsm<QuadDouble>
-        ( side, uplo, orientation, diag,
-          m, n,
-          QuadDouble(3),
-          g, print );
-
-        TestTrsm<Complex<DoubleDouble>>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Complex<DoubleDouble>(3),
-          g, print );
-        TestTrsm<Complex<QuadDouble>>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Complex<QuadDouble>(3),
-          g, print );
+                TestTrsm<DoubleDouble>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  DoubleDouble(3),
+                  alg, g, print );
+                TestTrsm<QuadDouble>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  QuadDouble(3),
+                  alg, g, print );
+
+                TestTrsm<Complex<DoubleDouble>>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Complex<DoubleDouble>(3),
+                  alg, g, print );
+                TestTrsm<Complex<QuadDouble>>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Complex<QuadDouble>(3),
+                  alg, g, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestTrsm<Quad>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Quad(3),
-          g, print );
-        TestTrsm<Complex<Quad>>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Complex<Quad>(3),
-          g, print );
+                TestTrsm<Quad>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Quad(3),
+                  alg, g, print );
+                TestTrsm<Complex<Quad>>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Complex<Quad>(3),
+                  alg, g, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestTrsm<BigFloat>
-        ( side, uplo, orientation, diag,
-          m, n,
-          BigFloat(3),
-          g, print );
-        TestTrsm<Complex<BigFloat>>
-        ( side, uplo, orientation, diag,
-          m, n,
-          Complex<BigFloat>(3),
-          g, print );
+                TestTrsm<BigFloat>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  BigFloat(3),
+                  alg, g, print );
+                TestTrsm<Complex<BigFloat>>
+                ( side, uplo, orientation, diag,
+                  m, n,
+                  Complex<BigFloat>(3),
+                  alg, g, print );
 #endif
+            }
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
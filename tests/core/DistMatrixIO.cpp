@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestRead
+( const DistMatrix<T>& A, const string& filename, FileFormat format )
+{
+    DistMatrix<T,U,V> B(A.Grid());
+    if( format == BINARY_FLAT )
+        B.Resize( A.Height(), A.Width() );
+    Read( B, filename, format );
+
+    // Binary I/O is exact, so any difference is an error
+    DistMatrix<T,U,V> E(A);
+    E -= B;
+    const auto maxErr = MaxNorm( E );
+    if( maxErr != Base<T>(0) )
+        LogicError
+        ("Reading ",filename," into [",DistToString(U),",",DistToString(V),
+         "] failed with an error of ",maxErr);
+}
+
+// Each process maps its own file, since the mappings are purely local
+template<typename T>
+void TestMappedBinaryFlat( mpi::Comm comm, Int m, Int n )
+{
+    Matrix<T> A;
+    Uniform( A, m, n );
+    const string basename =
+      "MappedBinaryFlat" + std::to_string(mpi::Rank(comm));
+    const string filename = basename + "." + FileExtension(BINARY_FLAT);
+    Write( A, basename, BINARY_FLAT );
+
+    {
+        MappedBinaryFlat<T> mapping( filename, m, n );
+        Matrix<T> E( A );
+        E -= mapping.LockedMatrix();
+        if( MaxNorm(E) != Base<T>(0) )
+            LogicError("Read-only mapping did not match the written matrix");
+    }
+
+    MappedFileCtrl ctrl;
+    ctrl.writable = true;
+    {
+        MappedBinaryFlat<T> mapping( filename, m, n, ctrl );
+        mapping.Matrix() *= T(2);
+        mapping.Flush();
+    }
+    Matrix<T> B;
+    B.Resize( m, n );
+    Read( B, filename, BINARY_FLAT );
+    A *= T(2);
+    B -= A;
+    if( MaxNorm(B) != Base<T>(0) )
+        LogicError("Writable mapping did not update the file");
+    std::remove( filename.c_str() );
+    OutputFromRoot(comm,"Memory-mapped round trips passed");
+}
+
+template<typename T>
+void TestDistMatrixIO( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    TestMappedBinaryFlat<T>( g.Comm(), m, n );
+
+    DistMatrix<T> A(g);
+    A.Align( Min(1,g.Height()-1), 0 );
+    Uniform( A, m, n );
+
+    const string basename = "DistMatrixIO";
+    const FileFormat formats[] = { BINARY, BINARY_FLAT };
+    for( auto format : formats )
+    {
+        Write( A, basename, format );
+        const string filename = basename + "." + FileExtension(format);
+        TestRead<T,MC,MR>( A, filename, format );
+        TestRead<T,VR,STAR>( A, filename, format );
+        TestRead<T,STAR,VC>( A, filename, format );
+        TestRead<T,STAR,STAR>( A, filename, format );
+        TestRead<T,CIRC,CIRC>( A, filename, format );
+        OutputFromRoot
+        (g.Comm(),FileExtension(format)," round trips passed");
+        mpi::Barrier( g.Comm() );
+        if( g.Rank() == 0 )
+            std::remove( filename.c_str() );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",63);
+        const Int n = Input("--width","width of matrix",37);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDistMatrixIO<float>( g, m, n );
+        TestDistMatrixIO<double>( g, m, n );
+        TestDistMatrixIO<Complex<double>>( g, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckIdentical
+( const string& name, const Matrix<T>& A, const Matrix<T>& B )
+{
+    Matrix<T> E( A );
+    E -= B;
+    const auto maxErr = MaxNorm( E );
+    if( maxErr != Base<T>(0) )
+        LogicError(name," differed by ",maxErr);
+}
+
+// Copies A, on one grid, into a [MR,MC] matrix over another grid, first in
+// a single chunk and then with a budget small enough that the columns are
+// streamed in several chunks. Both must match the entries of A cast to T,
+// which, when T is narrower than S, is also the transmission type.
+template<typename S,typename T>
+void TestGeneralPurposeCopy
+( const Grid& gA, const Grid& gB, Int m, Int n, bool print )
+{
+    OutputFromRoot
+    (gA.Comm(),"Testing ",TypeName<S>()," to ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<S> A(gA);
+    Uniform( A, m, n );
+    DistMatrix<S,STAR,STAR> AFull( A );
+    Matrix<T> ACast;
+    Copy( AFull.LockedMatrix(), ACast );
+
+    const size_t budget = GeneralPurposeMemoryBudget();
+    DistMatrix<T,MR,MC> B(gB), BChunked(gB);
+    copy::GeneralPurpose( A, B );
+    SetGeneralPurposeMemoryBudget( m*sizeof(T) );
+    copy::GeneralPurpose( A, BChunked );
+    SetGeneralPurposeMemoryBudget( budget );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( BChunked, "BChunked" );
+    }
+
+    DistMatrix<T,STAR,STAR> BFull( B ), BChunkedFull( BChunked );
+    CheckIdentical( "Unchunked copy", BFull.LockedMatrix(), ACast );
+    CheckIdentical
+    ( "Chunked copy", BChunkedFull.LockedMatrix(), BFull.LockedMatrix() );
+
+    OutputFromRoot(gA.Comm(),"Chunked copy matched");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",60);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid gSquare( comm ), gColumn( comm, 1, ROW_MAJOR );
+        TestGeneralPurposeCopy<double,double>( gSquare, gColumn, m, n, print );
+        TestGeneralPurposeCopy<double,float>( gSquare, gColumn, m, n, print );
+        TestGeneralPurposeCopy<float,double>( gColumn, gSquare, m, n, print );
+        TestGeneralPurposeCopy<Complex<double>,Complex<float>>
+        ( gSquare, gColumn, m, n, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestHostMemoryPool( Int m, Int n, Int numIts )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    HostMemoryPoolRelease();
+    ResetHostMemoryPoolStatistics();
+
+    // Repeatedly create and destroy same-sized temporaries; after the first
+    // iteration every request should be served from the free lists
+    for( Int it=0; it<numIts; ++it )
+    {
+        Matrix<T> A;
+        A.SetMemoryMode( 2 );
+        A.Resize( m, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                A.Set( i, j, T(i+j*m) );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( A.Get(i,j) != T(i+j*m) )
+                    LogicError("Pooled matrix was not properly filled");
+    }
+
+    auto stats = GetHostMemoryPoolStatistics();
+    if( stats.numMisses != 1 || stats.numHits != size_t(numIts-1) )
+        LogicError
+        ("Expected 1 miss and ",numIts-1," hits but found ",
+         stats.numMisses," misses and ",stats.numHits," hits");
+    if( stats.numBytesInUse != 0 )
+        LogicError("Pool still reports ",stats.numBytesInUse," bytes in use");
+    if( stats.highWaterBytes < m*n*sizeof(T) )
+        LogicError("High-water mark was below the matrix size");
+
+    // With a zero cap, freed blocks must be returned to the system
+    const size_t oldCap = HostMemoryPoolMaxCachedBytes();
+    SetHostMemoryPoolMaxCachedBytes( 0 );
+    HostMemoryPoolRelease();
+    {
+        Matrix<T> A;
+        A.SetMemoryMode( 2 );
+        A.Resize( m, n );
+    }
+    stats = GetHostMemoryPoolStatistics();
+    if( stats.numBytesCached != 0 )
+        LogicError("Pool cached ",stats.numBytesCached," bytes despite cap");
+    SetHostMemoryPoolMaxCachedBytes( oldCap );
+
+    PopIndent();
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numIts = Input("--numIts","number of allocations",10);
+        const bool print = Input("--print","print statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestHostMemoryPool<float>( m, n, numIts );
+            TestHostMemoryPool<Complex<float>>( m, n, numIts );
+
+            TestHostMemoryPool<double>( m, n, numIts );
+            TestHostMemoryPool<Complex<double>>( m, n, numIts );
+
+            if( print )
+                PrintHostMemoryPoolStatistics();
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestNonblockingCollectives( mpi::Comm comm, Int m, Int n )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+
+    // AllReduce of a matrix whose leading dimension exceeds its height, so
+    // that the packed path is exercised
+    Matrix<T> A( m, n, m+3 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A.Set( i, j, T(i+j*m+commRank) );
+    auto reduceRequest = IAllReduce( A, comm );
+    Wait( reduceRequest );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            const T expected =
+              T(commSize*(i+j*m)) + T(commSize*(commSize-1)/2);
+            if( A.Get(i,j) != expected )
+                LogicError
+                ("IAllReduce: A(",i,",",j,")=",A.Get(i,j),
+                 " instead of ",expected);
+        }
+
+    // Broadcast from the last process
+    const int root = commSize-1;
+    Matrix<T> B( m, n, m+1 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            B.Set( i, j, commRank == root ? T(i-j) : T(0) );
+    auto broadcastRequest = IBroadcast( B, comm, root );
+    while( !Test(broadcastRequest) ) { }
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B.Get(i,j) != T(i-j) )
+                LogicError("IBroadcast: B(",i,",",j,") was incorrect");
+
+    // AllGather and AllToAll of one entry per process
+    vector<T> sendBuf(commSize), recvBuf(commSize);
+    for( int q=0; q<commSize; ++q )
+        sendBuf[q] = T(commRank*commSize+q);
+    mpi::Request<T> request;
+    mpi::IAllGather( sendBuf.data(), 1, recvBuf.data(), 1, comm, request );
+    mpi::Wait( request );
+    for( int q=0; q<commSize; ++q )
+        if( recvBuf[q] != T(q*commSize) )
+            LogicError("IAllGather: entry ",q," was incorrect");
+    mpi::IAllToAll( sendBuf.data(), 1, recvBuf.data(), 1, comm, request );
+    mpi::Wait( request );
+    for( int q=0; q<commSize; ++q )
+        if( recvBuf[q] != T(q*commSize+commRank) )
+            LogicError("IAllToAll: entry ",q," was incorrect");
+
+    // ReduceScatter of one entry per process
+    T result;
+    mpi::IReduceScatter( sendBuf.data(), &result, 1, comm, request );
+    mpi::Wait( request );
+    const T expected =
+      T(commSize*(commSize-1)/2*commSize) + T(commSize*commRank);
+    if( result != expected )
+        LogicError("IReduceScatter: ",result," instead of ",expected);
+
+    PopIndent();
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",20);
+        const Int n = Input("--width","width of matrix",10);
+        ProcessInput();
+        PrintInputReport();
+
+        TestNonblockingCollectives<float>( comm, m, n );
+        TestNonblockingCollectives<Complex<float>>( comm, m, n );
+
+        TestNonblockingCollectives<double>( comm, m, n );
+        TestNonblockingCollectives<Complex<double>>( comm, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
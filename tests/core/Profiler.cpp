@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A profiled distributed Gemm must record its regions and remain silent
+// once profiling is disabled
+template<typename T>
+void TestProfiler( mpi::Comm comm, Int m, Int n, Int k, bool trace )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+
+    const Grid g( comm );
+    DistMatrix<T> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Zeros( C, m, n );
+
+    ResetProfile();
+    EnableProfiling( trace );
+    {
+        EL_PROFILE_REGION("TestProfiler");
+        Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C );
+    }
+    DisableProfiling();
+
+    ostringstream local;
+    PrintProfile( local );
+    if( local.str().find("TestProfiler") == string::npos ||
+        local.str().find("Gemm") == string::npos )
+        LogicError("The profile was missing the Gemm regions:\n",local.str());
+
+    // Regions entered while disabled must not be recorded, so neither the
+    // call counts nor the times of the Gemm regions may change
+    Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C );
+    ostringstream localAfter;
+    PrintProfile( localAfter );
+    if( localAfter.str() != local.str() )
+        LogicError
+        ("A Gemm was recorded while profiling was disabled:\n",
+         localAfter.str());
+
+    PrintReducedProfile( comm );
+    if( trace )
+        WriteProfileTrace( "ProfilerTest.json", comm );
+
+    OutputFromRoot(comm,"Profiled regions were recorded");
+    PopIndent();
+}
+
+// The counters must record the volume of each call's arguments against its
+// communicator
+void TestCommCounters( mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing the communication counters");
+    PushIndent();
+
+    const int commSize = mpi::Size( comm );
+    const int count = 17;
+    vector<double> sendBuf( count, 1. ), recvBuf( count*commSize );
+
+    ResetCommCounters();
+    EnableCommCounters( false );
+    mpi::AllGather( sendBuf.data(), count, recvBuf.data(), count, comm );
+    mpi::AllReduce( sendBuf.data(), count, mpi::SUM, comm );
+    mpi::Broadcast( sendBuf.data(), count, 0, mpi::COMM_SELF );
+    DisableCommCounters();
+    mpi::AllReduce( sendBuf.data(), count, mpi::SUM, comm );
+
+    // Calls which return early over a single process move no data and are
+    // not counted
+    const CommCounts counts = GetCommCounts( comm );
+    const double bytes = count*sizeof(double);
+    const int numReduces = ( commSize > 1 ? 1 : 0 );
+    if( counts.numCalls != 1+numReduces ||
+        counts.bytesSent != (1+numReduces)*bytes ||
+        counts.bytesReceived != (commSize+numReduces)*bytes )
+        LogicError
+        ("Counted ",counts.numCalls," calls which sent ",counts.bytesSent,
+         " and received ",counts.bytesReceived," bytes");
+    if( CommCountsBySite().count("mpi::AllGather") != 1 )
+        LogicError("The AllGather call site was not recorded");
+    if( GetCommCounts( mpi::COMM_SELF ).numCalls != 0 )
+        LogicError("A Broadcast over a single process was counted");
+
+    // Persistent requests are counted each time that they are started
+    const int commRank = mpi::Rank( comm );
+    mpi::Comm ringComm;
+    mpi::Dup( comm, ringComm );
+    vector<mpi::Request<double>> requests(2);
+    ResetCommCounters();
+    EnableCommCounters( false );
+    mpi::SendInit
+    ( sendBuf.data(), count, (commRank+1) % commSize, ringComm, requests[0] );
+    mpi::RecvInit
+    ( recvBuf.data(), count, (commRank+commSize-1) % commSize, ringComm,
+      requests[1] );
+    for( Int rep=0; rep<2; ++rep )
+    {
+        mpi::StartAll( 2, requests.data() );
+        mpi::WaitAll( 2, requests.data() );
+    }
+    DisableCommCounters();
+    mpi::Free( requests[0] );
+    mpi::Free( requests[1] );
+    const CommCounts ringCounts = GetCommCounts( ringComm );
+    if( ringCounts.numCalls != 4 ||
+        ringCounts.bytesSent != 2*bytes ||
+        ringCounts.bytesReceived != 2*bytes )
+        LogicError
+        ("Counted ",ringCounts.numCalls," persistent calls which sent ",
+         ringCounts.bytesSent," and received ",ringCounts.bytesReceived,
+         " bytes");
+
+    // The counts of a freed communicator must not carry over to another
+    // communicator which reuses its handle
+    mpi::Free( ringComm );
+    mpi::Dup( comm, ringComm );
+    if( GetCommCounts( ringComm ).numCalls != 0 )
+        LogicError("A new communicator inherited the counts of a freed one");
+    mpi::Free( ringComm );
+
+    PrintCommCounters( comm );
+    OutputFromRoot(comm,"Communication was counted");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of C",100);
+        const Int n = Input("--n","width of C",80);
+        const Int k = Input("--k","inner dimension",60);
+        const bool trace = Input("--trace","write a Chrome trace?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestProfiler<float>( comm, m, n, k, trace );
+        TestProfiler<double>( comm, m, n, k, trace );
+        TestCommCounters( comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
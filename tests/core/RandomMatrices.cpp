@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckIdentical
+( const string& name, const Matrix<T>& A, const Matrix<T>& B )
+{
+    Matrix<T> E( A );
+    E -= B;
+    const auto maxErr = MaxNorm( E );
+    if( maxErr != Base<T>(0) )
+        LogicError(name," differed by ",maxErr);
+}
+
+template<typename T>
+void CheckDifferent
+( const string& name, const Matrix<T>& A, const Matrix<T>& B )
+{
+    Matrix<T> E( A );
+    E -= B;
+    if( MaxNorm( E ) == Base<T>(0) )
+        LogicError(name," were identical");
+}
+
+// Random matrices drawn from the same stream over two grids must agree
+// entrywise, regardless of the grid shape or the distribution, and the
+// redundant copies must agree without any communication. Successive draws,
+// even over distinct grids on the same processes, must differ.
+template<typename T>
+void TestRandomMatrices( mpi::Comm comm, Int m, Int n )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+
+    const Grid gSquare( comm ), gColumn( comm, 1 );
+
+    DistMatrix<T> A(gSquare);
+    DistMatrix<T,VR,STAR> B(gColumn);
+    const std::uint64_t stream = gSquare.NextRandomStream();
+    gSquare.SetRandomStream( stream );
+    gColumn.SetRandomStream( stream );
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    DistMatrix<T,STAR,STAR> AFull( A ), BFull( B );
+    CheckIdentical( "Uniform", AFull.LockedMatrix(), BFull.LockedMatrix() );
+
+    DistMatrix<T,STAR,STAR> C(gSquare);
+    DistMatrix<T,MC,MR> D(gColumn);
+    gSquare.SetRandomStream( stream+1 );
+    gColumn.SetRandomStream( stream+1 );
+    Gaussian( C, m, n );
+    Gaussian( D, m, n );
+    DistMatrix<T,STAR,STAR> DFull( D );
+    CheckIdentical( "Gaussian", C.LockedMatrix(), DFull.LockedMatrix() );
+
+    // Every process must hold the same copy of C
+    Matrix<T> CRoot( C.LockedMatrix() );
+    mpi::Broadcast( CRoot.Buffer(), m*n, 0, comm );
+    CheckIdentical( "Redundant copies", C.LockedMatrix(), CRoot );
+
+    // Otherwise each draw takes a fresh stream, whether it is over the same
+    // grid or over another grid built on the same processes
+    const Grid gOther( comm );
+    DistMatrix<T> E(gSquare), F(gSquare), G(gOther);
+    Uniform( E, m, n );
+    Uniform( F, m, n );
+    Uniform( G, m, n );
+    DistMatrix<T,STAR,STAR> EFull( E ), FFull( F ), GFull( G );
+    CheckDifferent
+    ( "Successive draws", EFull.LockedMatrix(), FFull.LockedMatrix() );
+    CheckDifferent
+    ( "Draws over two grids", FFull.LockedMatrix(), GFull.LockedMatrix() );
+
+    OutputFromRoot(comm,"Random matrices were independent of the grid");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",70);
+        const Int n = Input("--width","width of matrix",45);
+        ProcessInput();
+        PrintInputReport();
+
+        TestRandomMatrices<float>( comm, m, n );
+        TestRandomMatrices<double>( comm, m, n );
+        TestRandomMatrices<Complex<float>>( comm, m, n );
+        TestRandomMatrices<Complex<double>>( comm, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestPlannedCopy
+( const DistMatrix<T>& A, Int colAlign, Int rowAlign, Int numReps )
+{
+    DistMatrix<T,U,V> BPlanned(A.Grid()), BRef(A.Grid());
+    BPlanned.Align( colAlign%BPlanned.ColStride(),
+                    rowAlign%BPlanned.RowStride() );
+    BRef.Align( BPlanned.ColAlign(), BPlanned.RowAlign() );
+
+    // Replay the same plan several times, and then redistribute back
+    for( Int rep=0; rep<numReps; ++rep )
+        PlannedCopy( A, BPlanned );
+    Copy( A, BRef );
+
+    DistMatrix<T> ACopy(A.Grid());
+    ACopy.AlignWith( A );
+    PlannedCopy( BPlanned, ACopy );
+
+    // Redistributions are exact, so any difference is an error
+    DistMatrix<T,U,V> E(BRef);
+    E -= BPlanned;
+    DistMatrix<T> F(A);
+    F -= ACopy;
+    const auto maxErrB = MaxNorm( E );
+    const auto maxErrA = MaxNorm( F );
+    if( maxErrB != Base<T>(0) || maxErrA != Base<T>(0) )
+        LogicError
+        ("PlannedCopy to [",DistToString(U),",",DistToString(V),
+         "] failed: errors of ",maxErrB," and ",maxErrA);
+    OutputFromRoot
+    (A.Grid().Comm(),"[MC,MR] <-> [",DistToString(U),",",DistToString(V),
+     "] passed");
+}
+
+template<typename T>
+void TestRedistPlans( const Grid& g, Int m, Int n, Int numReps )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    TestPlannedCopy<T,STAR,VC>( A, 0, 1, numReps );
+    TestPlannedCopy<T,VR,STAR>( A, 1, 0, numReps );
+    TestPlannedCopy<T,MC,STAR>( A, 1, 0, numReps );
+    TestPlannedCopy<T,STAR,MR>( A, 0, 1, numReps );
+    TestPlannedCopy<T,MR,MC>( A, 1, 1, numReps );
+    TestPlannedCopy<T,STAR,STAR>( A, 0, 0, numReps );
+
+    // A grid of another shape, which may be allocated at the address of the
+    // one before it, must not reuse the plans of its predecessor
+    const int commSize = mpi::Size( g.Comm() );
+    for( int height : { 1, commSize } )
+    {
+        unique_ptr<Grid> gTmp( new Grid( g.Comm(), height ) );
+        DistMatrix<T> ATmp(*gTmp);
+        Uniform( ATmp, m, n );
+        TestPlannedCopy<T,MR,MC>( ATmp, 1, 1, numReps );
+    }
+
+    ClearRedistPlans<T>();
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",40);
+        const Int numReps = Input("--numReps","number of plan replays",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestRedistPlans<float>( g, m, n, numReps );
+        TestRedistPlans<Complex<double>>( g, m, n, numReps );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
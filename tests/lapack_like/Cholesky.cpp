@@ -11,10 +11,8 @@ using namespace El;
 
 template<typename F>
 void TestCorrectness
-( bool pivot,
-  UpperOrLower uplo,
+( UpperOrLower uplo,
   const Matrix<F>& A,
-  const Permutation& p,
   const Matrix<F>& AOrig,
         Int numRHS=100 )
 {
@@ -27,18 +25,15 @@ void TestCorrectness
     Matrix<F> X, Y;
     Uniform( X, n, numRHS );
     Zeros( Y, n, numRHS );
-    Hemm( LEFT, uplo, F(1), AOrig, X, F(0), Y );
-    const Real oneNormY = OneNorm( Y );
+    Gemm( NORMAL, NORMAL, F(1), AOrig, X, F(0), Y );
+    const Real frobNormY = FrobeniusNorm( Y );
 
-    if( pivot )
-        cholesky::SolveAfter( uplo, NORMAL, A, p, Y );
-    else
-        cholesky::SolveAfter( uplo, NORMAL, A, Y );
+    cholesky::SolveAfter( uplo, NORMAL, A, Y );
     X -= Y;
-    const Real infNormE = InfinityNorm( X );
-    const Real relErr = infNormE / (eps*n*oneNormY);
+    const Real frobNormE = FrobeniusNorm( X );
+    const Real relErr = frobNormE / (eps*n*frobNormY);
 
-    Output("||X - A \\ Y ||_oo / (eps n || Y ||_1) = ",relErr);
+    Output("||X - A \\ Y ||_F / (eps n || Y ||_F) = ",relErr);
     // TODO(poulson): Use more refined failure criteria
     if( relErr > Real(100) )
         LogicError("Relative error was unacceptably large");
@@ -46,10 +41,8 @@ void TestCorrectness
 
 template<typename F>
 void TestCorrectness
-( bool pivot,
-  UpperOrLower uplo,
+( UpperOrLower uplo,
   const DistMatrix<F>& A,
-  const DistPermutation& p,
   const DistMatrix<F>& AOrig,
         Int numRHS=100 )
 {
@@ -63,19 +56,16 @@ void TestCorrectness
     DistMatrix<F> X(g), Y(g);
     Uniform( X, n, numRHS );
     Zeros( Y, n, numRHS );
-    Hemm( LEFT, uplo, F(1), AOrig, X, F(0), Y );
-    const Real oneNormY = OneNorm( Y );
+    Gemm( NORMAL, NORMAL, F(1), AOrig, X, F(0), Y );
+    const Real frobNormY = FrobeniusNorm( Y );
 
-    if( pivot )
-        cholesky::SolveAfter( uplo, NORMAL, A, p, Y );
-    else
-        cholesky::SolveAfter( uplo, NORMAL, A, Y );
+    cholesky::SolveAfter( uplo, NORMAL, A, Y );
     X -= Y;
-    const Real infNormE = InfinityNorm( X );
-    const Real relErr = infNormE / (eps*n*oneNormY);
+    const Real frobNormE = FrobeniusNorm( X );
+    const Real relErr = frobNormE / (eps*n*frobNormY);
 
     OutputFromRoot
-    (g.Comm(), "||X - A \\ Y ||_oo / (eps n || Y ||_1) = ",relErr);
+    (g.Comm(), "||X - A \\ Y ||_F / (eps n || Y ||_F) = ",relErr);
     // TODO(poulson): Use more refined failure criteria
     if( relErr > Real(100) )
         LogicError("Relative error was unacceptably large");
@@ -84,7 +74,6 @@ void TestCorrectness
 template<typename F>
 void TestSequentialCholesky
 ( UpperOrLower uplo,
-  bool pivot,
   Int m,
   bool print,
   bool printDiag,
@@ -93,9 +82,11 @@ void TestSequentialCholesky
     Output("Testing sequential Cholesky with ",TypeName<F>());
     PushIndent();
     Matrix<F> A, AOrig;
-    Permutation p;
 
-    HermitianUniformSpectrum( A, m, 1e-9, 10 );
+    // A diagonally dominant Hermitian matrix is positive-definite
+    Uniform( A, m, m );
+    MakeHermitian( LOWER, A );
+    ShiftDiagonal( A, F(m) );
     if( correctness )
         AOrig = A;
     if( print )
@@ -104,28 +95,17 @@ void TestSequentialCholesky
     Output("Cholesky...");
     Timer timer;
     timer.Start();
-    if( pivot )
-        Cholesky( uplo, A, p );
-    else
-        Cholesky( uplo, A );
+    Cholesky( uplo, A );
     const double runTime = timer.Stop();
     const double realGFlops = (1./3.)*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
     Output(runTime," seconds (",gFlops," GFlop/s)");
     if( print )
-    {
         Print( A, "A after factorization" );
-        if( pivot )
-        {
-            Matrix<Int> P;
-            p.ExplicitMatrix( P );
-            Print( P, "P" );
-        }
-    }
     if( printDiag )
         Print( GetRealPartOfDiagonal(A), "diag(A)" );
     if( correctness )
-        TestCorrectness( pivot, uplo, A, p, AOrig );
+        TestCorrectness( uplo, A, AOrig );
     PopIndent();
 }
 
@@ -133,7 +113,6 @@ template<typename F>
 void TestCholesky
 ( const Grid& g,
   UpperOrLower uplo,
-  bool pivot,
   Int m,
   Int nbLocal,
   bool print,
@@ -144,17 +123,19 @@ void TestCholesky
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
     DistMatrix<F> A(g), AOrig(g);
-    DistPermutation p(g);
 
     SetLocalTrrkBlocksize<F>( nbLocal );
 
-    HermitianUniformSpectrum( A, m, 1e-9, 10 );
+    // A diagonally dominant Hermitian matrix is positive-definite
+    Uniform( A, m, m );
+    MakeHermitian( LOWER, A );
+    ShiftDiagonal( A, F(m) );
     if( correctness )
         AOrig = A;
     if( print )
         Print( A, "A" );
 
-    if( scalapack && !pivot )
+    if( scalapack )
         OutputFromRoot
         (g.Comm(),"ScaLAPACK Cholesky (including round-trip conversion)...");
     else
@@ -162,29 +143,18 @@ void TestCholesky
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    if( pivot )
-        Cholesky( uplo, A, p );
-    else
-        Cholesky( uplo, A, scalapack );
+    Cholesky( uplo, A, scalapack );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
     OutputFromRoot(g.Comm(),runTime," seconds (",gFlops," GFlop/s)");
     if( print )
-    {
         Print( A, "A after factorization" );
-        if( pivot )
-        {
-            DistMatrix<Int,VC,STAR> P(g);
-            p.ExplicitMatrix( P );
-            Print( P, "P" );
-        }
-    }
     if( printDiag )
         Print( GetRealPartOfDiagonal(A), "diag(A)" );
     if( correctness )
-        TestCorrectness( pivot, uplo, A, p, AOrig );
+        TestCorrectness( uplo, A, AOrig );
     PopIndent();
 }
 
@@ -200,9 +170,8 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int m = Input("--m","height of matrix",100);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
-        const bool pivot = Input("--pivot","use pivoting?",false);
         const bool correctness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -235,85 +204,85 @@ main( int argc, char* argv[] )
         if( sequential && mpi::Rank(comm) == 0 )
         {
             TestSequentialCholesky<float>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<float>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<double>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<double>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
 
 #ifdef EL_HAVE_QD
             TestSequentialCholesky<DoubleDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<QuadDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
 
             TestSequentialCholesky<Complex<DoubleDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<QuadDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSequentialCholesky<Quad>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<Quad>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSequentialCholesky<BigFloat>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<BigFloat>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, m, print, printDiag, correctness );
 #endif
         }
 
         TestCholesky<float>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<Complex<float>>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<double>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<Complex<double>>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<QuadDouble>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
 
         TestCholesky<Complex<DoubleDouble>>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<Complex<QuadDouble>>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<Complex<Quad>>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
         TestCholesky<Complex<BigFloat>>
-        ( g, uplo, pivot, m, nbLocal,
+        ( g, uplo, m, nbLocal,
           print, printDiag, correctness, scalapack );
 #endif
     }
@@ -21,7 +21,7 @@ void TestCorrectness
     const Int m = A.Height();
     const Int n = A.Width();
     const Real eps = limits::Epsilon<Real>();
-    const Real oneNormA = OneNorm( A );
+    const Real frobNormA = FrobeniusNorm( A );
 
     // Form I - Q^H Q
     OutputFromRoot(g.Comm(),"Testing orthogonality of Q");
@@ -30,20 +30,20 @@ void TestCorrectness
     Identity( Z, n, n );
     DistMatrix<F> Q_MC_MR( Q );
     Herk( UPPER, ADJOINT, Base<F>(-1), Q_MC_MR, Base<F>(1), Z );
-    const Real infOrthogError = HermitianInfinityNorm( UPPER, Z );
-    const Real relOrthogError = infOrthogError / (eps*Max(m,n)*oneNormA);
+    const Real frobOrthogError = HermitianFrobeniusNorm( UPPER, Z );
+    const Real relOrthogError = frobOrthogError / (eps*Max(m,n));
     OutputFromRoot
-    (g.Comm(),"||Q^H Q - I||_oo / (eps Max(m,n) || A ||_1) = ",relOrthogError);
+    (g.Comm(),"||Q^H Q - I||_F / (eps Max(m,n)) = ",relOrthogError);
     PopIndent();
 
     // Form A - Q R
     OutputFromRoot(g.Comm(),"Testing if A = QR");
     PushIndent();
     LocalGemm( NORMAL, NORMAL, F(-1), Q, R, F(1), A );
-    const Real infNormError = InfinityNorm( A );
-    const Real relError = infNormError / (eps*Max(m,n)*oneNormA);
+    const Real frobError = FrobeniusNorm( A );
+    const Real relError = frobError / (eps*Max(m,n)*frobNormA);
     OutputFromRoot
-    (g.Comm(),"||A - QR||_oo / (eps Max(m,n) || A ||_1) = ",relError);
+    (g.Comm(),"||A - QR||_F / (eps Max(m,n) || A ||_F) = ",relError);
     PopIndent();
 
     // TODO: More refined failure conditions (especially in this case...)
@@ -58,10 +58,13 @@ void TestQR
 ( const Grid& g,
   Int m, 
   Int n,
+  const qr::CholeskyQRCtrl& ctrl,
   bool testCorrectness,
   bool print )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<F>()," and ",ctrl.numPasses,
+     " pass(es)",(ctrl.shift ? " with a shift" : ""));
     PushIndent();
     DistMatrix<F,VC,STAR> A(g), Q(g);
     DistMatrix<F,STAR,STAR> R(g);
@@ -75,7 +78,7 @@ void TestQR
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    qr::Cholesky( Q, R );
+    qr::Cholesky( Q, R, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
@@ -101,7 +104,7 @@ main( int argc, char* argv[] )
     try
     {
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
-        const Int m = Input("--height","height of matrix",100);
+        const Int m = Input("--height","height of matrix",1000);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool testCorrectness = Input
@@ -122,26 +125,48 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
-        TestQR<float>( g, m, n, testCorrectness, print );
-        TestQR<Complex<float>>( g, m, n, testCorrectness, print );
+        // A single pass, CholeskyQR2, and a shifted CholeskyQR3
+        vector<qr::CholeskyQRCtrl> ctrls(3);
+        ctrls[0].numPasses = 1;
+        ctrls[1].numPasses = 2;
+        ctrls[2].numPasses = 3;
+        ctrls[2].shift = true;
+        for( const auto& ctrl : ctrls )
+        {
+            TestQR<float>( g, m, n, ctrl, testCorrectness, print );
+            TestQR<Complex<float>>( g, m, n, ctrl, testCorrectness, print );
 
-        TestQR<double>( g, m, n, testCorrectness, print );
-        TestQR<Complex<double>>( g, m, n, testCorrectness, print );
+            TestQR<double>( g, m, n, ctrl, testCorrectness, print );
+            TestQR<Complex<double>>( g, m, n, ctrl, testCorrectness, print );
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>( g, m, n, testCorrectness, print );
-        TestQR<QuadDouble>( g, m, n, testCorrectness, print );
+            TestQR<DoubleDouble>( g, m, n, ctrl, testCorrectness, print );
+            TestQR<QuadDouble>( g, m, n, ctrl, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>( g, m, n, testCorrectness, print );
-        TestQR<Complex<Quad>>( g, m, n, testCorrectness, print );
+            TestQR<Quad>( g, m, n, ctrl, testCorrectness, print );
+            TestQR<Complex<Quad>>( g, m, n, ctrl, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>( g, m, n, testCorrectness, print );
-        TestQR<Complex<BigFloat>>( g, m, n, testCorrectness, print );
+            TestQR<BigFloat>( g, m, n, ctrl, testCorrectness, print );
+            TestQR<Complex<BigFloat>>( g, m, n, ctrl, testCorrectness, print );
 #endif
+        }
+
+        // Asking for no passes at all is an error
+        qr::CholeskyQRCtrl badCtrl;
+        badCtrl.numPasses = 0;
+        DistMatrix<double,VC,STAR> A(g);
+        DistMatrix<double,STAR,STAR> R(g);
+        Uniform( A, m, n );
+        bool threw = false;
+        try { qr::Cholesky( A, R, badCtrl ); }
+        catch( std::logic_error& ) { threw = true; }
+        if( !threw )
+            LogicError("Cholesky QR accepted numPasses=0");
+        OutputFromRoot(comm,"Cholesky QR rejected numPasses=0");
     }
     catch( exception& e ) { ReportException(e); }
 
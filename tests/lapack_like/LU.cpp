@@ -14,8 +14,7 @@ void TestCorrectness
 ( const Matrix<Field>& AOrig,
   const Matrix<Field>& A,
   const Permutation& P,
-  const Permutation& Q,
-  Int pivoting,
+  LUPivotType pivotType,
   bool print,
   Int numRHS=100 )
 {
@@ -23,7 +22,7 @@ void TestCorrectness
     const Int m = AOrig.Height();
     const Int n = AOrig.Width();
     const Real eps = limits::Epsilon<Real>();
-    const Real oneNormAOrig = OneNorm( AOrig );
+    const Real frobNormAOrig = FrobeniusNorm( AOrig );
 
     Output("Testing error...");
     PushIndent();
@@ -32,24 +31,23 @@ void TestCorrectness
     Matrix<Field> X;
     Uniform( X, m, numRHS );
     auto Y( X );
-    const Real oneNormY = OneNorm( Y );
-    if( pivoting == 0 )
+    const Real frobNormY = FrobeniusNorm( Y );
+    if( pivotType == LU_WITHOUT_PIVOTING )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
-        lu::SolveAfter( NORMAL, A, P, Y );
     else
-        lu::SolveAfter( NORMAL, A, P, Q, Y );
+        lu::SolveAfter( NORMAL, A, P, Y );
 
-    // Now investigate the residual, ||AOrig Y - X||_oo
+    // Now investigate the residual, ||AOrig Y - X||_F
     Gemm( NORMAL, NORMAL, Field(-1), AOrig, Y, Field(1), X );
-    const Real infError = InfinityNorm( X );
-    const Real relError = infError / (eps*Max(m,n)*Max(oneNormAOrig,oneNormY));
+    const Real frobError = FrobeniusNorm( X );
+    const Real relError =
+      frobError / (eps*Max(m,n)*Max(frobNormAOrig,frobNormY));
 
     Output
-    ("|| Y - A X ||_oo / (eps Max(m,n) Max(||A||_1,||Y||_1)) = ",relError);
+    ("|| Y - A X ||_F / (eps Max(m,n) Max(||A||_F,||Y||_F)) = ",relError);
 
     // TODO: Use a more refined failure condition
-    if( pivoting > 0 && relError > Real(100) )
+    if( pivotType != LU_WITHOUT_PIVOTING && relError > Real(100) )
         LogicError("Relative error was unacceptably large");
 
     PopIndent();
@@ -60,8 +58,7 @@ void TestCorrectness
 ( const DistMatrix<Field>& AOrig,
   const DistMatrix<Field>& A,
   const DistPermutation& P,
-  const DistPermutation& Q,
-  Int pivoting,
+  LUPivotType pivotType,
   bool print,
   Int numRHS=100 )
 {
@@ -70,7 +67,7 @@ void TestCorrectness
     const Int m = AOrig.Height();
     const Int n = AOrig.Width();
     const Real eps = limits::Epsilon<Real>();
-    const Real oneNormAOrig = OneNorm( AOrig );
+    const Real frobNormAOrig = FrobeniusNorm( AOrig );
 
     OutputFromRoot(grid.Comm(),"Testing error...");
     PushIndent();
@@ -79,98 +76,74 @@ void TestCorrectness
     DistMatrix<Field> X(grid);
     Uniform( X, m, numRHS );
     auto Y( X );
-    const Real oneNormY = OneNorm( Y );
-    if( pivoting == 0 )
+    const Real frobNormY = FrobeniusNorm( Y );
+    if( pivotType == LU_WITHOUT_PIVOTING )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
-        lu::SolveAfter( NORMAL, A, P, Y );
     else
-        lu::SolveAfter( NORMAL, A, P, Q, Y );
+        lu::SolveAfter( NORMAL, A, P, Y );
 
-    // Now investigate the residual, ||AOrig Y - X||_oo
+    // Now investigate the residual, ||AOrig Y - X||_F
     Gemm( NORMAL, NORMAL, Field(-1), AOrig, Y, Field(1), X );
-    const Real infError = InfinityNorm( X );
-    const Real relError = infError / (eps*Max(m,n)*Max(oneNormAOrig,oneNormY));
+    const Real frobError = FrobeniusNorm( X );
+    const Real relError =
+      frobError / (eps*Max(m,n)*Max(frobNormAOrig,frobNormY));
 
     OutputFromRoot
     (grid.Comm(),
-     "|| Y - A X ||_oo / (eps Max(m,n) Max(||A||_1,||Y||_1)) = ",relError);
+     "|| Y - A X ||_F / (eps Max(m,n) Max(||A||_F,||Y||_F)) = ",relError);
 
     // TODO: Use a more refined failure condition
-    if( pivoting > 0 && relError > Real(100) )
+    if( pivotType != LU_WITHOUT_PIVOTING && relError > Real(100) )
         LogicError("Relative error was unacceptably large");
 
     PopIndent();
 }
 
+// The growth factor was requested, so it must have been measured
+template<typename Real>
+void CheckGrowthFactor( const LUInfo<Real>& info )
+{
+    if( !(info.growthFactor > Real(0) &&
+          info.growthFactor <= limits::Max<Real>()) )
+        LogicError("Invalid growth factor of ",info.growthFactor);
+}
+
 template<typename Field>
 void TestLU
 ( Int m,
-  Int pivoting,
+  LUPivotType pivotType,
   bool correctness,
-  bool forceGrowth,
   bool print )
 {
     Output("Testing with ",TypeName<Field>());
     PushIndent();
     Matrix<Field> A, AOrig;
-    Permutation P, Q;
-
-    if( forceGrowth )
-        GEPPGrowth( A, m );
-    else
-        Uniform( A, m, m );
+    Permutation P;
+    Uniform( A, m, m );
 
     if( correctness )
         AOrig = A;
     if( print )
         Print( A, "A" );
 
+    LUCtrl ctrl;
+    ctrl.pivotType = pivotType;
+    ctrl.growth = true;
+
     Output("Starting LU factorization...");
     Timer timer;
     timer.Start();
-    if( pivoting == 0 )
-        LU( A );
-    else if( pivoting == 1 )
-        LU( A, P );
-    else if( pivoting == 2 )
-        LU( A, P, Q );
+    const auto info = LU( A, P, ctrl );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
     Output(runTime," seconds (",gFlops," GFlop/s)");
+    Output("growth factor: ",info.growthFactor);
+    CheckGrowthFactor( info );
     if( print )
-    {
         Print( A, "A after factorization" );
-        if( pivoting >= 1 )
-        {
-            // This needs to be rewritten in light of Permutation
-            /*
-            Matrix<Int> P;
-            Matrix<Int> p;
-            Print( P, "rowPiv after factorization" );
-            PivotsToPermutation( rowPiv, p );
-            Print( p, "p after factorization");
-            ExplicitPermutation( p, P );
-            Print( P, "P" );
-            */
-        }
-        if( pivoting == 2 )
-        {
-            // This needs to be rewritten in light of Permutation
-            /*
-            Matrix<Int> Q;
-            Matrix<Int> q;
-            Print( colPiv, "colPiv after factorization" );
-            PivotsToPermutation( colPiv, q );
-            Print( q, "q after factorization");
-            ExplicitPermutation( q, Q );
-            Print( Q, "Q" );
-            */
-        }
-    }
     if( correctness )
-        TestCorrectness( AOrig, A, P, Q, pivoting, print );
+        TestCorrectness( AOrig, A, P, pivotType, print );
     PopIndent();
 }
 
@@ -178,73 +151,41 @@ template<typename Field>
 void TestLU
 ( const Grid& grid,
   Int m,
-  Int pivoting,
+  LUPivotType pivotType,
   bool correctness,
-  bool forceGrowth,
   bool print )
 {
     OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
     PushIndent();
     DistMatrix<Field> A(grid), AOrig(grid);
-    DistPermutation P(grid), Q(grid);
-
-    if( forceGrowth )
-        GEPPGrowth( A, m );
-    else
-        Uniform( A, m, m );
+    DistPermutation P(grid);
+    Uniform( A, m, m );
 
     if( correctness )
         AOrig = A;
     if( print )
         Print( A, "A" );
 
+    LUCtrl ctrl;
+    ctrl.pivotType = pivotType;
+    ctrl.growth = true;
+
     OutputFromRoot(grid.Comm(),"Starting LU factorization...");
     mpi::Barrier( grid.Comm() );
     Timer timer;
     timer.Start();
-    if( pivoting == 0 )
-        LU( A );
-    else if( pivoting == 1 )
-        LU( A, P );
-    else if( pivoting == 2 )
-        LU( A, P, Q );
+    const auto info = LU( A, P, ctrl );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
     OutputFromRoot(grid.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+    OutputFromRoot(grid.Comm(),"growth factor: ",info.growthFactor);
+    CheckGrowthFactor( info );
     if( print )
-    {
         Print( A, "A after factorization" );
-        if( pivoting >= 1 )
-        {
-            // This needs to be rewritten in light of DistPermutation
-            /*
-            DistMatrix<Int> P(grid);
-            DistMatrix<Int,STAR,STAR> p(grid);
-            Print( P, "rowPiv after factorization" );
-            PivotsToPermutation( rowPiv, p );
-            Print( p, "p after factorization");
-            ExplicitPermutation( p, P );
-            Print( P, "P" );
-            */
-        }
-        if( pivoting == 2 )
-        {
-            // This needs to be rewritten in light of DistPermutation
-            /*
-            DistMatrix<Int> Q(grid);
-            DistMatrix<Int,STAR,STAR> q(grid);
-            Print( colPiv, "colPiv after factorization" );
-            PivotsToPermutation( colPiv, q );
-            Print( q, "q after factorization");
-            ExplicitPermutation( q, Q );
-            Print( Q, "Q" );
-            */
-        }
-    }
     if( correctness )
-        TestCorrectness( AOrig, A, P, Q, pivoting, print );
+        TestCorrectness( AOrig, A, P, pivotType, print );
     PopIndent();
 }
 
@@ -260,9 +201,6 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
-        const bool forceGrowth = Input
-            ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -272,8 +210,6 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
-            LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
@@ -285,87 +221,89 @@ main( int argc, char* argv[] )
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
-        if( pivot == 0 )
-            OutputFromRoot(grid.Comm(),"Testing LU with no pivoting");
-        else if( pivot == 1 )
-            OutputFromRoot(grid.Comm(),"Testing LU with partial pivoting");
-        else if( pivot == 2 )
-            OutputFromRoot(grid.Comm(),"Testing LU with full pivoting");
-
-        if( sequential && mpi::Rank() == 0 )
+        const LUPivotType pivotTypes[3] =
+          { LU_WITHOUT_PIVOTING, LU_PARTIAL, LU_TOURNAMENT };
+        const string pivotNames[3] = { "no", "partial", "tournament" };
+        for( Int k=0; k<3; ++k )
         {
+            const LUPivotType pivot = pivotTypes[k];
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with ",pivotNames[k]," pivoting");
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestLU<float>
+                ( m, pivot, correctness, print );
+                TestLU<Complex<float>>
+                ( m, pivot, correctness, print );
+
+                TestLU<double>
+                ( m, pivot, correctness, print );
+                TestLU<Complex<double>>
+                ( m, pivot, correctness, print );
+
+#ifdef EL_HAVE_QD
+                TestLU<DoubleDouble>
+                ( m, pivot, correctness, print );
+                TestLU<QuadDouble>
+                ( m, pivot, correctness, print );
+
+                TestLU<Complex<DoubleDouble>>
+                ( m, pivot, correctness, print );
+                TestLU<Complex<QuadDouble>>
+                ( m, pivot, correctness, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+                TestLU<Quad>
+                ( m, pivot, correctness, print );
+                TestLU<Complex<Quad>>
+                ( m, pivot, correctness, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+                TestLU<BigFloat>
+                ( m, pivot, correctness, print );
+                TestLU<Complex<BigFloat>>
+                ( m, pivot, correctness, print );
+#endif
+            }
+
             TestLU<float>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
             TestLU<Complex<float>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
 
             TestLU<double>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
             TestLU<Complex<double>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
 
 #ifdef EL_HAVE_QD
             TestLU<DoubleDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
             TestLU<QuadDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
 
             TestLU<Complex<DoubleDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
             TestLU<Complex<QuadDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestLU<Quad>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
             TestLU<Complex<Quad>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestLU<BigFloat>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
             TestLU<Complex<BigFloat>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( grid, m, pivot, correctness, print );
 #endif
         }
-
-        TestLU<float>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<float>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-
-        TestLU<double>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<double>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-
-#ifdef EL_HAVE_QD
-        TestLU<DoubleDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<QuadDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-
-        TestLU<Complex<DoubleDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<QuadDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-#endif
-
-#ifdef EL_HAVE_QUAD
-        TestLU<Quad>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<Quad>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-#endif
-
-#ifdef EL_HAVE_MPC
-        TestLU<BigFloat>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-        TestLU<Complex<BigFloat>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
-#endif
     }
     catch( exception& e ) { ReportException(e); }
 
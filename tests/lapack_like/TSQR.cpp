@@ -13,6 +13,7 @@ template<typename F>
 void TestCorrectness
 ( const DistMatrix<F,VC,  STAR>& Q,
   const DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,STAR,STAR>& QHA,
         DistMatrix<F,VC,  STAR>& A )
 {
     typedef Base<F> Real;
@@ -21,7 +22,7 @@ void TestCorrectness
     const Int n = A.Width();
     const Int maxDim = Max(m,n);
     const Real eps = limits::Epsilon<Real>();
-    const Real oneNormA = OneNorm( A );
+    const Real frobNormA = FrobeniusNorm( A );
 
     // Form I - Q^H Q
     OutputFromRoot(g.Comm(),"Testing orthogonality of Q...");
@@ -29,27 +30,39 @@ void TestCorrectness
     DistMatrix<F> Z(g);
     Identity( Z, n, n );
     Herk( UPPER, ADJOINT, Real(-1), Q, Real(1), Z );
-    const Real infOrthogError = HermitianInfinityNorm( UPPER, Z );
-    const Real relOrthogError = infOrthogError / (eps*maxDim);
+    const Real frobOrthogError = HermitianFrobeniusNorm( UPPER, Z );
+    const Real relOrthogError = frobOrthogError / (eps*maxDim);
     OutputFromRoot
     (g.Comm(),
-     "||Q^H Q - I||_oo / (eps Max(m,n)) = ",relOrthogError);
+     "||Q^H Q - I||_F / (eps Max(m,n)) = ",relOrthogError);
+    PopIndent();
+
+    // Form Q^H A - R, with Q^H applied implicitly
+    OutputFromRoot(g.Comm(),"Testing if the implicit Q^H A ~= R...");
+    PushIndent();
+    DistMatrix<F,STAR,STAR> E( QHA );
+    Axpy( F(-1), R, E );
+    const Real relApplyError = FrobeniusNorm( E ) / (eps*maxDim*frobNormA);
+    OutputFromRoot
+    (g.Comm(),"||Q^H A - R||_F / (eps Max(m,n) ||A||_F) = ",relApplyError);
     PopIndent();
 
     // Form A - Q R
     OutputFromRoot(g.Comm(),"Testing if A ~= QR...");
     PushIndent();
     LocalGemm( NORMAL, NORMAL, F(-1), Q, R, F(1), A );
-    const Real infError = InfinityNorm( A );
-    const Real relError = infError / (eps*maxDim*oneNormA);
+    const Real frobError = FrobeniusNorm( A );
+    const Real relError = frobError / (eps*maxDim*frobNormA);
     OutputFromRoot
-    (g.Comm(),"||A - QR||_oo / (eps Max(m,n) ||A||_1) = ",relError);
+    (g.Comm(),"||A - QR||_F / (eps Max(m,n) ||A||_F) = ",relError);
 
     PopIndent();
 
     // TODO: More rigorous failure conditions
     if( relOrthogError > Real(10) )
         LogicError("Unacceptably large relative orthogonality error");
+    if( relApplyError > Real(10) )
+        LogicError("Unacceptably large relative error in applying Q^H");
     if( relError > Real(10) )
         LogicError("Unacceptably large relative error");
 }
@@ -59,43 +72,93 @@ void TestQR
 ( const Grid& g,
   Int m,
   Int n,
+  qr::TSTreeType tree,
   bool correctness,
   bool print )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    OutputFromRoot
+    (g.Comm(),"Testing ",m," x ",n," with ",TypeName<F>()," and a ",
+     (tree == qr::TS_FLAT ? "flat" : "butterfly")," tree");
     PushIndent();
 
-    DistMatrix<F,VC,STAR> A(g), AFact(g);
-    DistMatrix<F,STAR,STAR> R(g);
+    DistMatrix<F,VC,STAR> A(g), Q(g);
+    DistMatrix<F,STAR,STAR> R(g), QHA(g);
 
     Uniform( A, m, n );
     if( print )
         Print( A, "A" );
-    AFact = A;
 
     Timer timer;
 
     OutputFromRoot(g.Comm(),"Starting TSQR factorization...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    qr::ExplicitTS( AFact, R );
+    auto treeData = qr::TS( A, tree );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
     const double nD = double(n);
-    const double gFlops = (2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
+    const double gFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
     OutputFromRoot(g.Comm(),"Time = ",runTime," seconds (",gFlops," GFlop/s)");
+
+    qr::ts::ApplyQ( ADJOINT, A, treeData, A, QHA );
+    Q = A;
+    qr::ExplicitTS( Q, R, tree );
     if( print )
     {
-        Print( AFact, "Q" );
+        Print( Q, "Q" );
         Print( R, "R" );
     }
     if( correctness )
-        TestCorrectness( AFact, R, A );
+        TestCorrectness( Q, R, QHA, A );
     PopIndent();
     OutputFromRoot(g.Comm(),"");
 }
 
+// Runs every tree over every datatype on the given grid
+void TestAllTypes
+( const Grid& g, Int m, Int n, bool correctness, bool print )
+{
+    for( const auto tree : {qr::TS_BUTTERFLY,qr::TS_FLAT} )
+    {
+        TestQR<float>
+        ( g, m, n, tree, correctness, print );
+        TestQR<Complex<float>>
+        ( g, m, n, tree, correctness, print );
+
+        TestQR<double>
+        ( g, m, n, tree, correctness, print );
+        TestQR<Complex<double>>
+        ( g, m, n, tree, correctness, print );
+
+#ifdef EL_HAVE_QD
+        TestQR<DoubleDouble>
+        ( g, m, n, tree, correctness, print );
+        TestQR<QuadDouble>
+        ( g, m, n, tree, correctness, print );
+
+        TestQR<Complex<DoubleDouble>>
+        ( g, m, n, tree, correctness, print );
+        TestQR<Complex<QuadDouble>>
+        ( g, m, n, tree, correctness, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        TestQR<Quad>
+        ( g, m, n, tree, correctness, print );
+        TestQR<Complex<Quad>>
+        ( g, m, n, tree, correctness, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+        TestQR<BigFloat>
+        ( g, m, n, tree, correctness, print );
+        TestQR<Complex<BigFloat>>
+        ( g, m, n, tree, correctness, print );
+#endif
+    }
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -127,41 +190,31 @@ main( int argc, char* argv[] )
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test TSQR");
 
-        TestQR<float>
-        ( g, m, n, correctness, print );
-        TestQR<Complex<float>>
-        ( g, m, n, correctness, print );
-
-        TestQR<double>
-        ( g, m, n, correctness, print );
-        TestQR<Complex<double>>
-        ( g, m, n, correctness, print );
-
-#ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>
-        ( g, m, n, correctness, print );
-        TestQR<QuadDouble>
-        ( g, m, n, correctness, print );
-
-        TestQR<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print );
-        TestQR<Complex<QuadDouble>>
-        ( g, m, n, correctness, print );
-#endif
-
-#ifdef EL_HAVE_QUAD
-        TestQR<Quad>
-        ( g, m, n, correctness, print );
-        TestQR<Complex<Quad>>
-        ( g, m, n, correctness, print );
-#endif
-
-#ifdef EL_HAVE_MPC
-        TestQR<BigFloat>
-        ( g, m, n, correctness, print );
-        TestQR<Complex<BigFloat>>
-        ( g, m, n, correctness, print );
-#endif
+        // A shape where some processes own fewer than n rows of A and the
+        // others own n, so that the reduction pads some local R factors
+        const Int p = mpi::Size( comm );
+        const Int nRagged = 8;
+        const Int mRagged = p*(nRagged-1) + 1;
+        TestAllTypes( g, m, n, correctness, print );
+        TestAllTypes( g, mRagged, nRagged, correctness, print );
+
+        // The butterfly folds the processes beyond the largest power of two
+        // into it, so a power-of-two grid is also tested on a subset of one
+        // fewer process
+        if( p > 2 && (p & (p-1)) == 0 )
+        {
+            const int inSubset = ( mpi::Rank(comm) < p-1 );
+            mpi::Comm subComm;
+            mpi::Split( comm, inSubset, mpi::Rank(comm), subComm );
+            if( inSubset )
+            {
+                const Grid subGrid( subComm, order );
+                TestAllTypes( subGrid, m, n, correctness, print );
+                TestAllTypes
+                ( subGrid, (p-1)*(nRagged-1)+1, nRagged, correctness, print );
+            }
+            mpi::Free( subComm );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 